@@ -57,6 +57,7 @@
 #include "core/string_formatter.h"
 
 VARIANT_ENUM_CAST(_ResourceManager::SaverFlags);
+VARIANT_ENUM_CAST(_ResourceManager::ThreadLoadStatus);
 VARIANT_ENUM_CAST(_OS::VideoDriver);
 VARIANT_ENUM_CAST(_OS::Weekday);
 VARIANT_ENUM_CAST(_OS::Month);
@@ -106,6 +107,32 @@ RES _ResourceManager::load(StringView p_path, StringView p_type_hint, bool p_no_
     return ret;
 }
 
+Error _ResourceManager::load_threaded_request(StringView p_path, StringView p_type_hint, int p_priority) {
+    return gResourceManager().load_threaded_request(p_path, p_type_hint, p_priority);
+}
+
+_ResourceManager::ThreadLoadStatus _ResourceManager::load_threaded_get_status(StringView p_path, Array p_progress) {
+    float progress = 0;
+    ResourceManager::ThreadLoadStatus status = gResourceManager().load_threaded_get_status(p_path, &progress);
+    // the array is shared with the caller, so it works as an optional out parameter.
+    if (!p_progress.empty()) {
+        p_progress[0] = progress;
+    }
+    return ThreadLoadStatus(status);
+}
+
+RES _ResourceManager::load_threaded_get(StringView p_path) {
+    Error err = OK;
+    RES ret(gResourceManager().load_threaded_get(p_path, &err));
+
+    ERR_FAIL_COND_V_MSG(err != OK, ret, "Error loading resource: '" + String(p_path) + "'.");
+    return ret;
+}
+
+void _ResourceManager::load_threaded_cancel(StringView p_path) {
+    gResourceManager().load_threaded_cancel(p_path);
+}
+
 PoolStringArray _ResourceManager::get_recognized_extensions_for_type(StringView p_type) {
     Vector<String> exts;
     gResourceManager().get_recognized_extensions_for_type(p_type, exts);
@@ -163,6 +190,12 @@ void _ResourceManager::_bind_methods() {
             &_ResourceManager::load_interactive, { DEFVAL(String()) });
     MethodBinder::bind_method(D_METHOD("load", { "path", "type_hint", "no_cache" }), &_ResourceManager::load,
             { DEFVAL(String()), DEFVAL(false) });
+    MethodBinder::bind_method(D_METHOD("load_threaded_request", { "path", "type_hint", "priority" }),
+            &_ResourceManager::load_threaded_request, { DEFVAL(String()), DEFVAL(0) });
+    MethodBinder::bind_method(D_METHOD("load_threaded_get_status", { "path", "progress" }),
+            &_ResourceManager::load_threaded_get_status, { DEFVAL(Array()) });
+    MethodBinder::bind_method(D_METHOD("load_threaded_get", { "path" }), &_ResourceManager::load_threaded_get);
+    MethodBinder::bind_method(D_METHOD("load_threaded_cancel", { "path" }), &_ResourceManager::load_threaded_cancel);
     MethodBinder::bind_method(D_METHOD("get_recognized_extensions_for_type", { "type" }),
             &_ResourceManager::get_recognized_extensions_for_type);
     MethodBinder::bind_method(
@@ -179,6 +212,11 @@ void _ResourceManager::_bind_methods() {
     BIND_ENUM_CONSTANT(FLAG_SAVE_BIG_ENDIAN);
     BIND_ENUM_CONSTANT(FLAG_COMPRESS);
     BIND_ENUM_CONSTANT(FLAG_REPLACE_SUBRESOURCE_PATHS);
+
+    BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
+    BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
+    BIND_ENUM_CONSTANT(THREAD_LOAD_FAILED);
+    BIND_ENUM_CONSTANT(THREAD_LOAD_LOADED);
 }
 
 _ResourceManager::_ResourceManager() {
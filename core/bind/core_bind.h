@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/array.h"
 #include "core/reference.h"
 #include "core/io/compression.h"
 #include "core/method_enum_caster.h"
@@ -70,6 +71,12 @@ public:
         FLAG_COMPRESS = 32,
         FLAG_REPLACE_SUBRESOURCE_PATHS = 64,
     };
+    enum ThreadLoadStatus {
+        THREAD_LOAD_INVALID_RESOURCE,
+        THREAD_LOAD_IN_PROGRESS,
+        THREAD_LOAD_FAILED,
+        THREAD_LOAD_LOADED,
+    };
 
     static _ResourceManager*get_singleton() { return singleton; }
 
@@ -78,6 +85,10 @@ public:
 
     INVOCABLE Ref<ResourceInteractiveLoader> load_interactive(StringView p_path, StringView p_type_hint = StringView());
     INVOCABLE RES load(StringView p_path, StringView p_type_hint = StringView(), bool p_no_cache = false);
+    INVOCABLE Error load_threaded_request(StringView p_path, StringView p_type_hint = StringView(), int p_priority = 0);
+    INVOCABLE ThreadLoadStatus load_threaded_get_status(StringView p_path, Array p_progress = Array());
+    INVOCABLE RES load_threaded_get(StringView p_path);
+    INVOCABLE void load_threaded_cancel(StringView p_path);
     INVOCABLE PoolStringArray get_recognized_extensions_for_type(StringView p_type);
     INVOCABLE void set_abort_on_missing_resources(bool p_abort);
     INVOCABLE Vector<String> get_dependencies(StringView p_path);
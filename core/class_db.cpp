@@ -362,6 +362,30 @@ Object *ClassDB::instance(const StringName &p_class) {
     return ti->creation_func();
 }
 
+ClassDB::CreationFunc ClassDB::get_creation_func(const StringName &p_class, StringName *r_instanced_class) {
+    RWLockRead _rw_lockr_(lock);
+
+    auto iter = classes.find(p_class);
+    if (iter == classes.end() || iter->second.disabled || !iter->second.creation_func) {
+        if (compat_classes.contains(p_class)) {
+            iter = classes.find(compat_classes[p_class]);
+        }
+    }
+    if (iter == classes.end() || iter->second.disabled) {
+        return nullptr;
+    }
+    const ClassInfo &ti(iter->second);
+#ifdef TOOLS_ENABLED
+    if (ti.api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+        return nullptr;
+    }
+#endif
+    if (r_instanced_class) {
+        *r_instanced_class = ti.name;
+    }
+    return ti.creation_func;
+}
+
 bool ClassDB::can_instance(const StringName &p_class) {
     RWLockRead _rw_lockr_(lock);
 
@@ -392,6 +416,8 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
     if (!ti.inherits.empty()) {
         ERR_FAIL_COND(!classes.contains(ti.inherits)); // it MUST be registered.
         ti.inherits_ptr = &classes[ti.inherits];
+        ti.inherits_ptr->has_inheriters = true;
+        ti.flat_property_setget = ti.inherits_ptr->flat_property_setget;
 
     } else {
         ti.inherits_ptr = nullptr;
@@ -813,7 +839,20 @@ void ClassDB::add_property(StringName p_class, const PropertyInfo &p_pinfo, cons
     psg.index = p_index;
     psg.type = p_pinfo.type;
 
-    type->property_setget[p_pinfo.name] = psg;
+    PropertySetGet &stored(type->property_setget[p_pinfo.name]);
+    stored = psg;
+    type->flat_property_setget[p_pinfo.name] = &stored;
+    // properties are normally added before any inheriting class is registered, handle late additions anyway.
+    if (type->has_inheriters) {
+        for (eastl::pair<const StringName, ClassInfo> &E : classes) {
+            for (ClassInfo *check = E.second.inherits_ptr; check; check = check->inherits_ptr) {
+                if (check == type) {
+                    _build_flat_property_setget(E.second);
+                    break;
+                }
+            }
+        }
+    }
 }
 
 void ClassDB::set_property_default_value(StringName p_class, const StringName &p_name, const Variant &p_default) {
@@ -844,82 +883,116 @@ void ClassDB::get_property_list(
         check = check->inherits_ptr;
     }
 }
-bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-    auto iter = classes.find(p_object->get_class_name());
-    ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter = check->property_setget.find(p_property);
-        if (iter != check->property_setget.end()) {
-            const PropertySetGet &psg(iter->second);
-            if (!psg.setter) {
-                if (r_valid) {
-                    *r_valid = false;
-                }
-                return true; // return true but do nothing
-            }
+const ClassDB::PropertySetGet *ClassDB::_find_property_setget(const ClassInfo *p_class, const StringName &p_property) {
+    if (!p_class) {
+        return nullptr;
+    }
+    auto iter = p_class->flat_property_setget.find(p_property);
+    return iter != p_class->flat_property_setget.end() ? iter->second : nullptr;
+}
 
-            Callable::CallError ce;
+void ClassDB::_build_flat_property_setget(ClassInfo &p_class) {
+    p_class.flat_property_setget.clear();
+    // walk from the most derived class, emplace never overwrites so overridden properties resolve to the derived entry
+    for (ClassInfo *check = &p_class; check; check = check->inherits_ptr) {
+        for (eastl::pair<const StringName, PropertySetGet> &E : check->property_setget) {
+            p_class.flat_property_setget.emplace(E.first, &E.second);
+        }
+    }
+}
 
-            if (psg.index >= 0) {
-                Variant index = psg.index;
-                const Variant *arg[2] = { &index, &p_value };
-                // p_object->call(psg.setter,arg,2,ce);
-                if (psg._setptr) {
-                    psg._setptr->call(p_object, arg, 2, ce);
-                } else {
-                    p_object->call(psg.setter, arg, 2, ce);
-                }
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+    auto iter = classes.find(p_class);
+    return _find_property_setget(iter != classes.end() ? &iter->second : nullptr, p_property);
+}
 
-            } else {
-                const Variant *arg[1] = { &p_value };
-                if (psg._setptr) {
-                    psg._setptr->call(p_object, arg, 1, ce);
-                } else {
-                    p_object->call(psg.setter, arg, 1, ce);
-                }
-            }
+bool ClassDB::set_property_with(Object *p_object, const PropertySetGet &psg, const Variant &p_value, bool *r_valid) {
+    if (!psg.setter) {
+        if (r_valid) {
+            *r_valid = false;
+        }
+        return true; // return true but do nothing
+    }
 
-            if (r_valid) {
-                *r_valid = ce.error == Callable::CallError::CALL_OK;
-            }
+    Callable::CallError ce;
 
-            return true;
+    if (psg.index >= 0) {
+        Variant index = psg.index;
+        const Variant *arg[2] = { &index, &p_value };
+        // p_object->call(psg.setter,arg,2,ce);
+        if (psg._setptr) {
+            psg._setptr->call(p_object, arg, 2, ce);
+        } else {
+            p_object->call(psg.setter, arg, 2, ce);
         }
 
-        check = check->inherits_ptr;
+    } else {
+        const Variant *arg[1] = { &p_value };
+        if (psg._setptr) {
+            psg._setptr->call(p_object, arg, 1, ce);
+        } else {
+            p_object->call(psg.setter, arg, 1, ce);
+        }
     }
 
-    return false;
+    if (r_valid) {
+        *r_valid = ce.error == Callable::CallError::CALL_OK;
+    }
+
+    return true;
+}
+
+bool ClassDB::get_property_with(Object *p_object, const PropertySetGet &psg, Variant &r_value) {
+    if (!psg.getter) {
+        return true; // return true but do nothing
+    }
+
+    if (psg.index >= 0) {
+        Variant index = psg.index;
+        const Variant *arg[1] = { &index };
+        Callable::CallError ce;
+        r_value = p_object->call(psg.getter, arg, 1, ce);
+
+    } else {
+        Callable::CallError ce;
+        if (psg._getptr) {
+            r_value = psg._getptr->call(p_object, nullptr, 0, ce);
+        } else {
+            r_value = p_object->call(psg.getter, nullptr, 0, ce);
+        }
+    }
+    return true;
+}
+
+bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
+    const PropertySetGet *psg = get_property_setget(p_object->get_class_name(), p_property);
+    if (!psg) {
+        return false;
+    }
+    return set_property_with(p_object, *psg, p_value, r_valid);
+}
+
+bool ClassDB::get_property_setter_bind(const StringName &p_class, const StringName &p_property, PropertySetterBind &r_bind) {
+    const PropertySetGet *psg = get_property_setget(p_class, p_property);
+    if (!psg || !psg->setter || !psg->_setptr) {
+        return false;
+    }
+    r_bind.setter = psg->_setptr;
+    r_bind.index = psg->index;
+    return true;
 }
+
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
     auto iter = classes.find(p_object->get_class_name());
     ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter2 = check->property_setget.find(p_property);
-        if (iter2 != check->property_setget.end()) {
-            const PropertySetGet &psg(iter2->second);
-            if (!psg.getter) {
-                return true; // return true but do nothing
-            }
 
-            if (psg.index >= 0) {
-                Variant index = psg.index;
-                const Variant *arg[1] = { &index };
-                Callable::CallError ce;
-                r_value = p_object->call(psg.getter, arg, 1, ce);
+    const PropertySetGet *psg = _find_property_setget(type, p_property);
+    if (psg) {
+        return get_property_with(p_object, *psg, r_value);
+    }
 
-            } else {
-                Callable::CallError ce;
-                if (psg._getptr) {
-                    r_value = psg._getptr->call(p_object, nullptr, 0, ce);
-                } else {
-                    r_value = p_object->call(psg.getter, nullptr, 0, ce);
-                }
-            }
-            return true;
-        }
+    ClassInfo *check = type;
+    while (check) {
         auto iter = check->constant_map.find(p_property);
         if (iter != check->constant_map.end()) {
             r_value = iter->second;
@@ -933,105 +1006,43 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
-    auto iter = classes.find(p_class);
-    ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter2 = check->property_setget.find(p_property);
-        if (iter2 != check->property_setget.end()) {
-            const PropertySetGet &psg(iter2->second);
-            if (r_is_valid) {
-                *r_is_valid = true;
-            }
-
-            return psg.index;
-        }
-
-        check = check->inherits_ptr;
-    }
+    const PropertySetGet *psg = get_property_setget(p_class, p_property);
     if (r_is_valid) {
-        *r_is_valid = false;
+        *r_is_valid = psg != nullptr;
     }
 
-    return -1;
+    return psg ? psg->index : -1;
 }
 
 VariantType ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
-    auto iter = classes.find(p_class);
-    ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter2 = check->property_setget.find(p_property);
-        if (iter2 != check->property_setget.end()) {
-            const PropertySetGet &psg(iter2->second);
-
-            if (r_is_valid) {
-                *r_is_valid = true;
-            }
-
-            return psg.type;
-        }
-
-        check = check->inherits_ptr;
-    }
+    const PropertySetGet *psg = get_property_setget(p_class, p_property);
     if (r_is_valid) {
-        *r_is_valid = false;
+        *r_is_valid = psg != nullptr;
     }
 
-    return VariantType::NIL;
+    return psg ? psg->type : VariantType::NIL;
 }
 
 StringName ClassDB::get_property_setter(StringName p_class, const StringName &p_property) {
-    auto iter = classes.find(p_class);
-    ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter2 = check->property_setget.find(p_property);
-        if (iter2 != check->property_setget.end()) {
-            const PropertySetGet &psg(iter2->second);
-
-            return psg.setter;
-        }
-
-        check = check->inherits_ptr;
-    }
-
-    return StringName();
+    const PropertySetGet *psg = get_property_setget(p_class, p_property);
+    return psg ? psg->setter : StringName();
 }
 
 StringName ClassDB::get_property_getter(StringName p_class, const StringName &p_property) {
-    auto iter = classes.find(p_class);
-    ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        auto iter2 = check->property_setget.find(p_property);
-        if (iter2 != check->property_setget.end()) {
-            const PropertySetGet &psg(iter2->second);
-            return psg.getter;
-        }
-
-        check = check->inherits_ptr;
-    }
-
-    return StringName();
+    const PropertySetGet *psg = get_property_setget(p_class, p_property);
+    return psg ? psg->getter : StringName();
 }
 
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
     auto iter = classes.find(p_class);
     ClassInfo *type = iter != classes.end() ? &iter->second : nullptr;
-    ClassInfo *check = type;
-    while (check) {
-        if (check->property_setget.contains(p_property)) {
-            return true;
-        }
-
-        if (p_no_inheritance) {
-            break;
-        }
-        check = check->inherits_ptr;
+    if (!type) {
+        return false;
     }
-
-    return false;
+    if (p_no_inheritance) {
+        return type->property_setget.contains(p_property);
+    }
+    return _find_property_setget(type, p_property) != nullptr;
 }
 
 void ClassDB::set_method_flags(StringName p_class, StringName p_method, int p_flags) {
@@ -120,6 +120,12 @@ public:
         int index;
         VariantType type;
     };
+    //! Resolved property setter, used by callers that want to skip the per-call property lookup.
+    struct PropertySetterBind {
+        MethodBind *setter = nullptr;
+        int index = -1;
+    };
+    using CreationFunc = Object *(*)();
     struct EnumDescriptor {
         StringName underlying_type;
         Vector<StringName> enumerators;
@@ -142,6 +148,8 @@ public:
         StringName category;
 #endif
         HashMap<StringName, PropertySetGet> property_setget;
+        //! property_setget of this class and all its ancestors, lets lookups skip walking the inheritance chain.
+        HashMap<StringName, const PropertySetGet *> flat_property_setget;
         String usage_header;
 
         StringName inherits;
@@ -149,6 +157,7 @@ public:
         bool disabled=false;
         bool exposed=false;
         bool is_namespace=false;
+        bool has_inheriters=false;
         HashMap<StringName, MethodInfo> &class_signal_map() {return signal_map;}
         Object *(*creation_func)() = nullptr;
 
@@ -183,6 +192,8 @@ public:
     static APIType current_api;
 
     static void _add_class2(const StringName &p_class, const StringName &p_inherits);
+    static const PropertySetGet *_find_property_setget(const ClassInfo *p_class, const StringName &p_property);
+    static void _build_flat_property_setget(ClassInfo &p_class);
 
     static HashMap<StringName, HashMap<StringName, Variant> > default_values;
     static HashSet<StringName> default_values_cached;
@@ -272,6 +283,8 @@ public:
     static bool is_parent_class(const StringName &p_class, const StringName &p_inherits);
     static bool can_instance(const StringName &p_class);
     static Object *instance(const StringName &p_class);
+    //! Returns the function ClassDB::instance would use for p_class, or nullptr when it would fail.
+    static CreationFunc get_creation_func(const StringName &p_class, StringName *r_instanced_class = nullptr);
     static APIType get_api_type(const StringName &p_class);
 
     static uint64_t get_api_hash(APIType p_api);
@@ -288,6 +301,12 @@ public:
     static void get_property_list(StringName p_class, Vector<PropertyInfo> *p_list, bool p_no_inheritance = false, const Object *p_validator = nullptr);
     static bool set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid = nullptr);
     static bool get_property(Object *p_object, const StringName &p_property, Variant &r_value);
+    //! Property table lookups do not lock, class registration must be finished before these are used from other threads.
+    static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+    static bool set_property_with(Object *p_object, const PropertySetGet &p_setget, const Variant &p_value, bool *r_valid = nullptr);
+    static bool get_property_with(Object *p_object, const PropertySetGet &p_setget, Variant &r_value);
+    //! Finds the native setter bound for p_property, returns false if there is none or it has no MethodBind.
+    static bool get_property_setter_bind(const StringName &p_class, const StringName &p_property, PropertySetterBind &r_bind);
     static bool has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance = false);
     static int get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
     static VariantType get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid = nullptr);
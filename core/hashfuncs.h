@@ -106,6 +106,41 @@ static inline uint64_t hash_djb2_buffer64(const uint16_t *p_buff, int p_len, uin
 
     return hash;
 }
+/**
+ * MurmurHash64A (Austin Appleby), consumes 8 bytes per step.
+ * Words are read as little endian, so results are stable across platforms and can be stored in files.
+ * @return 64-bits hashcode
+ */
+static inline uint64_t hash_murmur64a(const uint8_t *p_buff, size_t p_len, uint64_t p_seed = 0x2545F4914F6CDD1DULL) {
+
+    const uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    uint64_t h = p_seed ^ (p_len * m);
+
+    const uint8_t *end = p_buff + (p_len & ~size_t(7));
+    for (; p_buff != end; p_buff += 8) {
+        uint64_t k = 0;
+        for (int i = 0; i < 8; i++)
+            k |= uint64_t(p_buff[i]) << (i * 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    const size_t rest = p_len & 7;
+    if (rest) {
+        for (size_t i = 0; i < rest; i++)
+            h ^= uint64_t(p_buff[i]) << (i * 8);
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
 static inline uint32_t hash_djb2_one_32(uint32_t p_in, uint32_t p_prev = 5381) {
 
     return ((p_prev << 5) + p_prev) + p_in;
@@ -280,6 +280,9 @@ Error Image::compress_image(Image *img, CompressParams p) {
     ERR_FAIL_COND_V(s_codecs.at(int(p.mode)) == nullptr, ERR_UNAVAILABLE);
     return s_codecs.at(int(p.mode))->compress_image(img, p);
 }
+bool Image::can_compress(ImageCompressMode p_mode) {
+    return s_codecs.at(int(p_mode)) != nullptr;
+}
 Error Image::decompress_image(Image *img, CompressParams p) {
     ERR_FAIL_COND_V(s_codecs.at(int(p.mode)) == nullptr, FAILED);
     return s_codecs.at(int(p.mode))->decompress_image(img);
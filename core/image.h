@@ -88,6 +88,8 @@ public:
     };
     //some functions provided by something else
     static Error compress_image(Image *,CompressParams p);
+    //! True if a codec able to compress to p_mode is loaded.
+    static bool can_compress(ImageCompressMode p_mode);
     static Error decompress_image(Image *,CompressParams p);
 
     static Vector<uint8_t> lossy_packer(const Ref<Image> &p_image, float p_quality);
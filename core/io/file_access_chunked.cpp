@@ -0,0 +1,399 @@
+/*************************************************************************/
+/*  file_access_chunked.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "file_access_chunked.h"
+
+#include "core/error_macros.h"
+#include "core/io/compression.h"
+#include "core/io/marshalls.h"
+#include "core/os/thread_work_pool.h"
+
+#include <zstd.h>
+
+#include <atomic>
+#include <cstring>
+
+namespace {
+// Decompression contexts are reused per thread, pool workers decompress blocks for many files.
+struct DCtxHolder {
+    ZSTD_DCtx *ctx = nullptr;
+    ZSTD_DCtx *get() {
+        if (!ctx) {
+            ctx = ZSTD_createDCtx();
+        }
+        return ctx;
+    }
+    ~DCtxHolder() {
+        if (ctx) {
+            ZSTD_freeDCtx(ctx);
+        }
+    }
+};
+thread_local DCtxHolder tl_dctx;
+
+const uint32_t CHUNKED_HEADER_SIZE = 20;
+} // end of anonymous namespace
+
+struct FileAccessChunked::ParallelRead {
+    const uint8_t *src; // compressed data of first_block
+    uint8_t *dst; // uncompressed data of first_block
+    uint32_t first_block;
+    std::atomic<bool> failed { false };
+};
+
+Error FileAccessChunked::write_blob(FileAccess *p_dst, FileAccess *p_src, uint64_t p_size, uint32_t p_block_size, const ZSTD_CDict_s *p_dictionary, uint64_t *r_blob_size) {
+
+    ERR_FAIL_COND_V(p_block_size == 0, ERR_INVALID_PARAMETER);
+
+    const uint64_t start = p_dst->get_position();
+    const uint32_t count = uint32_t((p_size + p_block_size - 1) / p_block_size);
+
+    p_dst->store_32(CHUNKED_FILE_MAGIC);
+    p_dst->store_32(p_block_size);
+    p_dst->store_64(p_size);
+    p_dst->store_32(count);
+    const uint64_t table_pos = p_dst->get_position();
+    for (uint32_t i = 0; i <= count; i++) {
+        p_dst->store_64(0);
+    }
+
+    Vector<uint64_t> offsets;
+    offsets.reserve(count + 1);
+    Vector<uint8_t> raw;
+    raw.resize(p_block_size);
+    Vector<uint8_t> comp;
+    comp.resize(ZSTD_compressBound(p_block_size));
+    ZSTD_CCtx *cctx = ZSTD_createCCtx();
+
+    Error err = OK;
+    uint64_t left = p_size;
+    for (uint32_t i = 0; i < count; i++) {
+        offsets.push_back(p_dst->get_position() - start);
+        const uint32_t n = uint32_t(MIN(left, uint64_t(p_block_size)));
+        if (p_src->get_buffer(raw.data(), n) != int(n)) {
+            err = ERR_FILE_CORRUPT;
+            break;
+        }
+        size_t csize;
+        if (p_dictionary) {
+            csize = ZSTD_compress_usingCDict(cctx, comp.data(), comp.size(), raw.data(), n, p_dictionary);
+        } else {
+            csize = ZSTD_compressCCtx(cctx, comp.data(), comp.size(), raw.data(), n, Compression::zstd_level);
+        }
+        if (ZSTD_isError(csize) || csize >= n) {
+            p_dst->store_buffer(raw.data(), n);
+        } else {
+            p_dst->store_buffer(comp.data(), csize);
+        }
+        left -= n;
+    }
+    ZSTD_freeCCtx(cctx);
+    ERR_FAIL_COND_V_MSG(err != OK, err, "Source file ended before its expected size.");
+
+    const uint64_t end = p_dst->get_position();
+    offsets.push_back(end - start);
+    p_dst->seek(table_pos);
+    for (uint64_t ofs : offsets) {
+        p_dst->store_64(ofs);
+    }
+    p_dst->seek(end);
+
+    if (r_blob_size) {
+        *r_blob_size = end - start;
+    }
+    return OK;
+}
+
+Error FileAccessChunked::open_blob(const uint8_t *p_mapped, FileAccess *p_container, uint64_t p_blob_offset, uint64_t p_blob_size, const ZSTD_DDict_s *p_dictionary) {
+
+    close();
+    mapped = p_mapped;
+    f = p_container;
+    blob_offset = p_blob_offset;
+    dictionary = p_dictionary;
+    ERR_FAIL_COND_V(!mapped && !f, ERR_INVALID_PARAMETER);
+    ERR_FAIL_COND_V(p_blob_size < CHUNKED_HEADER_SIZE + 8, ERR_FILE_CORRUPT);
+
+    uint8_t header[CHUNKED_HEADER_SIZE];
+    if (mapped) {
+        memcpy(header, mapped, CHUNKED_HEADER_SIZE);
+    } else {
+        f->seek(blob_offset);
+        ERR_FAIL_COND_V(f->get_buffer(header, CHUNKED_HEADER_SIZE) != int(CHUNKED_HEADER_SIZE), ERR_FILE_CORRUPT);
+    }
+    ERR_FAIL_COND_V(decode_uint32(header) != CHUNKED_FILE_MAGIC, ERR_FILE_UNRECOGNIZED);
+    block_size = decode_uint32(header + 4);
+    total_size = decode_uint64(header + 8);
+    block_count = decode_uint32(header + 16);
+    ERR_FAIL_COND_V(block_size == 0 || block_count != (total_size + block_size - 1) / block_size, ERR_FILE_CORRUPT);
+
+    const uint64_t table_size = uint64_t(block_count + 1) * 8;
+    ERR_FAIL_COND_V(CHUNKED_HEADER_SIZE + table_size > p_blob_size, ERR_FILE_CORRUPT);
+    block_offsets.resize(block_count + 1);
+    if (mapped) {
+        const uint8_t *table = mapped + CHUNKED_HEADER_SIZE;
+        for (uint32_t i = 0; i <= block_count; i++) {
+            block_offsets[i] = decode_uint64(table + i * 8);
+        }
+    } else {
+        for (uint32_t i = 0; i <= block_count; i++) {
+            block_offsets[i] = f->get_64();
+        }
+    }
+    ERR_FAIL_COND_V(block_offsets[block_count] > p_blob_size, ERR_FILE_CORRUPT);
+    for (uint32_t i = 0; i < block_count; i++) {
+        ERR_FAIL_COND_V(block_offsets[i] > block_offsets[i + 1], ERR_FILE_CORRUPT);
+    }
+
+    pos = 0;
+    eof = false;
+    cached_block = -1;
+    return OK;
+}
+
+uint32_t FileAccessChunked::_block_raw_size(uint32_t p_block) const {
+
+    const uint64_t start = uint64_t(p_block) * block_size;
+    return uint32_t(MIN(uint64_t(block_size), total_size - start));
+}
+
+const uint8_t *FileAccessChunked::_get_compressed(uint32_t p_first, uint32_t p_last) const {
+
+    const uint64_t from = block_offsets[p_first];
+    const uint64_t size = block_offsets[p_last + 1] - from;
+    if (mapped) {
+        return mapped + from;
+    }
+    // blocks are stored back to back, a run of them is fetched with a single read.
+    comp_buffer.resize(size);
+    f->seek(blob_offset + from);
+    if (f->get_buffer(comp_buffer.data(), size) != int(size)) {
+        return nullptr;
+    }
+    return comp_buffer.data();
+}
+
+bool FileAccessChunked::_decompress_block(uint32_t p_block, const uint8_t *p_src, uint8_t *p_dst) const {
+
+    const size_t csize = block_offsets[p_block + 1] - block_offsets[p_block];
+    const size_t raw_size = _block_raw_size(p_block);
+    if (csize == raw_size) {
+        memcpy(p_dst, p_src, raw_size);
+        return true;
+    }
+
+    ZSTD_DCtx *dctx = tl_dctx.get();
+    size_t ret;
+    if (dictionary) {
+        ret = ZSTD_decompress_usingDDict(dctx, p_dst, raw_size, p_src, csize, dictionary);
+    } else {
+        ret = ZSTD_decompressDCtx(dctx, p_dst, raw_size, p_src, csize);
+    }
+    ERR_FAIL_COND_V_MSG(ret != raw_size, false, "Corrupt compressed block in packed file.");
+    return true;
+}
+
+void FileAccessChunked::_decompress_run_work(uint32_t p_index, ParallelRead *p_read) const {
+
+    const uint32_t block = p_read->first_block + p_index;
+    const uint8_t *src = p_read->src + (block_offsets[block] - block_offsets[p_read->first_block]);
+    uint8_t *dst = p_read->dst + uint64_t(p_index) * block_size;
+    if (!_decompress_block(block, src, dst)) {
+        p_read->failed.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool FileAccessChunked::_decompress_run(uint32_t p_first, uint32_t p_last, uint8_t *p_dst) const {
+
+    const uint8_t *src = _get_compressed(p_first, p_last);
+    if (!src) {
+        return false;
+    }
+    if (p_first == p_last) {
+        return _decompress_block(p_first, src, p_dst);
+    }
+    ParallelRead read;
+    read.src = src;
+    read.dst = p_dst;
+    read.first_block = p_first;
+    ThreadWorkPool::get_singleton()->do_work(p_last - p_first + 1, this, &FileAccessChunked::_decompress_run_work, &read);
+    return !read.failed.load(std::memory_order_relaxed);
+}
+
+bool FileAccessChunked::_cache_block(uint32_t p_block) const {
+
+    if (cached_block == int64_t(p_block)) {
+        return true;
+    }
+    cached_block = -1;
+    block_cache.resize(block_size);
+    const uint8_t *src = _get_compressed(p_block, p_block);
+    if (!src || !_decompress_block(p_block, src, block_cache.data())) {
+        return false;
+    }
+    cached_block = p_block;
+    return true;
+}
+
+Error FileAccessChunked::_open(StringView p_path, int p_mode_flags) {
+
+    ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Chunked files are only opened through their pack.");
+}
+
+void FileAccessChunked::close() {
+
+    if (f) {
+        memdelete(f);
+        f = nullptr;
+    }
+    mapped = nullptr;
+    block_offsets.clear();
+    block_cache.clear();
+    comp_buffer.clear();
+    cached_block = -1;
+}
+
+bool FileAccessChunked::is_open() const {
+
+    return mapped || f;
+}
+
+void FileAccessChunked::seek(size_t p_position) {
+
+    eof = p_position > total_size;
+    pos = p_position;
+}
+
+void FileAccessChunked::seek_end(int64_t p_position) {
+
+    seek(total_size + p_position);
+}
+
+size_t FileAccessChunked::get_position() const {
+
+    return pos;
+}
+
+size_t FileAccessChunked::get_len() const {
+
+    return total_size;
+}
+
+bool FileAccessChunked::eof_reached() const {
+
+    return eof;
+}
+
+uint8_t FileAccessChunked::get_8() const {
+
+    if (pos >= total_size) {
+        eof = true;
+        return 0;
+    }
+    if (!_cache_block(pos / block_size)) {
+        eof = true;
+        return 0;
+    }
+    return block_cache[pos++ % block_size];
+}
+
+int FileAccessChunked::get_buffer(uint8_t *p_dst, int p_length) const {
+
+    ERR_FAIL_COND_V(p_length < 0, -1);
+    if (pos >= total_size) {
+        eof = true;
+        return 0;
+    }
+    uint64_t to_read = p_length;
+    if (pos + to_read > total_size) {
+        eof = true;
+        to_read = total_size - pos;
+    }
+
+    uint64_t done = 0;
+    while (done < to_read) {
+        const uint64_t at = pos + done;
+        const uint32_t block = uint32_t(at / block_size);
+        const uint64_t in_block = at % block_size;
+        const uint64_t left = to_read - done;
+        const uint32_t raw_size = _block_raw_size(block);
+
+        if (in_block == 0 && left >= raw_size && cached_block != int64_t(block)) {
+            // whole blocks go straight to the destination, without passing through the cache.
+            uint32_t last = block;
+            uint64_t run = raw_size;
+            while (last + 1 < block_count && run + _block_raw_size(last + 1) <= left) {
+                last++;
+                run += _block_raw_size(last);
+            }
+            if (!_decompress_run(block, last, p_dst + done)) {
+                eof = true;
+                break;
+            }
+            done += run;
+            continue;
+        }
+
+        if (!_cache_block(block)) {
+            eof = true;
+            break;
+        }
+        const uint64_t n = MIN(uint64_t(raw_size) - in_block, left);
+        memcpy(p_dst + done, block_cache.data() + in_block, n);
+        done += n;
+    }
+    pos += done;
+    return int(done);
+}
+
+Error FileAccessChunked::get_error() const {
+
+    return eof ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessChunked::flush() {
+
+    ERR_FAIL();
+}
+
+void FileAccessChunked::store_8(uint8_t p_dest) {
+
+    ERR_FAIL();
+}
+
+void FileAccessChunked::store_buffer(const uint8_t *p_src, int p_length) {
+
+    ERR_FAIL();
+}
+
+FileAccessChunked::~FileAccessChunked() {
+    close();
+}
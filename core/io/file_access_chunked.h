@@ -0,0 +1,116 @@
+/*************************************************************************/
+/*  file_access_chunked.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#pragma once
+
+#include "core/os/file_access.h"
+#include "core/vector.h"
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+// "GDCZ" in ASCII, starts every chunked file blob.
+#define CHUNKED_FILE_MAGIC 0x5a434447
+
+/// Read-only access to a file stored as independently zstd compressed blocks, the form PCKPacker uses for
+/// compressed packs.
+/// Blob layout: magic, block size (32 bits), uncompressed size (64 bits), block count (32 bits), then block count + 1
+/// offsets (64 bits, relative to the blob start) delimiting the compressed blocks. A block whose stored size equals its
+/// uncompressed size was not compressible and is kept as is.
+/// Reads only decompress the blocks they touch, runs of whole blocks are decompressed in parallel on the ThreadWorkPool.
+class GODOT_EXPORT FileAccessChunked : public FileAccess {
+
+    struct ParallelRead;
+
+    const uint8_t *mapped = nullptr; // blob start, when the container is memory mapped
+    FileAccess *f = nullptr; // container file otherwise, owned
+    uint64_t blob_offset = 0;
+    const ZSTD_DDict_s *dictionary = nullptr;
+
+    Vector<uint64_t> block_offsets;
+    uint64_t total_size = 0;
+    uint32_t block_size = 0;
+    uint32_t block_count = 0;
+
+    mutable Vector<uint8_t> block_cache;
+    mutable Vector<uint8_t> comp_buffer;
+    mutable int64_t cached_block = -1;
+    mutable uint64_t pos = 0;
+    mutable bool eof = false;
+
+    uint32_t _block_raw_size(uint32_t p_block) const;
+    const uint8_t *_get_compressed(uint32_t p_first, uint32_t p_last) const;
+    bool _decompress_block(uint32_t p_block, const uint8_t *p_src, uint8_t *p_dst) const;
+    bool _decompress_run(uint32_t p_first, uint32_t p_last, uint8_t *p_dst) const;
+    void _decompress_run_work(uint32_t p_index, ParallelRead *p_read) const;
+    bool _cache_block(uint32_t p_block) const;
+
+    Error _open(StringView p_path, int p_mode_flags) override;
+    uint64_t _get_modified_time(StringView p_file) override { return 0; }
+    uint32_t _get_unix_permissions(StringView p_file) override { return 0; }
+    Error _set_unix_permissions(StringView p_file, uint32_t p_permissions) override { return FAILED; }
+
+public:
+    enum {
+        DEFAULT_BLOCK_SIZE = 65536,
+    };
+
+    //! Compresses p_size bytes read from p_src into a blob written at the current position of p_dst.
+    static Error write_blob(FileAccess *p_dst, FileAccess *p_src, uint64_t p_size, uint32_t p_block_size, const ZSTD_CDict_s *p_dictionary, uint64_t *r_blob_size);
+
+    //! Reads the blob from p_mapped when the container is memory mapped, otherwise from p_container at p_blob_offset,
+    //! taking ownership of p_container. p_dictionary has to outlive this file access.
+    Error open_blob(const uint8_t *p_mapped, FileAccess *p_container, uint64_t p_blob_offset, uint64_t p_blob_size, const ZSTD_DDict_s *p_dictionary);
+
+    void close() override;
+    bool is_open() const override;
+
+    void seek(size_t p_position) override;
+    void seek_end(int64_t p_position = 0) override;
+    size_t get_position() const override;
+    size_t get_len() const override;
+
+    bool eof_reached() const override;
+
+    uint8_t get_8() const override;
+    int get_buffer(uint8_t *p_dst, int p_length) const override;
+
+    Error get_error() const override;
+
+    void flush() override;
+    void store_8(uint8_t p_dest) override;
+    void store_buffer(const uint8_t *p_src, int p_length) override;
+
+    bool file_exists(StringView p_name) override { return false; }
+
+    FileAccessChunked() = default;
+    ~FileAccessChunked() override;
+};
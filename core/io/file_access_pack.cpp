@@ -32,6 +32,8 @@
 
 #include "core/version.h"
 
+#include "EASTL/sort.h"
+
 #include <cstdio>
 
 Error PackedData::add_pack(StringView p_path, bool p_replace_files, StringView p_destination) {
@@ -47,12 +49,66 @@ Error PackedData::add_pack(StringView p_path, bool p_replace_files, StringView p
     return ERR_FILE_UNRECOGNIZED;
 }
 
+void PackedData::_grow_file_slots(uint32_t p_min_entries) {
+
+    // keep the load factor at or below one half, probes stay short.
+    uint32_t capacity = 16;
+    while (capacity < p_min_entries * 2)
+        capacity <<= 1;
+    if (capacity <= file_slots.size())
+        return;
+
+    file_slots.clear();
+    file_slots.resize(capacity, FileSlot { 0, 0 });
+    slot_mask = capacity - 1;
+    for (uint32_t i = 0; i < file_entries.size(); i++) {
+        uint32_t slot = file_entries[i].path_hash & slot_mask;
+        while (file_slots[slot].index != 0)
+            slot = (slot + 1) & slot_mask;
+        file_slots[slot] = FileSlot { file_entries[i].path_hash, i + 1 };
+    }
+}
+
+PackedDataFile *PackedData::_find_file(uint64_t p_hash) {
+
+    if (file_slots.empty())
+        return nullptr;
+    uint32_t slot = p_hash & slot_mask;
+    while (file_slots[slot].index != 0) {
+        if (file_slots[slot].hash == p_hash)
+            return &file_entries[file_slots[slot].index - 1];
+        slot = (slot + 1) & slot_mask;
+    }
+    return nullptr;
+}
+
+void PackedData::_add_file(uint64_t p_hash, const PackedDataFile &p_file, bool p_replace_files, bool &r_existed) {
+
+    PackedDataFile *existing = _find_file(p_hash);
+    r_existed = existing != nullptr;
+    if (existing) {
+        if (p_replace_files)
+            *existing = p_file;
+        return;
+    }
+
+    _grow_file_slots(file_entries.size() + 1);
+    file_entries.push_back(p_file);
+    uint32_t slot = p_hash & slot_mask;
+    while (file_slots[slot].index != 0)
+        slot = (slot + 1) & slot_mask;
+    file_slots[slot] = FileSlot { p_hash, uint32_t(file_entries.size()) };
+}
+
 void PackedData::add_path(StringView pkg_path, StringView path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSourceInterface *p_src, bool p_replace_files) {
 
-    PathMD5 pmd5(StringUtils::md5_buffer(path));
-    //printf("adding path %ls, %lli, %lli\n", path.c_str(), pmd5.a, pmd5.b);
+    bool exists;
+    add_indexed_path(pkg_path, hash_path(path), ofs, size, p_md5, p_src, p_replace_files, &exists);
+    if (!exists)
+        add_directory_path(path);
+}
 
-    bool exists = files.contains(pmd5);
+void PackedData::add_indexed_path(StringView pkg_path, uint64_t p_path_hash, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSourceInterface *p_src, bool p_replace_files, bool *r_existed) {
 
     PackedDataFile pf;
     pf.pack = pkg_path;
@@ -61,38 +117,60 @@ void PackedData::add_path(StringView pkg_path, StringView path, uint64_t ofs, ui
     for (int i = 0; i < 16; i++)
         pf.md5[i] = p_md5[i];
     pf.src = p_src;
+    pf.path_hash = p_path_hash;
+
+    bool exists;
+    _add_file(p_path_hash, pf, p_replace_files, exists);
+    if (r_existed)
+        *r_existed = exists;
+}
 
-    if (!exists || p_replace_files)
-        files[pmd5] = pf;
+void PackedData::add_directory_path(StringView path) {
 
-    if (!exists) {
-        //search for dir
-        String p = StringUtils::replace_first(path,"res://", "");
-        PackedDir *cd = root;
+    //search for dir
+    String p = StringUtils::replace_first(path,"res://", "");
+    PackedDir *cd = root;
 
-        if (StringUtils::contains(p,'/')) { //in a subdir
+    if (StringUtils::contains(p,'/')) { //in a subdir
 
-            Vector<StringView> ds = StringUtils::split(PathUtils::get_base_dir(p),'/');
+        Vector<StringView> ds = StringUtils::split(PathUtils::get_base_dir(p),'/');
 
-            for (StringView sv : ds) {
-                auto iter =  cd->subdirs.find_as<StringView>(sv);
-                if (iter==cd->subdirs.end()) {
+        for (StringView sv : ds) {
+            auto iter =  cd->subdirs.find_as(sv);
+            if (iter==cd->subdirs.end()) {
 
-                    PackedDir *pd = memnew(PackedDir);
-                    pd->name = sv;
-                    pd->parent = cd;
-                    cd->subdirs[pd->name] = pd;
-                    cd = pd;
-                } else {
-                    cd = iter->second;
-                }
+                PackedDir *pd = memnew(PackedDir);
+                pd->name = sv;
+                pd->parent = cd;
+                cd->subdirs[pd->name] = pd;
+                cd = pd;
+            } else {
+                cd = iter->second;
             }
         }
-        StringView filename = PathUtils::get_file(path);
-        // Don't add as a file if the path points to a directory.
-        if (!filename.empty()) {
-            cd->files.insert(filename);
-        }
+    }
+    StringView filename = PathUtils::get_file(path);
+    // Don't add as a file if the path points to a directory.
+    if (!filename.empty()) {
+        cd->files.insert(String(filename));
+    }
+}
+
+void PackedData::add_deferred_paths(DeferredPathLoader p_loader) {
+
+    MutexLock guard(deferred_paths_mutex);
+    deferred_paths.emplace_back(eastl::move(p_loader));
+}
+
+void PackedData::_ensure_directories() {
+
+    MutexLock guard(deferred_paths_mutex);
+    if (deferred_paths.empty())
+        return;
+    Vector<DeferredPathLoader> loaders(eastl::move(deferred_paths));
+    deferred_paths.clear();
+    for (DeferredPathLoader &loader : loaders) {
+        loader();
     }
 }
 
@@ -160,6 +238,9 @@ Error DirAccessPack::list_dir_begin() {
 
         list_files.emplace_back(E);
     }
+    // the tree is hashed, keep listings in a stable order.
+    eastl::sort(list_dirs.begin(), list_dirs.end());
+    eastl::sort(list_files.begin(), list_files.end());
 
     return OK;
 }
@@ -325,6 +406,7 @@ String DirAccessPack::get_filesystem_type() const {
 
 DirAccessPack::DirAccessPack() {
 
+    PackedData::get_singleton()->_ensure_directories();
     current = PackedData::get_singleton()->root;
     cdir = false;
 }
@@ -30,23 +30,38 @@
 
 #pragma once
 
+#include "core/hash_map.h"
+#include "core/hash_set.h"
+#include "core/hashfuncs.h"
 #include "core/list.h"
 #include "core/map.h"
 #include "core/os/dir_access.h"
+#include "core/os/mutex.h"
 #include "core/os/file_access.h"
 #include "core/string.h"
 #include "core/string_utils.h"
 #include "core/vector.h"
 #include "core/plugin_interfaces/PackSourceInterface.h"
 #include "core/set.h"
-#include "core/vector.h"
 
-#include <cassert>
+#include "EASTL/functional.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
 // The current packed file format version number.
 #define PACK_FORMAT_VERSION 1
+// Set in the first reserved header field when the pack carries a hash index section, its absolute file position is
+// stored as 64 bits in the two following reserved fields.
+// The section holds a 32 bit entry count, followed by the entries sorted by path hash: path hash (PackedData::hash_path),
+// offset and size as 64 bits each, then the 16 byte md5.
+#define PACK_FLAG_HASH_INDEX 1
+// Position of the reserved fields relative to the start of the pack: magic, format version and engine version.
+#define PACK_RESERVED_OFFSET 20
+#define PACK_HASH_INDEX_ENTRY_SIZE 40
+// Set when every file is stored as a FileAccessChunked blob, offsets and sizes in the file table then refer to the blob.
+// The fourth and fifth reserved fields hold the 64 bit position of the shared zstd dictionary, the sixth its size
+// (0 when there is none).
+#define PACK_FLAG_CHUNKED_FILES 2
 
 class PackSourceInterface;
 
@@ -57,6 +72,7 @@ struct PackedDataFile {
     uint64_t size;
     uint8_t md5[16];
     PackSourceInterface *src;
+    uint64_t path_hash;
 };
 
 class GODOT_EXPORT PackedData {
@@ -65,58 +81,57 @@ class GODOT_EXPORT PackedData {
     friend class PackSourceInterface;
 
 public:
+    //! Called once, the first time the directory tree is needed, to feed in the paths of a pack mounted from its index.
+    using DeferredPathLoader = eastl::function<void()>;
 
 private:
     struct PackedDir {
         PackedDir *parent;
         String name;
-        Map<String, PackedDir *> subdirs;
-        Set<String> files;
+        HashMap<String, PackedDir *> subdirs;
+        HashSet<String> files;
     };
 
-    struct PathMD5 {
-        uint64_t a;
-        uint64_t b;
-        bool operator<(PathMD5 p_md5) const {
-
-            if (p_md5.a == a) {
-                return b < p_md5.b;
-            }
-            return a < p_md5.a;
-        }
-
-        bool operator==(PathMD5 p_md5) const {
-            return a == p_md5.a && b == p_md5.b;
-        }
-
-        PathMD5() {
-            a = b = 0;
-        }
-
-        PathMD5(const FixedVector<uint8_t,16,false> &p_buf) {
-            assert(p_buf.size()==16);
-            a = *((uint64_t *)&p_buf[0]);
-            b = *((uint64_t *)&p_buf[8]);
-        }
-
+    // Open addressed table (linear probing) over file_entries, keyed by hash_path.
+    // Packs only ever grow during a run, so there is no deletion and erased files are kept with offset 0.
+    struct FileSlot {
+        uint64_t hash;
+        uint32_t index; // index into file_entries + 1, 0 marks an empty slot
     };
 
-    Map<PathMD5, PackedDataFile> files;
+    Vector<PackedDataFile> file_entries;
+    Vector<FileSlot> file_slots;
+    uint32_t slot_mask = 0;
 
     Vector<PackSourceInterface *> sources;
 
     PackedDir *root;
-    //Map<String,PackedDir*> dirs;
+    Vector<DeferredPathLoader> deferred_paths;
+    Mutex deferred_paths_mutex;
 
     static PackedData *singleton;
     bool disabled;
 
     void _free_packed_dirs(PackedDir *p_dir);
+    void _grow_file_slots(uint32_t p_min_entries);
+    PackedDataFile *_find_file(uint64_t p_hash);
+    void _add_file(uint64_t p_hash, const PackedDataFile &p_file, bool p_replace_files, bool &r_existed);
+    void _ensure_directories();
 
 public:
+    static uint64_t hash_path(StringView p_path) {
+        return hash_murmur64a(reinterpret_cast<const uint8_t *>(p_path.data()), p_path.size());
+    }
+
     void add_pack_source(PackSourceInterface *p_source);
     void remove_pack_source(PackSourceInterface *p_source);
     void add_path(StringView pkg_path, StringView path, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSourceInterface *p_src, bool p_replace_files); // for PackSource
+    //! Registers a file by its precomputed hash_path, as stored in a pack's hash index. Its directory entry has to be
+    //! provided through add_directory_path, usually from a loader passed to add_deferred_paths.
+    void add_indexed_path(StringView pkg_path, uint64_t p_path_hash, uint64_t ofs, uint64_t size, const uint8_t *p_md5, PackSourceInterface *p_src, bool p_replace_files, bool *r_existed = nullptr);
+    void add_directory_path(StringView p_path);
+    void add_deferred_paths(DeferredPathLoader p_loader);
+    void reserve_files(uint32_t p_count) { _grow_file_slots(file_entries.size() + p_count); }
 
     void set_disabled(bool p_disabled) { disabled = p_disabled; }
     _FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -137,19 +152,18 @@ public:
 
 FileAccess *PackedData::try_open_path(StringView p_path) {
 
-    PathMD5 pmd5(StringUtils::md5_buffer(p_path));
-    auto E = files.find(pmd5);
-    if (E==files.end())
+    PackedDataFile *pf = _find_file(hash_path(p_path));
+    if (!pf)
         return nullptr; //not found
-    if (E->second.offset == 0)
+    if (pf->offset == 0)
         return nullptr; //was erased
 
-    return E->second.src->get_file(p_path, &E->second);
+    return pf->src->get_file(p_path, pf);
 }
 
 bool PackedData::has_path(StringView p_path) {
 
-    return files.contains(PathMD5(StringUtils::md5_buffer(p_path)));
+    return _find_file(hash_path(p_path)) != nullptr;
 }
 bool PackedData::has_directory(StringView p_path) {
 
@@ -256,6 +256,329 @@ _FORCE_INLINE_ bool _can_call_mode(Node *p_node, MultiplayerAPI_RPCMode mode, in
 
     return false;
 }
+// Set on the command byte of RPC/RSET packets when the method or property name is replaced by its cached id.
+#define NETWORK_NAME_ID_FLAG 0x80
+
+// Argument encodings used by RPC/RSET packets, each argument starts with one of these.
+enum RPCArgEncoding : uint8_t {
+    RPC_ARG_NIL,
+    RPC_ARG_FALSE,
+    RPC_ARG_TRUE,
+    RPC_ARG_INT, // zigzag varint
+    RPC_ARG_FLOAT32, // a double which survives the round trip through float
+    RPC_ARG_FLOAT64,
+    RPC_ARG_STRING, // varint length + utf8
+    RPC_ARG_VECTOR2,
+    RPC_ARG_VECTOR3,
+    RPC_ARG_POOL_BYTE_ARRAY, // varint count + elements
+    RPC_ARG_POOL_INT_ARRAY, // elements are zigzag varints
+    RPC_ARG_POOL_REAL_ARRAY,
+    RPC_ARG_POOL_VECTOR2_ARRAY,
+    RPC_ARG_POOL_VECTOR3_ARRAY,
+    RPC_ARG_VARIANT, // everything else, encode_variant payload
+};
+
+// Appends to a buffer which only ever grows, so packets are written in a single pass without sizing them first.
+class RPCWriter {
+    Vector<uint8_t> &buffer;
+    int ofs;
+
+public:
+    RPCWriter(Vector<uint8_t> &p_buffer, int p_ofs) : buffer(p_buffer), ofs(p_ofs) {}
+
+    int get_offset() const { return ofs; }
+    //! The returned pointer is only valid until the next write.
+    uint8_t *reserve(int p_bytes) {
+        if (ofs + p_bytes > (int)buffer.size())
+            buffer.resize(M_MAX(ofs + p_bytes, (int)buffer.size() * 2));
+        uint8_t *w = buffer.data() + ofs;
+        ofs += p_bytes;
+        return w;
+    }
+    void put_u8(uint8_t p_val) { *reserve(1) = p_val; }
+    void put_varint(uint64_t p_val) {
+        uint8_t *w = reserve(10);
+        int used = 0;
+        while (p_val >= 0x80) {
+            w[used++] = uint8_t(p_val) | 0x80;
+            p_val >>= 7;
+        }
+        w[used++] = uint8_t(p_val);
+        ofs -= 10 - used;
+    }
+    void put_zigzag(int64_t p_val) { put_varint((uint64_t(p_val) << 1) ^ uint64_t(p_val >> 63)); }
+    void put_float(float p_val) { encode_float(p_val, reserve(4)); }
+    void put_bytes(const uint8_t *p_data, int p_len) {
+        if (p_len > 0)
+            memcpy(reserve(p_len), p_data, p_len);
+    }
+};
+
+class RPCReader {
+    const uint8_t *data;
+    int len;
+    int ofs;
+
+public:
+    RPCReader(const uint8_t *p_data, int p_len, int p_ofs) : data(p_data), len(p_len), ofs(p_ofs) {}
+
+    int get_offset() const { return ofs; }
+    int get_remaining() const { return len - ofs; }
+    //! Returns nullptr when the packet is too short.
+    const uint8_t *take(int p_bytes) {
+        if (p_bytes < 0 || p_bytes > len - ofs)
+            return nullptr;
+        const uint8_t *r = data + ofs;
+        ofs += p_bytes;
+        return r;
+    }
+    bool get_varint(uint64_t &r_val) {
+        r_val = 0;
+        for (int shift = 0; shift < 64 && ofs < len; shift += 7) {
+            uint8_t b = data[ofs++];
+            r_val |= uint64_t(b & 0x7F) << shift;
+            if (!(b & 0x80))
+                return true;
+        }
+        return false;
+    }
+    bool get_zigzag(int64_t &r_val) {
+        uint64_t v;
+        if (!get_varint(v))
+            return false;
+        r_val = int64_t(v >> 1) ^ -int64_t(v & 1);
+        return true;
+    }
+    bool get_count(int p_elem_size, int &r_count) {
+        uint64_t count;
+        if (!get_varint(count) || count > uint64_t(len - ofs) / M_MAX(p_elem_size, 1))
+            return false;
+        r_count = int(count);
+        return true;
+    }
+};
+
+template <class T, class F>
+void _put_pool_array(RPCWriter &w, uint8_t p_encoding, const PoolVector<T> &p_array, F p_put) {
+    w.put_u8(p_encoding);
+    w.put_varint(p_array.size());
+    typename PoolVector<T>::Read r = p_array.read();
+    for (int i = 0; i < p_array.size(); i++) {
+        p_put(r[i]);
+    }
+}
+
+Error _encode_rpc_arg(RPCWriter &w, const Variant &p_value, bool p_full_objects) {
+    switch (p_value.get_type()) {
+        case VariantType::NIL: {
+            w.put_u8(RPC_ARG_NIL);
+        } break;
+        case VariantType::BOOL: {
+            w.put_u8(p_value.as<bool>() ? RPC_ARG_TRUE : RPC_ARG_FALSE);
+        } break;
+        case VariantType::INT: {
+            w.put_u8(RPC_ARG_INT);
+            w.put_zigzag(p_value.as<int64_t>());
+        } break;
+        case VariantType::FLOAT: {
+            double d = p_value.as<double>();
+            float f = float(d);
+            if (double(f) == d || d != d) {
+                w.put_u8(RPC_ARG_FLOAT32);
+                w.put_float(f);
+            } else {
+                w.put_u8(RPC_ARG_FLOAT64);
+                encode_double(d, w.reserve(8));
+            }
+        } break;
+        case VariantType::STRING: {
+            String str = p_value.as<String>();
+            w.put_u8(RPC_ARG_STRING);
+            w.put_varint(str.size());
+            w.put_bytes((const uint8_t *)str.data(), str.size());
+        } break;
+        case VariantType::VECTOR2: {
+            Vector2 v = p_value.as<Vector2>();
+            w.put_u8(RPC_ARG_VECTOR2);
+            w.put_float(v.x);
+            w.put_float(v.y);
+        } break;
+        case VariantType::VECTOR3: {
+            Vector3 v = p_value.as<Vector3>();
+            w.put_u8(RPC_ARG_VECTOR3);
+            w.put_float(v.x);
+            w.put_float(v.y);
+            w.put_float(v.z);
+        } break;
+        case VariantType::POOL_BYTE_ARRAY: {
+            PoolVector<uint8_t> arr = p_value.as<PoolVector<uint8_t>>();
+            w.put_u8(RPC_ARG_POOL_BYTE_ARRAY);
+            w.put_varint(arr.size());
+            w.put_bytes(arr.read().ptr(), arr.size());
+        } break;
+        case VariantType::POOL_INT_ARRAY: {
+            _put_pool_array(w, RPC_ARG_POOL_INT_ARRAY, p_value.as<PoolVector<int>>(), [&w](int v) { w.put_zigzag(v); });
+        } break;
+        case VariantType::POOL_REAL_ARRAY: {
+            _put_pool_array(w, RPC_ARG_POOL_REAL_ARRAY, p_value.as<PoolVector<real_t>>(), [&w](real_t v) { w.put_float(v); });
+        } break;
+        case VariantType::POOL_VECTOR2_ARRAY: {
+            _put_pool_array(w, RPC_ARG_POOL_VECTOR2_ARRAY, p_value.as<PoolVector<Vector2>>(), [&w](const Vector2 &v) {
+                w.put_float(v.x);
+                w.put_float(v.y);
+            });
+        } break;
+        case VariantType::POOL_VECTOR3_ARRAY: {
+            _put_pool_array(w, RPC_ARG_POOL_VECTOR3_ARRAY, p_value.as<PoolVector<Vector3>>(), [&w](const Vector3 &v) {
+                w.put_float(v.x);
+                w.put_float(v.y);
+                w.put_float(v.z);
+            });
+        } break;
+        default: {
+            int len;
+            Error err = encode_variant(p_value, nullptr, len, p_full_objects);
+            if (err != OK)
+                return err;
+            w.put_u8(RPC_ARG_VARIANT);
+            encode_variant(p_value, w.reserve(len), len, p_full_objects);
+        } break;
+    }
+    return OK;
+}
+
+Error _decode_rpc_arg(RPCReader &r, Variant &r_value, bool p_allow_objects) {
+    const uint8_t *enc = r.take(1);
+    if (!enc)
+        return ERR_INVALID_DATA;
+
+    switch (*enc) {
+        case RPC_ARG_NIL: {
+            r_value = Variant();
+        } break;
+        case RPC_ARG_FALSE:
+        case RPC_ARG_TRUE: {
+            r_value = *enc == RPC_ARG_TRUE;
+        } break;
+        case RPC_ARG_INT: {
+            int64_t v;
+            if (!r.get_zigzag(v))
+                return ERR_INVALID_DATA;
+            r_value = v;
+        } break;
+        case RPC_ARG_FLOAT32: {
+            const uint8_t *d = r.take(4);
+            if (!d)
+                return ERR_INVALID_DATA;
+            r_value = decode_float(d);
+        } break;
+        case RPC_ARG_FLOAT64: {
+            const uint8_t *d = r.take(8);
+            if (!d)
+                return ERR_INVALID_DATA;
+            r_value = decode_double(d);
+        } break;
+        case RPC_ARG_STRING: {
+            int len;
+            const uint8_t *d;
+            if (!r.get_count(1, len) || !(d = r.take(len)))
+                return ERR_INVALID_DATA;
+            r_value = String((const char *)d, len);
+        } break;
+        case RPC_ARG_VECTOR2: {
+            const uint8_t *d = r.take(8);
+            if (!d)
+                return ERR_INVALID_DATA;
+            r_value = Vector2(decode_float(d), decode_float(d + 4));
+        } break;
+        case RPC_ARG_VECTOR3: {
+            const uint8_t *d = r.take(12);
+            if (!d)
+                return ERR_INVALID_DATA;
+            r_value = Vector3(decode_float(d), decode_float(d + 4), decode_float(d + 8));
+        } break;
+        case RPC_ARG_POOL_BYTE_ARRAY: {
+            int count;
+            const uint8_t *d;
+            if (!r.get_count(1, count) || !(d = r.take(count)))
+                return ERR_INVALID_DATA;
+            PoolVector<uint8_t> arr;
+            arr.resize(count);
+            if (count)
+                memcpy(arr.write().ptr(), d, count);
+            r_value = arr;
+        } break;
+        case RPC_ARG_POOL_INT_ARRAY: {
+            int count;
+            if (!r.get_count(1, count))
+                return ERR_INVALID_DATA;
+            PoolVector<int> arr;
+            arr.resize(count);
+            PoolVector<int>::Write w = arr.write();
+            for (int i = 0; i < count; i++) {
+                int64_t v;
+                if (!r.get_zigzag(v))
+                    return ERR_INVALID_DATA;
+                w[i] = int(v);
+            }
+            w.release();
+            r_value = arr;
+        } break;
+        case RPC_ARG_POOL_REAL_ARRAY: {
+            int count;
+            const uint8_t *d;
+            if (!r.get_count(4, count) || !(d = r.take(count * 4)))
+                return ERR_INVALID_DATA;
+            PoolVector<real_t> arr;
+            arr.resize(count);
+            PoolVector<real_t>::Write w = arr.write();
+            for (int i = 0; i < count; i++) {
+                w[i] = decode_float(d + i * 4);
+            }
+            w.release();
+            r_value = arr;
+        } break;
+        case RPC_ARG_POOL_VECTOR2_ARRAY: {
+            int count;
+            const uint8_t *d;
+            if (!r.get_count(8, count) || !(d = r.take(count * 8)))
+                return ERR_INVALID_DATA;
+            PoolVector<Vector2> arr;
+            arr.resize(count);
+            PoolVector<Vector2>::Write w = arr.write();
+            for (int i = 0; i < count; i++, d += 8) {
+                w[i] = Vector2(decode_float(d), decode_float(d + 4));
+            }
+            w.release();
+            r_value = Variant(arr);
+        } break;
+        case RPC_ARG_POOL_VECTOR3_ARRAY: {
+            int count;
+            const uint8_t *d;
+            if (!r.get_count(12, count) || !(d = r.take(count * 12)))
+                return ERR_INVALID_DATA;
+            PoolVector<Vector3> arr;
+            arr.resize(count);
+            PoolVector<Vector3>::Write w = arr.write();
+            for (int i = 0; i < count; i++, d += 12) {
+                w[i] = Vector3(decode_float(d), decode_float(d + 4), decode_float(d + 8));
+            }
+            w.release();
+            r_value = arr;
+        } break;
+        case RPC_ARG_VARIANT: {
+            int vlen;
+            const uint8_t *d = r.take(0);
+            Error err = decode_variant(r_value, d, r.get_remaining(), &vlen, p_allow_objects);
+            if (err != OK)
+                return err;
+            r.take(vlen);
+        } break;
+        default:
+            return ERR_INVALID_DATA;
+    }
+    return OK;
+}
 } // end of anonymous namespace
 
 void MultiplayerAPI::poll() {
@@ -294,6 +617,8 @@ void MultiplayerAPI::clear() {
     connected_peers.clear();
     path_get_cache.clear();
     path_send_cache.clear();
+    name_send_cache.clear();
+    name_send_ids.clear();
     packet_cache.clear();
     last_send_cache_id = 1;
 }
@@ -339,7 +664,7 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 #ifdef DEBUG_ENABLED
     m_debug_data->record_packet(p_packet_len);
 #endif
-    uint8_t packet_type = p_packet[0];
+    uint8_t packet_type = p_packet[0] & ~NETWORK_NAME_ID_FLAG;
 
     switch (packet_type) {
 
@@ -353,6 +678,16 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
             _process_confirm_path(p_from, p_packet, p_packet_len);
         } break;
 
+        case NETWORK_COMMAND_SIMPLIFY_NAME: {
+
+            _process_simplify_name(p_from, p_packet, p_packet_len);
+        } break;
+
+        case NETWORK_COMMAND_CONFIRM_NAME: {
+
+            _process_confirm_name(p_from, p_packet, p_packet_len);
+        } break;
+
         case NETWORK_COMMAND_REMOTE_CALL:
         case NETWORK_COMMAND_REMOTE_SET: {
 
@@ -362,25 +697,40 @@ void MultiplayerAPI::_process_packet(int p_from, const uint8_t *p_packet, int p_
 
             ERR_FAIL_COND_MSG(node == nullptr, "Invalid packet received. Requested node was not found.");
 
-            // Detect cstring end.
-            int len_end = 5;
-            for (; len_end < p_packet_len; len_end++) {
-                if (p_packet[len_end] == 0) {
-                    break;
+            StringName name;
+            int name_end;
+            if (p_packet[0] & NETWORK_NAME_ID_FLAG) {
+                // Name was confirmed earlier, only its id is sent.
+                ERR_FAIL_COND_MSG(p_packet_len < 7, "Invalid packet received. Size too small.");
+                uint16_t name_id = decode_uint16(&p_packet[5]);
+                Map<int, PathGetCache>::iterator E = path_get_cache.find(p_from);
+                ERR_FAIL_COND_MSG(E == path_get_cache.end(), "Invalid packet received. Requests invalid peer cache.");
+                auto F = E->second.names.find(name_id);
+                ERR_FAIL_COND_MSG(F == E->second.names.end(), "Invalid packet received. Unable to find requested cached name.");
+                name = F->second;
+                name_end = 7;
+            } else {
+                // Detect cstring end.
+                int len_end = 5;
+                for (; len_end < p_packet_len; len_end++) {
+                    if (p_packet[len_end] == 0) {
+                        break;
+                    }
                 }
-            }
 
-            ERR_FAIL_COND_MSG(len_end >= p_packet_len, "Invalid packet received. Size too small.");
+                ERR_FAIL_COND_MSG(len_end >= p_packet_len, "Invalid packet received. Size too small.");
 
-            StringName name(((const char *)&p_packet[5]));
+                name = StringName(((const char *)&p_packet[5]));
+                name_end = len_end + 1;
+            }
 
             if (packet_type == NETWORK_COMMAND_REMOTE_CALL) {
 
-                _process_rpc(node, name, p_from, p_packet, p_packet_len, len_end + 1);
+                _process_rpc(node, name, p_from, p_packet, p_packet_len, name_end);
 
             } else {
 
-                _process_rset(node, name, p_from, p_packet, p_packet_len, len_end + 1);
+                _process_rset(node, name, p_from, p_packet, p_packet_len, name_end);
             }
 
         } break;
@@ -464,16 +814,14 @@ void MultiplayerAPI::_process_rpc(Node *p_node, const StringName &p_name, int p_
 
     m_debug_data->record_rpc(p_node);
 
+    const bool allow_objects = allow_object_decoding || network_peer->is_object_decoding_allowed();
+    RPCReader reader(p_packet, p_packet_len, p_offset);
     for (int i = 0; i < argc; i++) {
 
-        ERR_FAIL_COND_MSG(p_offset >= p_packet_len, "Invalid packet received. Size too small.");
-
-        int vlen;
-        Error err = decode_variant(args[i], &p_packet[p_offset], p_packet_len - p_offset, &vlen, allow_object_decoding || network_peer->is_object_decoding_allowed());
+        Error err = _decode_rpc_arg(reader, args[i], allow_objects);
         ERR_FAIL_COND_MSG(err != OK, "Invalid packet received. Unable to decode RPC argument.");
 
         argp[i] = &args[i];
-        p_offset += vlen;
     }
 
     Callable::CallError ce;
@@ -505,7 +853,8 @@ void MultiplayerAPI::_process_rset(Node *p_node, const StringName &p_name, int p
                                          ", master is " + ::to_string(p_node->get_network_master()) + ".");
 
     Variant value;
-    Error err = decode_variant(value, &p_packet[p_offset], p_packet_len - p_offset, nullptr, allow_object_decoding || network_peer->is_object_decoding_allowed());
+    RPCReader reader(p_packet, p_packet_len, p_offset);
+    Error err = _decode_rpc_arg(reader, value, allow_object_decoding || network_peer->is_object_decoding_allowed());
 
     ERR_FAIL_COND_MSG(err != OK, "Invalid packet received. Unable to decode RSET value.");
 
@@ -568,6 +917,90 @@ void MultiplayerAPI::_process_confirm_path(int p_from, const uint8_t *p_packet,
     E->second = true;
 }
 
+void MultiplayerAPI::_process_simplify_name(int p_from, const uint8_t *p_packet, int p_packet_len) {
+
+    ERR_FAIL_COND_MSG(p_packet_len < 4, "Invalid packet received. Size too small.");
+    ERR_FAIL_COND_MSG(p_packet[p_packet_len - 1] != 0, "Invalid packet received. Name is not terminated.");
+    uint16_t id = decode_uint16(&p_packet[1]);
+
+    path_get_cache[p_from].names[id] = StringName((const char *)&p_packet[3]);
+
+    uint8_t packet[3];
+    packet[0] = NETWORK_COMMAND_CONFIRM_NAME;
+    encode_uint16(id, &packet[1]);
+
+    network_peer->set_transfer_mode(NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
+    network_peer->set_target_peer(p_from);
+    network_peer->put_packet(packet, 3);
+}
+
+void MultiplayerAPI::_process_confirm_name(int p_from, const uint8_t *p_packet, int p_packet_len) {
+
+    ERR_FAIL_COND_MSG(p_packet_len < 3, "Invalid packet received. Size too small.");
+    uint16_t id = decode_uint16(&p_packet[1]);
+    ERR_FAIL_COND_MSG(id >= name_send_ids.size(), "Invalid packet received. Tries to confirm a name which was not found in cache.");
+
+    auto nsc = name_send_cache.find(name_send_ids[id]);
+    ERR_FAIL_COND(nsc == name_send_cache.end());
+
+    Map<int, bool>::iterator E = nsc->second.confirmed_peers.find(p_from);
+    ERR_FAIL_COND_MSG(E == nsc->second.confirmed_peers.end(), "Invalid packet received. Source peer was not found in cache for the given name.");
+    E->second = true;
+}
+
+MultiplayerAPI::NameSentCache *MultiplayerAPI::_get_name_send_cache(const StringName &p_name) {
+    auto nsc = name_send_cache.find(p_name);
+    if (nsc != name_send_cache.end())
+        return &nsc->second;
+    if (name_send_ids.size() > UINT16_MAX)
+        return nullptr; // Out of ids, the name is sent as a string.
+
+    NameSentCache &cache = name_send_cache[p_name];
+    cache.id = uint16_t(name_send_ids.size());
+    name_send_ids.push_back(p_name);
+    return &cache;
+}
+
+bool MultiplayerAPI::_send_confirm_name(const StringName &p_name, NameSentCache *nsc, int p_target) {
+    bool has_all_peers = true;
+    uint8_t *packet = nullptr;
+    int packet_len = 0;
+    Vector<uint8_t> packet_data;
+
+    for (int E : connected_peers) {
+
+        if (p_target < 0 && E == -p_target)
+            continue; // Continue, excluded.
+
+        if (p_target > 0 && E != p_target)
+            continue; // Continue, not for this peer.
+
+        Map<int, bool>::iterator F = nsc->confirmed_peers.find(E);
+        if (F != nsc->confirmed_peers.end()) {
+            has_all_peers = has_all_peers && F->second;
+            continue;
+        }
+        has_all_peers = false;
+
+        if (!packet) {
+            int len = encode_cstring(p_name.asCString(), nullptr);
+            packet_data.resize(1 + 2 + len);
+            packet = packet_data.data();
+            packet[0] = NETWORK_COMMAND_SIMPLIFY_NAME;
+            encode_uint16(nsc->id, &packet[1]);
+            encode_cstring(p_name.asCString(), &packet[3]);
+            packet_len = packet_data.size();
+        }
+        network_peer->set_target_peer(E);
+        network_peer->set_transfer_mode(NetworkedMultiplayerPeer::TRANSFER_MODE_RELIABLE);
+        network_peer->put_packet(packet, packet_len);
+
+        nsc->confirmed_peers.emplace(E, false); // Insert into confirmed, but as false since it was not confirmed.
+    }
+
+    return has_all_peers;
+}
+
 bool MultiplayerAPI::_send_confirm_path(const NodePath& p_path, PathSentCache *psc, int p_target) {
     bool has_all_peers = true;
     Vector<int> peers_to_add; // If one is missing, take note to add it.
@@ -644,51 +1077,43 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
         psc = path_send_cache.emplace(eastl::make_pair(from_path, PathSentCache{{},last_send_cache_id++ })).first;
     }
 
-    // Create base packet, lots of hardcode because it must be tight.
-
-    size_t ofs = 0;
+    // See if every target confirmed the name, if so its id is sent instead of the string.
+    NameSentCache *nsc = _get_name_send_cache(p_name);
+    const bool use_name_id = nsc && _send_confirm_name(p_name, nsc, p_to);
 
-#define MAKE_ROOM(m_amount) \
-    if (packet_cache.size() < m_amount) packet_cache.resize(m_amount);
+    // Create base packet, lots of hardcode because it must be tight.
+    // Everything is written in a single pass, packet_cache only grows.
+    RPCWriter w(packet_cache, 0);
 
     // Encode type.
-    MAKE_ROOM(1)
-    packet_cache[0] = p_set ? NETWORK_COMMAND_REMOTE_SET : NETWORK_COMMAND_REMOTE_CALL;
-    ofs += 1;
+    w.put_u8((p_set ? NETWORK_COMMAND_REMOTE_SET : NETWORK_COMMAND_REMOTE_CALL) | (use_name_id ? NETWORK_NAME_ID_FLAG : 0));
 
     // Encode ID.
-    MAKE_ROOM(ofs + 4)
-    encode_uint32(psc->second.id, &packet_cache[ofs]);
-    ofs += 4;
+    encode_uint32(psc->second.id, w.reserve(4));
 
     // Encode function name.
-    String name(p_name);
-    int len = encode_cstring(name.data(), nullptr);
-    MAKE_ROOM(ofs + len)
-    encode_cstring(name.data(), &packet_cache[ofs]);
-    ofs += len;
+    if (use_name_id) {
+        encode_uint16(nsc->id, w.reserve(2));
+    } else {
+        int len = encode_cstring(p_name.asCString(), nullptr);
+        encode_cstring(p_name.asCString(), w.reserve(len));
+    }
 
+    const bool full_objects = allow_object_decoding || network_peer->is_object_decoding_allowed();
     if (p_set) {
         // Set argument.
-        Error err = encode_variant(*p_arg[0], nullptr, len, allow_object_decoding || network_peer->is_object_decoding_allowed());
+        Error err = _encode_rpc_arg(w, *p_arg[0], full_objects);
         ERR_FAIL_COND_MSG(err != OK, "Unable to encode RSET value. THIS IS LIKELY A BUG IN THE ENGINE!");
-        MAKE_ROOM(ofs + len)
-        encode_variant(*p_arg[0], &packet_cache[ofs], len, allow_object_decoding || network_peer->is_object_decoding_allowed());
-        ofs += len;
 
     } else {
         // Call arguments.
-        MAKE_ROOM(ofs + 1)
-        packet_cache[ofs] = p_argcount;
-        ofs += 1;
+        w.put_u8(p_argcount);
         for (int i = 0; i < p_argcount; i++) {
-            Error err = encode_variant(*p_arg[i], nullptr, len, allow_object_decoding || network_peer->is_object_decoding_allowed());
+            Error err = _encode_rpc_arg(w, *p_arg[i], full_objects);
             ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC argument. THIS IS LIKELY A BUG IN THE ENGINE!");
-            MAKE_ROOM(ofs + len)
-            encode_variant(*p_arg[i], &packet_cache[ofs], len, allow_object_decoding || network_peer->is_object_decoding_allowed());
-            ofs += len;
         }
     }
+    const int ofs = w.get_offset();
 
     m_debug_data->record_rpc_call(ofs);
 
@@ -709,8 +1134,7 @@ void MultiplayerAPI::_send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p
         // Append path at the end, since we will need it for some packets.
         String pname(from_path);
         int path_len = encode_cstring(pname.data(), nullptr);
-        MAKE_ROOM(ofs + path_len)
-        encode_cstring(pname.data(), &(packet_cache[ofs]));
+        encode_cstring(pname.data(), w.reserve(path_len));
 
         for (int E : connected_peers) {
 
@@ -757,6 +1181,9 @@ void MultiplayerAPI::_del_peer(int p_id) {
         auto psc = path_send_cache.find(E);
         psc->second.confirmed_peers.erase(p_id);
     }
+    for (auto &E : name_send_cache) {
+        E.second.confirmed_peers.erase(p_id);
+    }
     emit_signal("network_peer_disconnected", p_id);
 }
 void MultiplayerAPI::_connected_to_server() {
@@ -909,10 +1336,9 @@ Error MultiplayerAPI::send_bytes(const PoolVector<uint8_t>& p_data, int p_to, Ne
     ERR_FAIL_COND_V_MSG(not network_peer, ERR_UNCONFIGURED, "Trying to send a raw packet while no network peer is active.");
     ERR_FAIL_COND_V_MSG(network_peer->get_connection_status() != NetworkedMultiplayerPeer::CONNECTION_CONNECTED, ERR_UNCONFIGURED, "Trying to send a raw packet via a network peer which is not connected.");
 
-    MAKE_ROOM(p_data.size() + 1)
-    PoolVector<uint8_t>::Read r = p_data.read();
-    packet_cache[0] = NETWORK_COMMAND_RAW;
-    memcpy(&packet_cache[1], &r[0], p_data.size());
+    RPCWriter w(packet_cache, 0);
+    w.put_u8(NETWORK_COMMAND_RAW);
+    w.put_bytes(p_data.read().ptr(), p_data.size());
 
     network_peer->set_target_peer(p_to);
     network_peer->set_transfer_mode(p_mode);
@@ -46,6 +46,8 @@ enum MultiplayerAPI_NetworkCommands {
     NETWORK_COMMAND_SIMPLIFY_PATH,
     NETWORK_COMMAND_CONFIRM_PATH,
     NETWORK_COMMAND_RAW,
+    NETWORK_COMMAND_SIMPLIFY_NAME,
+    NETWORK_COMMAND_CONFIRM_NAME,
 };
 enum MultiplayerAPI_RPCMode : int8_t {
 
@@ -87,6 +89,13 @@ private:
         };
 
         Map<int, NodeInfo> nodes;
+        HashMap<uint16_t, StringName> names;
+    };
+
+    //method and property name caches, once a peer confirmed a name the packets carry its id instead
+    struct NameSentCache {
+        Map<int, bool> confirmed_peers;
+        uint16_t id;
     };
     class DebugData;
     DebugData *m_debug_data = nullptr;
@@ -96,6 +105,8 @@ private:
     HashMap<NodePath, PathSentCache, Hasher<NodePath> > path_send_cache;
     Map<int, PathGetCache> path_get_cache;
     int last_send_cache_id;
+    HashMap<StringName, NameSentCache> name_send_cache;
+    Vector<StringName> name_send_ids;
     Vector<uint8_t> packet_cache;
     Node *root_node;
     bool allow_object_decoding = false;
@@ -106,6 +117,8 @@ protected:
     void _process_packet(int p_from, const uint8_t *p_packet, int p_packet_len);
     void _process_simplify_path(int p_from, const uint8_t *p_packet, int p_packet_len);
     void _process_confirm_path(int p_from, const uint8_t *p_packet, int p_packet_len);
+    void _process_simplify_name(int p_from, const uint8_t *p_packet, int p_packet_len);
+    void _process_confirm_name(int p_from, const uint8_t *p_packet, int p_packet_len);
     Node *_process_get_node(int p_from, const uint8_t *p_packet, int p_packet_len);
     void _process_rpc(Node *p_node, const StringName &p_name, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
     void _process_rset(Node *p_node, const StringName &p_name, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
@@ -113,6 +126,8 @@ protected:
 
     void _send_rpc(Node *p_from, int p_to, bool p_unreliable, bool p_set, const StringName &p_name, const Variant **p_arg, int p_argcount);
     bool _send_confirm_path(const NodePath& p_path, PathSentCache *psc, int p_target);
+    NameSentCache *_get_name_send_cache(const StringName &p_name);
+    bool _send_confirm_name(const StringName &p_name, NameSentCache *nsc, int p_target);
 
 
 public:
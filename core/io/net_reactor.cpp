@@ -0,0 +1,105 @@
+/*************************************************************************/
+/*  net_reactor.cpp                                                      */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "net_reactor.h"
+
+#include "core/error_macros.h"
+
+NetReactor *(*NetReactor::_create)() = nullptr;
+
+NetReactor *NetReactor::create() {
+
+    if (_create)
+        return _create();
+    return nullptr;
+}
+
+// Poll timeout of the network thread, bounds how long stop() waits for it.
+#define REACTOR_THREAD_TIMEOUT_MSEC 100
+
+void NetReactorThread::_thread_func(void *p_user) {
+    NetReactorThread *self = static_cast<NetReactorThread *>(p_user);
+    Vector<NetReactor::Event> events;
+
+    while (!self->exit.load(std::memory_order_acquire)) {
+        events.clear();
+        if (self->reactor->wait(REACTOR_THREAD_TIMEOUT_MSEC, events) <= 0)
+            continue;
+        {
+            MutexLock guard(self->mutex);
+            self->ready.swap(events);
+        }
+        self->has_events.store(true, std::memory_order_release);
+        // Registrations are level-triggered, wait until the owner drained the sockets before polling again.
+        self->consumed.wait();
+    }
+}
+
+void NetReactorThread::start(NetReactor *p_reactor) {
+    ERR_FAIL_COND(reactor != nullptr);
+    ERR_FAIL_NULL(p_reactor);
+
+    reactor = p_reactor;
+    exit.store(false, std::memory_order_release);
+    thread.start(&NetReactorThread::_thread_func, this);
+}
+
+void NetReactorThread::stop() {
+    if (!reactor)
+        return;
+
+    exit.store(true, std::memory_order_release);
+    consumed.post();
+    thread.wait_to_finish();
+    // drain a post that was not needed by the thread.
+    consumed.try_wait();
+    has_events.store(false, std::memory_order_release);
+    ready.clear();
+    reactor = nullptr;
+}
+
+bool NetReactorThread::acquire_events(Vector<NetReactor::Event> &r_events) {
+    if (!has_events.load(std::memory_order_acquire))
+        return false;
+
+    MutexLock guard(mutex);
+    r_events.swap(ready);
+    ready.clear();
+    has_events.store(false, std::memory_order_release);
+    return true;
+}
+
+void NetReactorThread::release_events() {
+    consumed.post();
+}
+
+NetReactorThread::~NetReactorThread() {
+    stop();
+}
@@ -0,0 +1,102 @@
+/*************************************************************************/
+/*  net_reactor.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#pragma once
+
+#include "core/io/net_socket.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/vector.h"
+
+#include <atomic>
+
+/// Readiness notification for many sockets at once.
+/// Sockets are registered with a caller chosen token, wait() reports the tokens of sockets that can be read from or
+/// written to, so the cost of a poll scales with the number of active sockets instead of the number of open ones.
+/// Registrations are level-triggered. Closing a socket removes it from the reactor.
+class GODOT_EXPORT NetReactor {
+
+protected:
+    static NetReactor *(*_create)();
+
+public:
+    enum EventFlags {
+        EVENT_READ = 1,
+        EVENT_WRITE = 2,
+        EVENT_ERROR = 4, // hang-up or socket error, always reported
+    };
+
+    struct Event {
+        uint64_t token;
+        uint32_t events;
+    };
+
+    //! Returns nullptr when the platform has no reactor implementation, callers should fall back to polling.
+    static NetReactor *create();
+    static bool is_supported() { return _create != nullptr; }
+
+    virtual Error add(const Ref<NetSocket> &p_socket, uint32_t p_events, uint64_t p_token) = 0;
+    virtual Error modify(const Ref<NetSocket> &p_socket, uint32_t p_events, uint64_t p_token) = 0;
+    virtual void remove(const Ref<NetSocket> &p_socket) = 0;
+    //! Waits at most p_timeout_msec (0 returns immediately, -1 waits forever) and fills r_events with the ready sockets.
+    //! Returns the number of events, or -1 on error.
+    virtual int wait(int p_timeout_msec, Vector<Event> &r_events) = 0;
+
+    virtual ~NetReactor() = default;
+};
+
+/// Runs NetReactor::wait on a dedicated network thread.
+/// The owner picks up the ready events with acquire_events() and calls release_events() once it has serviced them,
+/// which lets the thread wait for the next batch. The thread calling acquire_events never blocks in the kernel.
+class GODOT_EXPORT NetReactorThread {
+
+    NetReactor *reactor = nullptr;
+    Thread thread;
+    Mutex mutex;
+    Semaphore consumed;
+    Vector<NetReactor::Event> ready;
+    std::atomic<bool> has_events { false };
+    std::atomic<bool> exit { false };
+
+    static void _thread_func(void *p_user);
+
+public:
+    void start(NetReactor *p_reactor);
+    void stop();
+    bool is_running() const { return reactor != nullptr; }
+
+    //! Returns false when no events are pending, release_events must only be called after a successful acquire.
+    bool acquire_events(Vector<NetReactor::Event> &r_events);
+    void release_events();
+
+    NetReactorThread() = default;
+    ~NetReactorThread();
+};
@@ -81,6 +81,8 @@ public:
     int get_available_packet_count() const override;
     int get_max_packet_size() const override;
     void set_broadcast_enabled(bool p_enabled);
+    //! Underlying socket, used to register this peer with a NetReactor.
+    const Ref<NetSocket> &get_net_socket() const { return _sock; }
     Error join_multicast_group(IP_Address p_multi_address, StringView p_if_name);
     Error join_multicast_group(StringView p_multi_address, StringView p_if_name) {
         return join_multicast_group(IP_Address(p_multi_address), p_if_name);
@@ -30,11 +30,17 @@
 
 #include "pck_packer.h"
 
+#include "core/io/compression.h"
+#include "core/io/file_access_chunked.h"
 #include "core/io/file_access_pack.h"
 #include "core/os/file_access.h"
 #include "core/version.h"
 #include "core/method_bind.h"
 
+#include "EASTL/sort.h"
+
+#include <zstd.h>
+
 IMPL_GDCLASS(PCKPacker)
 
 static uint64_t _align(uint64_t p_n, int p_alignment) {
@@ -60,14 +66,42 @@ static void _pad(FileAccess *p_file, int p_bytes) {
     }
 }
 
+// Builds a raw content zstd dictionary out of the beginnings of the small files, which are mostly text resources
+// sharing the same headers and property names. Large files compress well enough on their own.
+static Vector<uint8_t> _build_dictionary(const Vector<eastl::pair<String, uint64_t>> &p_files) {
+
+    const uint64_t small_file_limit = 64 * 1024;
+    const uint64_t sample_size = 4096;
+    const uint64_t dictionary_size = 112 * 1024;
+
+    Vector<uint8_t> dictionary;
+    for (const eastl::pair<String, uint64_t> &file : p_files) {
+        if (dictionary.size() >= dictionary_size) {
+            break;
+        }
+        if (file.second == 0 || file.second > small_file_limit) {
+            continue;
+        }
+        FileAccessRef<true> src(FileAccess::open(file.first, FileAccess::READ));
+        if (!src) {
+            continue;
+        }
+        const uint64_t take = MIN(MIN(file.second, sample_size), dictionary_size - dictionary.size());
+        const size_t at = dictionary.size();
+        dictionary.resize(at + take);
+        dictionary.resize(at + M_MAX(src->get_buffer(dictionary.data() + at, take), 0));
+    }
+    return dictionary;
+}
+
 void PCKPacker::_bind_methods() {
 
-    MethodBinder::bind_method(D_METHOD("pck_start", {"pck_name", "alignment"}), &PCKPacker::pck_start, {DEFVAL(0)});
+    MethodBinder::bind_method(D_METHOD("pck_start", {"pck_name", "alignment", "compress"}), &PCKPacker::pck_start, {DEFVAL(0), DEFVAL(false)});
     MethodBinder::bind_method(D_METHOD("add_file", {"pck_path", "source_path"}), &PCKPacker::add_file);
     MethodBinder::bind_method(D_METHOD("flush", {"verbose"}), &PCKPacker::flush, {DEFVAL(false)});
 }
 
-Error PCKPacker::pck_start(StringView p_file, int p_alignment) {
+Error PCKPacker::pck_start(StringView p_file, int p_alignment, bool p_compress) {
 
     memdelete(file);
 
@@ -76,6 +110,7 @@ Error PCKPacker::pck_start(StringView p_file, int p_alignment) {
     ERR_FAIL_COND_V_MSG(!file, ERR_CANT_CREATE, "Can't open file to write: " + String(p_file) + ".");
 
     alignment = p_alignment;
+    compress = p_compress;
 
     file->store_32(PACK_HEADER_MAGIC); // MAGIC
     file->store_32(PACK_FORMAT_VERSION); // # version
@@ -105,6 +140,7 @@ Error PCKPacker::add_file(StringView p_file, StringView p_src) {
     pf.src_path = p_src;
     pf.size = f->get_len();
     pf.offset_offset = 0;
+    pf.index_offset_offset = 0;
 
     files.push_back(pf);
 
@@ -135,6 +171,45 @@ Error PCKPacker::flush(bool p_verbose) {
         file->store_32(0);
     }
 
+    // hash index, lets the pack be mounted without parsing the table above.
+    uint64_t index_pos = file->get_position();
+    Vector<eastl::pair<uint64_t, uint32_t>> index_order;
+    index_order.reserve(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        index_order.emplace_back(PackedData::hash_path(files[i].path), uint32_t(i));
+    }
+    eastl::sort(index_order.begin(), index_order.end());
+
+    file->store_32(files.size());
+    for (const eastl::pair<uint64_t, uint32_t> &entry : index_order) {
+
+        file->store_64(entry.first);
+        files[entry.second].index_offset_offset = file->get_position();
+        file->store_64(0); // offset
+        file->store_64(files[entry.second].size);
+        for (int j = 0; j < 4; j++) {
+            file->store_32(0); // md5
+        }
+    }
+
+    // compressed packs store every file as a FileAccessChunked blob, small files share a dictionary.
+    uint64_t dictionary_pos = 0;
+    Vector<uint8_t> dictionary;
+    ZSTD_CDict *cdict = nullptr;
+    if (compress) {
+        Vector<eastl::pair<String, uint64_t>> sources;
+        sources.reserve(files.size());
+        for (const File &f : files) {
+            sources.emplace_back(f.src_path, f.size);
+        }
+        dictionary = _build_dictionary(sources);
+        dictionary_pos = file->get_position();
+        if (!dictionary.empty()) {
+            file->store_buffer(dictionary.data(), dictionary.size());
+            cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), Compression::zstd_level);
+        }
+    }
+
     uint64_t ofs = file->get_position();
     ofs = _align(ofs, alignment);
 
@@ -143,28 +218,47 @@ Error PCKPacker::flush(bool p_verbose) {
     const uint32_t buf_max = 65536;
     uint8_t *buf = memnew_arr(uint8_t, buf_max);
 
+    Error err = OK;
     int count = 0;
     for (size_t i = 0; i < files.size(); i++) {
 
         FileAccess *src = FileAccess::open(files[i].src_path, FileAccess::READ);
-        uint64_t to_write = files[i].size;
-        while (to_write > 0) {
-
-            int read = src->get_buffer(buf, MIN(to_write, buf_max));
-            file->store_buffer(buf, read);
-            to_write -= read;
+        if (!src) {
+            err = ERR_FILE_CANT_OPEN;
+            ERR_PRINT("Can't open file to pack: " + files[i].src_path + ".");
+            break;
+        }
+        uint64_t stored_size = files[i].size;
+        if (compress) {
+            err = FileAccessChunked::write_blob(file, src, files[i].size, FileAccessChunked::DEFAULT_BLOCK_SIZE, cdict, &stored_size);
+        } else {
+            uint64_t to_write = files[i].size;
+            while (to_write > 0) {
+
+                int read = src->get_buffer(buf, MIN(to_write, buf_max));
+                file->store_buffer(buf, read);
+                to_write -= read;
+            }
+        }
+        src->close();
+        memdelete(src);
+        if (err != OK) {
+            ERR_PRINT("Failed to pack file: " + files[i].src_path + ".");
+            break;
         }
 
         uint64_t pos = file->get_position();
-        file->seek(files[i].offset_offset); // go back to store the file's offset
+        file->seek(files[i].offset_offset); // go back to store the file's offset and stored size
+        file->store_64(ofs);
+        file->store_64(stored_size);
+        file->seek(files[i].index_offset_offset);
         file->store_64(ofs);
+        file->store_64(stored_size);
         file->seek(pos);
 
-        ofs = _align(ofs + files[i].size, alignment);
+        ofs = _align(ofs + stored_size, alignment);
         _pad(file, ofs - pos);
 
-        src->close();
-        memdelete(src);
         count += 1;
         if (p_verbose  && !files.empty()) {
             if (count % 100 == 0) {
@@ -178,10 +272,21 @@ Error PCKPacker::flush(bool p_verbose) {
         printf("\n");
     }
 
+    if (cdict) {
+        ZSTD_freeCDict(cdict);
+    }
+
+    // flag the index and compression in the header's reserved fields, see PACK_FLAG_HASH_INDEX.
+    file->seek(PACK_RESERVED_OFFSET);
+    file->store_32(PACK_FLAG_HASH_INDEX | (compress ? PACK_FLAG_CHUNKED_FILES : 0));
+    file->store_64(index_pos);
+    file->store_64(dictionary_pos);
+    file->store_32(dictionary.size());
+
     file->close();
     memdelete_arr(buf);
 
-    return OK;
+    return err;
 }
 
 PCKPacker::PCKPacker() {
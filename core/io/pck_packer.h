@@ -41,6 +41,7 @@ class GODOT_EXPORT PCKPacker : public RefCounted {
 
     FileAccess *file;
     int alignment;
+    bool compress = false;
 
     static void _bind_methods();
 
@@ -50,11 +51,12 @@ class GODOT_EXPORT PCKPacker : public RefCounted {
         String src_path;
         int size;
         uint64_t offset_offset;
+        uint64_t index_offset_offset; // position of the offset in the hash index entry
     };
     Vector<File> files;
 
 public:
-    Error pck_start(StringView p_file, int p_alignment = 0);
+    Error pck_start(StringView p_file, int p_alignment = 0, bool p_compress = false);
     Error add_file(StringView p_file, StringView p_src);
     Error flush(bool p_verbose = false);
 
@@ -126,16 +126,31 @@ void ResourceInteractiveLoaderBinary::_advance_padding(uint32_t p_len) {
     }
 }
 
+// Returns the next p_len bytes of a memory mapped file and skips past them, nullptr when f is not mapped.
+const char *ResourceInteractiveLoaderBinary::_read_mapped(uint32_t p_len) {
+
+    if (!f_mapped)
+        return nullptr;
+    size_t pos = f->get_position();
+    const uint8_t *data = f->get_mapped_range(pos, p_len);
+    if (data)
+        f->seek(pos + p_len);
+    return reinterpret_cast<const char *>(data);
+}
+
 StringName ResourceInteractiveLoaderBinary::_get_string() {
 
     uint32_t id = f->get_32();
     if (id & 0x80000000) {
         uint32_t len = id & 0x7FFFFFFF;
+        if (len == 0)
+            return StringName();
+        // stored strings include their terminator.
+        if (const char *mapped = _read_mapped(len))
+            return StringName(StringView(mapped, strnlen(mapped, len)));
         if ((int)len > str_buf.size()) {
             str_buf.resize(len);
         }
-        if (len == 0)
-            return StringName();
         f->get_buffer((uint8_t *)&str_buf[0], len);
         return StringName(&str_buf[0]);
     }
@@ -707,11 +722,13 @@ static String get_ustring(FileAccess *f) {
 String ResourceInteractiveLoaderBinary::get_unicode_string() {
 
     int len = f->get_32();
+    if (len <= 0)
+        return String();
+    if (const char *mapped = _read_mapped(len))
+        return String(mapped, strnlen(mapped, len));
     if (len > str_buf.size()) {
         str_buf.resize(len);
     }
-    if (len == 0)
-        return String();
     f->get_buffer((uint8_t *)&str_buf[0], len);
     return (&str_buf[0]);
 }
@@ -764,6 +781,7 @@ void ResourceInteractiveLoaderBinary::open(FileAccess *p_f) {
     bool use_real64 = f->get_32();
 
     f->set_endian_swap(big_endian != 0); //read big endian if saved as big endian
+    f_mapped = f->get_mapped_range(0, 0) != nullptr;
 
     uint32_t ver_major = f->get_32();
     uint32_t ver_minor = f->get_32();
@@ -887,7 +905,7 @@ Ref<ResourceInteractiveLoader> ResourceFormatLoaderBinary::load_interactive(Stri
         *r_error = ERR_FILE_CANT_OPEN;
 
     Error err;
-    FileAccess *f = FileAccess::open(p_path, FileAccess::READ, &err);
+    FileAccess *f = FileAccess::open_mapped(p_path, &err);
 
     ERR_FAIL_COND_V_MSG(err != OK, Ref<ResourceInteractiveLoader>(), "Cannot open file '" + String(p_path) + "'.");
 
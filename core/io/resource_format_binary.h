@@ -61,11 +61,13 @@ class ResourceInteractiveLoaderBinary : public ResourceInteractiveLoader {
     Ref<Resource> resource;
     uint32_t ver_format;
     FileAccess *f=nullptr;
+    bool f_mapped = false; // f exposes its contents through get_mapped_range
     uint64_t importmd_ofs;
     Error error = OK;
     int stage = 0;
     bool translation_remapped = false;
 
+    const char *_read_mapped(uint32_t p_len);
     StringName _get_string();
     String get_unicode_string();
     void _advance_padding(uint32_t p_len);
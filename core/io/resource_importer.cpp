@@ -217,9 +217,7 @@ bool ResourceFormatImporter::can_be_imported(StringView p_path) const {
     return ResourceFormatLoader::recognize_path(p_path);
 }
 
-int ResourceFormatImporter::get_import_order(StringView p_path) const {
-
-    ResourceImporterInterface *importer = nullptr;
+ResourceImporterInterface *ResourceFormatImporter::get_importer_for_path(StringView p_path) const {
 
     if (FileAccess::exists(String(p_path) + ".import")) {
 
@@ -227,13 +225,18 @@ int ResourceFormatImporter::get_import_order(StringView p_path) const {
         Error err = _get_path_and_type(p_path, pat);
 
         if (err == OK) {
-            importer = get_importer_by_name(pat.importer);
+            return get_importer_by_name(pat.importer);
         }
-    } else {
-
-        importer = get_importer_by_extension(StringUtils::to_lower(PathUtils::get_extension(p_path)));
+        return nullptr;
     }
 
+    return get_importer_by_extension(StringUtils::to_lower(PathUtils::get_extension(p_path)));
+}
+
+int ResourceFormatImporter::get_import_order(StringView p_path) const {
+
+    ResourceImporterInterface *importer = get_importer_for_path(p_path);
+
     if (importer!=nullptr)
         return importer->get_import_order();
 
@@ -95,6 +95,8 @@ public:
 
     ResourceImporterInterface * get_importer_by_name(StringView p_name) const;
     ResourceImporterInterface * get_importer_by_extension(StringView p_extension) const;
+    //! Importer named in p_path's .import file, or the one matching its extension when it was never imported.
+    ResourceImporterInterface * get_importer_for_path(StringView p_path) const;
 
     void get_importers_for_extension(StringView p_extension, Vector<ResourceImporterInterface *> *r_importers) const;
 
@@ -78,6 +78,8 @@ public:
     Status get_status();
 
     void set_no_delay(bool p_enabled);
+    //! Underlying socket, used to register this peer with a NetReactor.
+    const Ref<NetSocket> &get_net_socket() const { return _sock; }
 
     // Read/Write from StreamPeer
     Error put_data(const uint8_t *p_data, int p_bytes) override;
@@ -59,6 +59,8 @@ public:
     Ref<StreamPeerTCP> take_connection();
 
     void stop(); // Stop listening
+    //! Underlying socket, used to register this server with a NetReactor.
+    const Ref<NetSocket> &get_net_socket() const { return _sock; }
 
     TCP_Server();
     ~TCP_Server() override;
@@ -0,0 +1,59 @@
+/*************************************************************************/
+/*  dir_watcher.h                                                        */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#pragma once
+
+#include "core/string.h"
+#include "core/vector.h"
+
+/// Reports which directories had entries created, removed, renamed or written to, without listing them again.
+/// Watches are not recursive, every directory of interest is added on its own. Implementations are thread-safe, so
+/// directories can be added from the threads that scan them.
+class GODOT_EXPORT DirWatcher {
+
+protected:
+    static DirWatcher *(*_create)();
+
+public:
+    //! Returns nullptr when the platform has no watcher implementation, callers should fall back to polling.
+    static DirWatcher *create();
+    static bool is_supported() { return _create != nullptr; }
+
+    //! Returns false when the directory can't be watched, e.g. because a system limit was reached.
+    virtual bool add_watch(StringView p_path) = 0;
+    virtual void remove_watch(StringView p_path) = 0;
+    //! Never blocks. Appends the paths, as passed to add_watch, of the directories that changed since the last call.
+    //! r_overflow is set when events were lost or a watched directory was moved, every directory has to be treated as
+    //! changed then.
+    virtual void read_changes(Vector<String> &r_changed, bool &r_overflow) = 0;
+
+    virtual ~DirWatcher() = default;
+};
@@ -41,6 +41,7 @@
 #include "core/string_utils.inl"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = { nullptr, nullptr };
+FileAccess::CreateFunc FileAccess::create_mapped_func = nullptr;
 
 FileAccess::FileCloseFailNotify FileAccess::close_fail_notify = nullptr;
 
@@ -77,22 +78,20 @@ const String &FileAccess::get_path() const { return null_string; }
 
 const String &FileAccess::get_path_absolute() const { return null_string; }
 
-FileAccess *FileAccess::create_for_path(StringView p_path) {
+static FileAccess::AccessType _access_type_for_path(StringView p_path) {
 
-    FileAccess *ret = nullptr;
     if (StringUtils::begins_with(p_path,"res://")) {
-
-        ret = create(ACCESS_RESOURCES);
-    } else if (StringUtils::begins_with(p_path,"user://")) {
-
-        ret = create(ACCESS_USERDATA);
-
-    } else {
-
-        ret = create(ACCESS_FILESYSTEM);
+        return FileAccess::ACCESS_RESOURCES;
+    }
+    if (StringUtils::begins_with(p_path,"user://")) {
+        return FileAccess::ACCESS_USERDATA;
     }
+    return FileAccess::ACCESS_FILESYSTEM;
+}
 
-    return ret;
+FileAccess *FileAccess::create_for_path(StringView p_path) {
+
+    return create(_access_type_for_path(p_path));
 }
 
 Error FileAccess::reopen(StringView p_path, int p_mode_flags) {
@@ -128,6 +127,32 @@ FileAccess *FileAccess::open(StringView p_path, int p_mode_flags, Error *r_error
     return ret;
 }
 
+FileAccess *FileAccess::open_mapped(StringView p_path, Error *r_error) {
+
+    if (!create_mapped_func) {
+        return open(p_path, READ, r_error);
+    }
+    // files inside packs are served by their pack source, which maps the whole pack when it can.
+    if (PackedData::get_singleton() && !PackedData::get_singleton()->is_disabled()) {
+        FileAccess *ret = PackedData::get_singleton()->try_open_path(p_path);
+        if (ret) {
+            if (r_error)
+                *r_error = OK;
+            return ret;
+        }
+    }
+
+    FileAccess *ret = create_mapped_func();
+    ret->_set_access_type(_access_type_for_path(p_path));
+    if (ret->_open(p_path, READ) == OK) {
+        if (r_error)
+            *r_error = OK;
+        return ret;
+    }
+    memdelete(ret);
+    return open(p_path, READ, r_error);
+}
+
 FileAccess::CreateFunc FileAccess::get_create_func(AccessType p_access) {
 
     return create_func[p_access];
@@ -448,6 +473,20 @@ uint64_t FileAccess::get_modified_time(StringView p_file) {
     return mt;
 }
 
+bool FileAccess::get_file_identity(StringView p_file, FileIdentity &r_identity) {
+
+    PackedData *pd=PackedData::get_singleton();
+    if (pd && !pd->is_disabled() && (pd->has_path(p_file) || pd->has_directory(p_file)))
+        return false;
+
+    FileAccess *fa = create_for_path(p_file);
+    ERR_FAIL_COND_V_MSG(!fa, false, "Cannot create FileAccess for path '" + String(p_file) + "'.");
+
+    bool ok = fa->_get_file_identity(p_file, r_identity);
+    memdelete(fa);
+    return ok;
+}
+
 uint32_t FileAccess::get_unix_permissions(StringView p_file) {
 
     PackedData *pd=PackedData::get_singleton();
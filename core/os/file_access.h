@@ -52,6 +52,18 @@ public:
 
     using FileCloseFailNotify = void (*)(StringView);
 
+    //! What the filesystem reports about a file without reading it, an unchanged identity is taken as unchanged contents.
+    struct FileIdentity {
+        uint64_t modified_time = 0; // nanoseconds where the platform provides them
+        uint64_t size = 0;
+        uint64_t inode = 0;
+
+        bool operator==(const FileIdentity &p_other) const {
+            return modified_time == p_other.modified_time && size == p_other.size && inode == p_other.inode;
+        }
+        bool operator!=(const FileIdentity &p_other) const { return !(*this == p_other); }
+    };
+
     using CreateFunc = FileAccess *(*)();
     bool endian_swap;
     bool real_is_double;
@@ -63,6 +75,7 @@ protected:
     String fix_path(StringView p_path) const;
     virtual Error _open(StringView p_path, int p_mode_flags) = 0; ///< open a file
     virtual uint64_t _get_modified_time(StringView p_file) = 0;
+    virtual bool _get_file_identity(StringView /*p_file*/, FileIdentity & /*r_identity*/) { return false; }
 
     static FileCloseFailNotify close_fail_notify;
 
@@ -71,6 +84,7 @@ private:
 
     AccessType _access_type;
     static CreateFunc create_func[ACCESS_MAX]; /** default file access creation function for a platform */
+    static CreateFunc create_mapped_func; /** memory mapped read-only file access, if the platform provides one */
     template <class T>
     static FileAccess *_create_builtin() {
 
@@ -113,6 +127,9 @@ public:
     virtual real_t get_real() const;
 
     virtual int get_buffer(uint8_t *p_dst, int p_length) const; ///< get an array of bytes
+    /// Returns p_length bytes starting at p_offset (from the start of this file, the position is not changed) when
+    /// the contents are memory mapped, nullptr otherwise. The range stays valid until the file is closed.
+    virtual const uint8_t *get_mapped_range(size_t p_offset, size_t p_length) const { return nullptr; }
     virtual String get_line() const;
     virtual String get_token() const;
     virtual Vector<String> get_csv_line(char p_delim = ',') const;
@@ -155,9 +172,13 @@ public:
     static FileAccess *create_for_path(StringView p_path);
     /// Create a file access (for the current platform) this is the only portable way of accessing files.
     static FileAccess *open(StringView p_path, int p_mode_flags, Error *r_error = nullptr);
+    /// Opens p_path for reading, memory mapped when the platform supports it. Falls back to a regular open otherwise.
+    static FileAccess *open_mapped(StringView p_path, Error *r_error = nullptr);
     static CreateFunc get_create_func(AccessType p_access);
     static bool exists(StringView p_name); ///< return true if a file exists
     static uint64_t get_modified_time(StringView p_file);
+    //! Returns false when the platform or the file's location (packs) can't identify files.
+    static bool get_file_identity(StringView p_file, FileIdentity &r_identity);
     static uint32_t get_unix_permissions(StringView p_file);
     static Error set_unix_permissions(StringView p_file, uint32_t p_permissions);
 
@@ -176,6 +197,11 @@ public:
 
         create_func[p_access] = _create_builtin<T>;
     }
+    template <class T>
+    static void make_mapped_default() {
+
+        create_mapped_func = _create_builtin<T>;
+    }
 
     FileAccess();
     virtual ~FileAccess() = default;
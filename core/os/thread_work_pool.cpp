@@ -0,0 +1,130 @@
+/*************************************************************************/
+/*  thread_work_pool.cpp                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "thread_work_pool.h"
+
+#include "core/error_macros.h"
+#include "core/os/memory.h"
+#include "core/os/os.h"
+
+namespace {
+ThreadWorkPool s_engine_pool;
+// set for the pool workers, and for the dispatching thread while it participates in a loop.
+thread_local bool tl_inside_pool_work = false;
+} // end of anonymous namespace
+
+void ThreadWorkPool::_thread_function(void *p_user) {
+    ThreadData *thread = static_cast<ThreadData *>(p_user);
+    tl_inside_pool_work = true;
+    while (true) {
+        thread->start.wait();
+        if (thread->exit.load(std::memory_order_acquire)) {
+            break;
+        }
+        thread->work->work();
+        thread->completed.post();
+    }
+}
+
+void ThreadWorkPool::_dispatch(BaseWork *p_work) {
+    if (p_work->max_elements == 0) {
+        return;
+    }
+    // Nested calls, calls made while another thread is using the pool, and single element loops run in place.
+    if (!threads || p_work->max_elements == 1 || tl_inside_pool_work || !dispatch_mutex.try_lock()) {
+        p_work->work();
+        return;
+    }
+    // no point in waking more workers than there are elements beyond the one processed by the caller.
+    const uint32_t to_wake = MIN(thread_count, p_work->max_elements - 1);
+    for (uint32_t i = 0; i < to_wake; i++) {
+        threads[i].work = p_work;
+        threads[i].start.post();
+    }
+
+    tl_inside_pool_work = true;
+    p_work->work();
+    tl_inside_pool_work = false;
+
+    for (uint32_t i = 0; i < to_wake; i++) {
+        threads[i].completed.wait();
+        threads[i].work = nullptr;
+    }
+    dispatch_mutex.unlock();
+}
+
+bool ThreadWorkPool::is_worker_thread() {
+    return tl_inside_pool_work;
+}
+
+void ThreadWorkPool::init(int p_thread_count) {
+    ERR_FAIL_COND(threads != nullptr);
+
+    if (p_thread_count < 0) {
+        p_thread_count = OS::get_singleton()->can_use_threads() ? OS::get_singleton()->get_processor_count() - 1 : 0;
+    }
+    if (p_thread_count <= 0) {
+        return;
+    }
+
+    thread_count = p_thread_count;
+    threads = memnew_arr(ThreadData, thread_count);
+
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads[i].thread.start(&ThreadWorkPool::_thread_function, &threads[i]);
+    }
+}
+
+void ThreadWorkPool::finish() {
+    if (threads == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(dispatch_mutex);
+
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads[i].exit.store(true, std::memory_order_release);
+        threads[i].start.post();
+    }
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads[i].thread.wait_to_finish();
+    }
+
+    memdelete_arr(threads);
+    threads = nullptr;
+    thread_count = 0;
+}
+
+ThreadWorkPool *ThreadWorkPool::get_singleton() {
+    return &s_engine_pool;
+}
+
+ThreadWorkPool::~ThreadWorkPool() {
+    finish();
+}
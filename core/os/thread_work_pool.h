@@ -0,0 +1,113 @@
+/*************************************************************************/
+/*  thread_work_pool.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#pragma once
+
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/godot_export.h"
+
+#include <atomic>
+#include <mutex>
+
+/// Persistent set of worker threads used to run data-parallel loops.
+/// Work is split into elements, every participating thread (including the caller) pulls the next unprocessed index
+/// until all elements are done. do_work blocks until the whole array has been processed.
+/// When the pool is busy, not initialized or do_work is called from inside a worker, the loop runs serially on the
+/// calling thread, so callers never have to special-case those situations.
+class GODOT_EXPORT ThreadWorkPool {
+
+    struct BaseWork {
+        std::atomic<uint32_t> index { 0 };
+        uint32_t max_elements = 0;
+        virtual void work() = 0;
+        virtual ~BaseWork() = default;
+    };
+
+    template <class C, class M, class U>
+    struct Work : public BaseWork {
+        C *instance;
+        M method;
+        U userdata;
+        void work() override {
+            while (true) {
+                uint32_t work_index = index.fetch_add(1, std::memory_order_relaxed);
+                if (work_index >= max_elements) {
+                    break;
+                }
+                (instance->*method)(work_index, userdata);
+            }
+        }
+    };
+
+    struct ThreadData {
+        Thread thread;
+        Semaphore start;
+        Semaphore completed;
+        std::atomic<bool> exit { false };
+        BaseWork *work = nullptr;
+    };
+
+    ThreadData *threads = nullptr;
+    uint32_t thread_count = 0;
+    std::mutex dispatch_mutex;
+
+    static void _thread_function(void *p_user);
+    void _dispatch(BaseWork *p_work);
+
+public:
+    template <class C, class M, class U>
+    void do_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
+        Work<C, M, U> w;
+        w.instance = p_instance;
+        w.method = p_method;
+        w.userdata = p_userdata;
+        w.max_elements = p_elements;
+        _dispatch(&w);
+    }
+
+    bool is_initialized() const { return threads != nullptr; }
+    //! Number of background workers, the calling thread always participates in addition to those.
+    uint32_t get_thread_count() const { return thread_count; }
+    //! Returns true when the caller is one of this pool's workers.
+    static bool is_worker_thread();
+
+    //! p_thread_count < 0 selects processor count - 1 workers.
+    void init(int p_thread_count = -1);
+    void finish();
+
+    //! Engine-wide pool, started after script languages are initialized, so workers can run script code.
+    static ThreadWorkPool *get_singleton();
+
+    ThreadWorkPool() = default;
+    ThreadWorkPool(const ThreadWorkPool &) = delete;
+    ThreadWorkPool &operator=(const ThreadWorkPool &) = delete;
+    ~ThreadWorkPool();
+};
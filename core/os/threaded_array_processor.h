@@ -30,57 +30,11 @@
 
 #pragma once
 
-#include "core/os/mutex.h"
-#include "core/os/os.h"
-#include "core/os/thread.h"
-#include "core/os/thread_safe.h"
-#include "core/safe_refcount.h"
-
-template <class C, class U>
-struct ThreadArrayProcessData {
-    uint32_t elements;
-    uint32_t index;
-    C *instance;
-    U userdata;
-    void (C::*method)(uint32_t, U);
-
-    void process(uint32_t p_index) {
-        (instance->*method)(p_index, userdata);
-    }
-};
-
-template <class T>
-void process_array_thread(void *ud) {
-
-    T &data = *(T *)ud;
-    while (true) {
-        uint32_t index = atomic_increment(&data.index);
-        if (index >= data.elements)
-            break;
-        data.process(index);
-    }
-}
+#include "core/os/thread_work_pool.h"
 
+/// Runs (p_instance->*p_method)(index, p_userdata) for every index in [0, p_elements) on the engine worker pool.
+/// Blocks until all elements are processed; falls back to a serial loop when the pool is unavailable.
 template <class C, class M, class U>
 void thread_process_array(uint32_t p_elements, C *p_instance, M p_method, U p_userdata) {
-
-    ThreadArrayProcessData<C, U> data;
-    data.method = p_method;
-    data.instance = p_instance;
-    data.userdata = p_userdata;
-    data.index = 0;
-    data.elements = p_elements;
-    data.process(data.index); //process first, let threads increment for next
-
-    FixedVector<Thread ,16,true> threads; // allow for more than 16 processors, but will heap alloc in that case
-
-    //threads.reserve(OS::get_singleton()->get_processor_count());
-
-    for (int i = 0; i < threads.size(); i++) {
-        threads.emplace_back().start(process_array_thread<ThreadArrayProcessData<C, U> >, &data);
-    }
-
-    for (int i = 0; i < threads.size(); i++) {
-        threads[i].wait_to_finish();
-    }
+    ThreadWorkPool::get_singleton()->do_work(p_elements, p_instance, p_method, p_userdata);
 }
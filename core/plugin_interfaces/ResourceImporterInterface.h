@@ -59,6 +59,8 @@ public:
     virtual Error import_group_file(StringView p_group_file,
             const Map<String, HashMap<StringName, Variant>> &p_source_file_options,
             const Map<String, String> &p_base_paths) = 0;
+    //! Importers returning true may run import() for several files at once from worker threads.
+    virtual bool can_import_threaded() const { return false; }
     virtual bool are_import_settings_valid(StringView p_path) const = 0;
     virtual String get_import_settings_string() const = 0;
     // Currently only implemented by ResourceImporterTexture
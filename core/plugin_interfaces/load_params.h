@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <atomic>
 
 enum class ImageUsedChannels : int8_t;
 
@@ -23,8 +24,26 @@ enum ImageCompressMode : int8_t {
     COMPRESS_BPTC,
     COMPRESS_MAX
 };
+//! Lets the caller of Image::compress_image follow and cancel a compression, backends update it from worker threads.
+//! Progress is counted in 4x4 blocks over all mip levels.
+struct CompressProgress {
+    std::atomic<uint32_t> blocks_done { 0 };
+    std::atomic<uint32_t> blocks_total { 0 };
+    std::atomic<bool> cancelled { false };
+
+    void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    bool is_cancelled() const { return cancelled.load(std::memory_order_relaxed); }
+    void add_done(uint32_t p_blocks) { blocks_done.fetch_add(p_blocks, std::memory_order_relaxed); }
+    float get_ratio() const {
+        uint32_t total = blocks_total.load(std::memory_order_relaxed);
+        return total ? float(blocks_done.load(std::memory_order_relaxed)) / float(total) : 0.0f;
+    }
+};
+
 struct CompressParams {
     float p_quality = 1.0;
     ImageCompressMode mode = COMPRESS_S3TC;
     ImageUsedChannels used_channels = ImageUsedChannels(0);
+    //! Optional, when cancelled the backend returns ERR_SKIP and leaves the image uncompressed.
+    CompressProgress *progress = nullptr;
 };
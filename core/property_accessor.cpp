@@ -0,0 +1,73 @@
+/*************************************************************************/
+/*  property_accessor.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "property_accessor.h"
+
+#include "core/object.h"
+#include "core/object_tooling.h"
+
+const ClassDB::PropertySetGet *PropertyAccessor::_resolve(const Object *p_object) {
+    const StringName &cls(p_object->get_class_name());
+    if (cls != resolved_class) {
+        resolved_class = cls;
+        setget = ClassDB::get_property_setget(cls, property);
+    }
+    return setget;
+}
+
+void PropertyAccessor::set_property(const StringName &p_property) {
+    property = p_property;
+    resolved_class = StringName();
+    setget = nullptr;
+}
+
+void PropertyAccessor::set(Object *p_object, const Variant &p_value, bool *r_valid) {
+    // script instances get the first chance to handle a property, same as in Object::set
+    const ClassDB::PropertySetGet *psg = p_object->get_script_instance() ? nullptr : _resolve(p_object);
+    if (!psg) {
+        p_object->set(property, p_value, r_valid);
+        return;
+    }
+    Object_set_edited(p_object, true, false);
+    ClassDB::set_property_with(p_object, *psg, p_value, r_valid);
+}
+
+Variant PropertyAccessor::get(const Object *p_object, bool *r_valid) {
+    const ClassDB::PropertySetGet *psg = p_object->get_script_instance() ? nullptr : _resolve(p_object);
+    if (!psg) {
+        return p_object->get(property, r_valid);
+    }
+    Variant ret;
+    ClassDB::get_property_with(const_cast<Object *>(p_object), *psg, ret);
+    if (r_valid) {
+        *r_valid = true;
+    }
+    return ret;
+}
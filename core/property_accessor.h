@@ -0,0 +1,59 @@
+/*************************************************************************/
+/*  property_accessor.h                                                  */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#pragma once
+
+#include "core/class_db.h"
+#include "core/string_name.h"
+
+class Object;
+class Variant;
+
+/// Inline cache for repeated get/set of a single property.
+/// The native setter/getter is resolved once per object class and reused for as long as the accessed objects keep
+/// having the same class; objects with a script instance, or properties not known to ClassDB, go through
+/// Object::set/Object::get so the observable behavior is identical.
+class GODOT_EXPORT PropertyAccessor {
+    StringName property;
+    StringName resolved_class;
+    const ClassDB::PropertySetGet *setget = nullptr;
+
+    const ClassDB::PropertySetGet *_resolve(const Object *p_object);
+
+public:
+    void set_property(const StringName &p_property);
+    const StringName &get_property() const { return property; }
+
+    void set(Object *p_object, const Variant &p_value, bool *r_valid = nullptr);
+    Variant get(const Object *p_object, bool *r_valid = nullptr);
+
+    PropertyAccessor() = default;
+    explicit PropertyAccessor(const StringName &p_property) : property(p_property) {}
+};
@@ -20,7 +20,13 @@
 #include "core/pool_vector.h"
 #include "core/dictionary.h"
 
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
 #include "EASTL/deque.h"
+
+#include <condition_variable>
+#include <mutex>
 /// Note: resource manager private data is using default 'new'/'delete'
 namespace {
 struct ResourceManagerPriv {
@@ -257,6 +263,355 @@ String normalized_resource_path(StringView path) {
     return ProjectSettings::get_singleton()->localize_path(path);
 
 }
+
+/// Background loading started with ResourceManager::load_threaded_request.
+/// A request first scans the resource's dependencies (on a worker), every dependency that is not cached becomes a
+/// task of its own, and the resource itself is loaded once all of them finished, at which point its loader finds
+/// them in the ResourceCache. Tasks are keyed by local path, so the same resource is never loaded twice concurrently.
+class ThreadedResourceLoader {
+public:
+    using Status = ResourceManager::ThreadLoadStatus;
+
+private:
+    struct Task {
+        enum Stage {
+            STAGE_SCAN,
+            STAGE_WAIT_DEPENDENCIES,
+            STAGE_LOAD,
+            STAGE_DONE,
+        };
+        String local_path;
+        String type_hint;
+        RES resource;
+        Vector<Task *> dependencies; // tasks this one waits for, it holds them alive
+        Vector<Task *> dependents;
+        int priority = 0;
+        int user_requests = 0; // load_threaded_request calls not yet matched by a get or cancel
+        int holders = 0; // dependents which still need this task
+        int total_dependencies = 0;
+        int pending_dependencies = 0;
+        Error error = OK;
+        Stage stage = STAGE_SCAN;
+        bool queued = false;
+        bool running = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable work_cond;
+    std::condition_variable done_cond;
+    HashMap<String, Task *> tasks;
+    Vector<Task *> queue;
+    Vector<Thread *> threads;
+    bool exit = false;
+    bool started = false;
+
+    static thread_local bool tl_loading_task;
+
+    Task *_pop_task() {
+        if (queue.empty())
+            return nullptr;
+        // Highest priority first, FIFO between equal priorities.
+        size_t best = 0;
+        for (size_t i = 1; i < queue.size(); i++) {
+            if (queue[i]->priority > queue[best]->priority)
+                best = i;
+        }
+        Task *task = queue[best];
+        queue.erase(queue.begin() + best);
+        task->queued = false;
+        return task;
+    }
+
+    void _enqueue(Task *p_task) {
+        p_task->queued = true;
+        queue.push_back(p_task);
+        work_cond.notify_one();
+    }
+
+    static bool _depends_on(const Task *p_task, const Task *p_other) {
+        if (p_task == p_other)
+            return true;
+        for (const Task *dep : p_task->dependencies) {
+            if (_depends_on(dep, p_other))
+                return true;
+        }
+        return false;
+    }
+
+    // Frees the task once neither the user nor another task needs it, releasing its own dependencies.
+    void _try_free(Task *p_task) {
+        if (p_task->user_requests > 0 || p_task->holders > 0 || p_task->running)
+            return;
+        if (p_task->queued) {
+            queue.erase_first(p_task);
+            p_task->queued = false;
+        }
+        _release_dependencies(p_task);
+        for (Task *dependent : p_task->dependents) {
+            dependent->dependencies.erase_first(p_task);
+        }
+        tasks.erase(p_task->local_path);
+        memdelete(p_task);
+    }
+
+    void _release_dependencies(Task *p_task) {
+        Vector<Task *> deps(eastl::move(p_task->dependencies));
+        p_task->dependencies.clear();
+        for (Task *dep : deps) {
+            dep->dependents.erase_first(p_task);
+            dep->holders--;
+            _try_free(dep);
+        }
+    }
+
+    void _finish(Task *p_task) {
+        p_task->stage = Task::STAGE_DONE;
+        for (Task *dependent : p_task->dependents) {
+            if (--dependent->pending_dependencies == 0 && dependent->stage == Task::STAGE_WAIT_DEPENDENCIES) {
+                dependent->stage = Task::STAGE_LOAD;
+                _enqueue(dependent);
+            }
+        }
+        _release_dependencies(p_task);
+        done_cond.notify_all();
+    }
+
+    Task *_create_task(const String &p_local_path, StringView p_type_hint, int p_priority) {
+        Task *task = memnew(Task);
+        task->local_path = p_local_path;
+        task->type_hint = p_type_hint;
+        task->priority = p_priority;
+        tasks[p_local_path] = task;
+        return task;
+    }
+
+    // Called with the lock held, which is released while the actual file work happens.
+    void _run(Task *p_task, std::unique_lock<std::mutex> &p_lock) {
+        p_task->running = true;
+        const String path = p_task->local_path;
+        const bool was_loading = tl_loading_task;
+        tl_loading_task = true;
+
+        if (p_task->stage == Task::STAGE_SCAN) {
+            p_lock.unlock();
+            Vector<String> deps;
+            gResourceManager().get_dependencies(path, deps);
+            p_lock.lock();
+            tl_loading_task = was_loading;
+            p_task->running = false;
+
+            if (p_task->user_requests == 0 && p_task->holders == 0) {
+                _try_free(p_task); // cancelled meanwhile.
+                return;
+            }
+            for (const String &dep_path : deps) {
+                String local_dep = normalized_resource_path(dep_path);
+                if (ResourceCache::has(local_dep))
+                    continue;
+                Task *dep;
+                auto iter = tasks.find(local_dep);
+                if (iter == tasks.end()) {
+                    dep = _create_task(local_dep, StringView(), p_task->priority);
+                    _enqueue(dep);
+                } else {
+                    dep = iter->second;
+                    // Cyclic references are left for the loaders to report.
+                    if (dep->stage == Task::STAGE_DONE || _depends_on(dep, p_task) || p_task->dependencies.contains(dep))
+                        continue;
+                }
+                dep->holders++;
+                dep->dependents.push_back(p_task);
+                p_task->dependencies.push_back(dep);
+                p_task->pending_dependencies++;
+            }
+            p_task->total_dependencies = p_task->dependencies.size();
+            if (p_task->pending_dependencies > 0) {
+                p_task->stage = Task::STAGE_WAIT_DEPENDENCIES;
+            } else {
+                p_task->stage = Task::STAGE_LOAD;
+                _enqueue(p_task);
+            }
+            done_cond.notify_all();
+            return;
+        }
+
+        const String type_hint = p_task->type_hint;
+        p_lock.unlock();
+        Error err = OK;
+        RES res = gResourceManager().load(path, type_hint, false, &err);
+        p_lock.lock();
+        tl_loading_task = was_loading;
+
+        p_task->running = false;
+        p_task->resource = res;
+        p_task->error = res ? OK : (err != OK ? err : FAILED);
+        _finish(p_task);
+        _try_free(p_task);
+    }
+
+    static void _thread_func(void *p_user) {
+        ThreadedResourceLoader *self = static_cast<ThreadedResourceLoader *>(p_user);
+        std::unique_lock<std::mutex> lock(self->mutex);
+        while (!self->exit) {
+            Task *task = self->_pop_task();
+            if (!task) {
+                self->work_cond.wait(lock);
+                continue;
+            }
+            self->_run(task, lock);
+        }
+    }
+
+    void _start_threads() {
+        started = true;
+        if (!OS::get_singleton()->can_use_threads())
+            return; // Everything runs on the thread calling load_threaded_get.
+        int count = M_MAX(1, OS::get_singleton()->get_processor_count() - 1);
+        threads.reserve(count);
+        for (int i = 0; i < count; i++) {
+            Thread *thread = memnew(Thread);
+            thread->start(&ThreadedResourceLoader::_thread_func, this);
+            threads.push_back(thread);
+        }
+    }
+
+public:
+    Error request(StringView p_path, StringView p_type_hint, int p_priority) {
+        String local_path = normalized_resource_path(p_path);
+        std::unique_lock<std::mutex> lock(mutex);
+        ERR_FAIL_COND_V_MSG(exit, ERR_UNAVAILABLE, "Threaded resource loading was already shut down.");
+        if (!started)
+            _start_threads();
+
+        auto iter = tasks.find(local_path);
+        if (iter != tasks.end()) {
+            Task *task = iter->second;
+            task->user_requests++;
+            task->priority = M_MAX(task->priority, p_priority);
+            return OK;
+        }
+
+        Task *task = _create_task(local_path, p_type_hint, p_priority);
+        task->user_requests = 1;
+        if (Resource *cached = ResourceCache::get(local_path)) {
+            task->resource = RES(cached);
+        }
+        if (task->resource) {
+            task->stage = Task::STAGE_DONE;
+        } else {
+            _enqueue(task);
+        }
+        return OK;
+    }
+
+    Status get_status(StringView p_path, float *r_progress) {
+        String local_path = normalized_resource_path(p_path);
+        std::unique_lock<std::mutex> lock(mutex);
+        auto iter = tasks.find(local_path);
+        if (iter == tasks.end() || iter->second->user_requests == 0) {
+            if (r_progress)
+                *r_progress = 0;
+            return ResourceManager::THREAD_LOAD_INVALID_RESOURCE;
+        }
+        const Task *task = iter->second;
+        if (task->stage == Task::STAGE_DONE) {
+            if (r_progress)
+                *r_progress = 1.0f;
+            return task->resource ? ResourceManager::THREAD_LOAD_LOADED : ResourceManager::THREAD_LOAD_FAILED;
+        }
+        if (r_progress) {
+            int done = task->total_dependencies - task->pending_dependencies;
+            *r_progress = float(done) / float(task->total_dependencies + 1);
+        }
+        return ResourceManager::THREAD_LOAD_IN_PROGRESS;
+    }
+
+    RES get(StringView p_path, Error *r_error) {
+        String local_path = normalized_resource_path(p_path);
+        std::unique_lock<std::mutex> lock(mutex);
+        auto iter = tasks.find(local_path);
+        if (iter == tasks.end() || iter->second->user_requests == 0) {
+            if (r_error)
+                *r_error = ERR_INVALID_PARAMETER;
+            ERR_FAIL_V_MSG(RES(), "Resource '" + local_path + "' was not requested with load_threaded_request.");
+        }
+        Task *task = iter->second;
+        // Keeps the task alive while waiting, the caller helps with queued work instead of idling.
+        task->user_requests++;
+        while (task->stage != Task::STAGE_DONE) {
+            if (Task *work = _pop_task())
+                _run(work, lock);
+            else
+                done_cond.wait(lock);
+        }
+        RES res = task->resource;
+        if (r_error)
+            *r_error = task->error;
+        task->user_requests -= 2;
+        _try_free(task);
+        return res;
+    }
+
+    void cancel(StringView p_path) {
+        String local_path = normalized_resource_path(p_path);
+        std::unique_lock<std::mutex> lock(mutex);
+        auto iter = tasks.find(local_path);
+        if (iter == tasks.end() || iter->second->user_requests == 0)
+            return;
+        iter->second->user_requests--;
+        _try_free(iter->second);
+    }
+
+    //! Used by the blocking ResourceManager::load, waits for a load of the same path that is already running
+    //! instead of loading it a second time. Loader threads never wait here, which rules out cyclic waits.
+    RES wait_in_flight(const String &p_local_path, Error *r_error, bool &r_found) {
+        r_found = false;
+        if (tl_loading_task)
+            return RES();
+        std::unique_lock<std::mutex> lock(mutex);
+        auto iter = tasks.find(p_local_path);
+        if (iter == tasks.end() || iter->second->stage != Task::STAGE_LOAD || !iter->second->running)
+            return RES();
+        Task *task = iter->second;
+        task->holders++;
+        while (task->stage != Task::STAGE_DONE) {
+            done_cond.wait(lock);
+        }
+        RES res = task->resource;
+        if (r_error)
+            *r_error = task->error;
+        task->holders--;
+        _try_free(task);
+        r_found = true;
+        return res;
+    }
+
+    void finish() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (exit)
+                return;
+            exit = true;
+        }
+        work_cond.notify_all();
+        for (Thread *thread : threads) {
+            thread->wait_to_finish();
+            memdelete(thread);
+        }
+        threads.clear();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (auto &E : tasks) {
+            memdelete(E.second);
+        }
+        tasks.clear();
+        queue.clear();
+    }
+};
+
+thread_local bool ThreadedResourceLoader::tl_loading_task = false;
+
+ThreadedResourceLoader s_threaded_loader;
 } // end of anonymous namespace
 
 
@@ -541,6 +896,14 @@ RES ResourceManager::load(StringView p_path, StringView p_type_hint, bool p_no_c
             }
         }
         ResourceCache::lock.read_unlock();
+
+        // Another thread is loading the same resource in the background, share its result instead of loading twice.
+        bool in_flight = false;
+        RES res(s_threaded_loader.wait_in_flight(local_path, r_error, in_flight));
+        if (in_flight) {
+            D()->_remove_from_loading_map(local_path);
+            return res;
+        }
     }
 
     bool xl_remapped = false;
@@ -590,6 +953,26 @@ RES ResourceManager::load(StringView p_path, StringView p_type_hint, bool p_no_c
     return res;
 }
 
+Error ResourceManager::load_threaded_request(StringView p_path, StringView p_type_hint, int p_priority) {
+    return s_threaded_loader.request(p_path, p_type_hint, p_priority);
+}
+
+ResourceManager::ThreadLoadStatus ResourceManager::load_threaded_get_status(StringView p_path, float *r_progress) {
+    return s_threaded_loader.get_status(p_path, r_progress);
+}
+
+RES ResourceManager::load_threaded_get(StringView p_path, Error *r_error) {
+    return s_threaded_loader.get(p_path, r_error);
+}
+
+void ResourceManager::load_threaded_cancel(StringView p_path) {
+    s_threaded_loader.cancel(p_path);
+}
+
+void ResourceManager::finish_threaded_loading() {
+    s_threaded_loader.finish();
+}
+
 RES ResourceManager::load_internal(StringView p_path, StringView p_original_path, StringView p_type_hint, bool p_no_cache, Error* r_error)
 {
     return D()->_load(p_path, p_original_path, p_type_hint, p_no_cache, r_error);
@@ -972,6 +1355,7 @@ void ResourceManager::initialize() {
 
 void ResourceManager::finalize()
 {
+    s_threaded_loader.finish();
     for (const auto& e : D()->loading_map) {
         ERR_PRINT("Exited while resource is being loaded: " + e.first.path);
     }
@@ -50,6 +50,12 @@ public:
         FLAG_COMPRESS = 32,
         FLAG_REPLACE_SUBRESOURCE_PATHS = 64,
     };
+    enum ThreadLoadStatus {
+        THREAD_LOAD_INVALID_RESOURCE,
+        THREAD_LOAD_IN_PROGRESS,
+        THREAD_LOAD_FAILED,
+        THREAD_LOAD_LOADED,
+    };
 
     void set_timestamp_on_save(bool p_timestamp) { timestamp_on_save = p_timestamp; }
     bool get_timestamp_on_save() const { return timestamp_on_save; }
@@ -81,6 +87,15 @@ public:
     Ref<T> loadT(StringView p_path, StringView p_type_hint = StringView(), bool p_no_cache = false, Error* r_error = nullptr) {
         return dynamic_ref_cast<T>(load(p_path,p_type_hint,p_no_cache,r_error));
     }
+    //! Starts loading p_path in the background, its uncached dependencies are loaded in parallel first.
+    //! Every successful request has to be matched by a load_threaded_get or load_threaded_cancel call.
+    Error load_threaded_request(StringView p_path, StringView p_type_hint = StringView(), int p_priority = 0);
+    ThreadLoadStatus load_threaded_get_status(StringView p_path, float *r_progress = nullptr);
+    //! Blocks until the requested resource is loaded, the calling thread helps with the queued work meanwhile.
+    RES load_threaded_get(StringView p_path, Error *r_error = nullptr);
+    void load_threaded_cancel(StringView p_path);
+    //! Stops the loader threads, pending requests are dropped. Called before script languages are shut down.
+    void finish_threaded_loading();
     // TODO: Only used in ResourceFormatImporter::load, try to remove this from the public interface.
     RES load_internal(StringView p_path, StringView p_original_path, StringView p_type_hint = StringView(), bool p_no_cache = false, Error* r_error = nullptr);
     bool exists(StringView p_path, StringView p_type_hint = StringView());
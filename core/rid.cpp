@@ -40,9 +40,7 @@ void RID_OwnerBase::get_owned_list(Vector<RID> *p_owned) {
 #ifdef DEBUG_ENABLED
 
     for (RID_Data *iter : id_map) {
-        RID r;
-        _set_data(r, iter);
-        p_owned->push_back(r);
+        p_owned->push_back(_make_handle(iter));
     }
 #endif
 }
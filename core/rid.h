@@ -34,18 +34,20 @@
 #include "core/safe_refcount.h"
 #include "core/hash_set.h"
 #include "core/error_macros.h"
+#include "core/vector.h"
 #include "entt/fwd.hpp"
 #include "entt/entity/entity.hpp"
 
+#include <cstddef>
+#include <type_traits>
+
 class RID_OwnerBase;
 
 class GODOT_EXPORT RID_Data {
 
     friend class RID_OwnerBase;
 
-#ifndef DEBUG_ENABLED
-    RID_OwnerBase *_owner;
-#endif
+    RID_OwnerBase *_owner = nullptr;
     uint32_t _id;
 
 public:
@@ -62,18 +64,24 @@ class GODOT_EXPORT RID {
 public:
     entt::entity eid { entt::null };
 
+private:
+    // copy of the data id at creation, lets RID_Alloc reject handles to a slot that was freed and reused.
+    uint32_t _validator = 0;
+
+public:
     RID_Data *get_data() const { return _data; }
 
     constexpr bool operator==(RID p_rid) const {
-        return _data == p_rid._data;
+        return _data == p_rid._data && _validator == p_rid._validator;
     }
     bool operator!=(RID p_rid) const {
-        return _data != p_rid._data;
+        return !(*this == p_rid);
     }
     bool operator<(RID p_rid) const {
-        return _data < p_rid._data;
+        return _data == p_rid._data ? _validator < p_rid._validator : _data < p_rid._data;
     }
     bool is_valid() const { return _data != nullptr; }
+    uint32_t get_id_validator() const { return _validator; }
     uint32_t get_id() const { return _data ? _data->get_id() : 0; }
 };
 
@@ -83,7 +91,7 @@ struct hash<RID> {
     size_t operator()(const RID &np) const {
         size_t val1 = eastl::hash<ENTT_ID_TYPE>()(to_integral(np.eid));
         size_t val2 = intptr_t(np.get_data())/next_power_of_2(sizeof(RID_Data));
-        return val1 ^ (val2 <<16);
+        return val1 ^ (val2 <<16) ^ np.get_id_validator();
     }
 
 };
@@ -100,10 +108,17 @@ protected:
         p_rid._data = p_data;
         refcount.ref();
         p_data->_id = refcount.get();
-#ifndef DEBUG_ENABLED
+        p_rid._validator = p_data->_id;
         p_data->_owner = this;
-#endif
     }
+    //! Builds a handle to already registered data, without assigning a new id.
+    static _FORCE_INLINE_ RID _make_handle(RID_Data *p_data) {
+        RID rid;
+        rid._data = p_data;
+        rid._validator = p_data->_id;
+        return rid;
+    }
+    static _FORCE_INLINE_ const RID_OwnerBase *_get_owner(const RID_Data *p_data) { return p_data->_owner; }
 
 #ifndef DEBUG_ENABLED
 
@@ -185,3 +200,137 @@ public:
     }
 
 };
+
+/// Owner that also allocates the objects it hands out RIDs for.
+/// Objects are constructed in place in fixed size pages which are only released with the allocator, so live objects
+/// stay close together in memory and a stale RID still points at readable memory. Every slot keeps the validator of
+/// its current object, which makes owns()/getornull() O(1) and lock free in all builds, and rejects RIDs to objects
+/// that were freed, even after their slot got reused.
+/// Like RID_Owner, creation and freeing are not thread safe.
+template <class T, uint32_t PAGE_SIZE = 256>
+class RID_Alloc : public RID_OwnerBase {
+
+    struct Slot {
+        uint32_t validator; // 0 while the slot is free
+        uint32_t index;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T *object() { return reinterpret_cast<T *>(&storage); }
+    };
+
+    Slot **pages = nullptr;
+    uint32_t page_count = 0;
+    uint32_t used_slots = 0; // slots handed out at least once, always a prefix of the page storage
+    uint32_t alive_count = 0;
+    Vector<uint32_t> free_slots;
+
+    static _FORCE_INLINE_ Slot *_get_slot(const RID_Data *p_data) {
+        const uint8_t *object = reinterpret_cast<const uint8_t *>(static_cast<const T *>(p_data));
+        return const_cast<Slot *>(reinterpret_cast<const Slot *>(object - offsetof(Slot, storage)));
+    }
+
+public:
+    RID make_rid() {
+
+        uint32_t index;
+        if (!free_slots.empty()) {
+            index = free_slots.back();
+            free_slots.pop_back();
+        } else {
+            if (used_slots == page_count * PAGE_SIZE) {
+                pages = (Slot **)memrealloc(pages, sizeof(Slot *) * (page_count + 1));
+                pages[page_count++] = (Slot *)memalloc(sizeof(Slot) * PAGE_SIZE);
+            }
+            index = used_slots++;
+        }
+
+        Slot &slot = pages[index / PAGE_SIZE][index % PAGE_SIZE];
+        T *object = memnew_placement(&slot.storage, T);
+
+        RID rid;
+        _set_data(rid, object);
+        slot.validator = rid.get_id_validator();
+        slot.index = index;
+        alive_count++;
+        return rid;
+    }
+
+    _FORCE_INLINE_ bool owns(const RID &p_rid) const {
+
+        const RID_Data *data = p_rid.get_data();
+        if (data == nullptr || _get_owner(data) != this)
+            return false;
+        return _get_slot(data)->validator == p_rid.get_id_validator();
+    }
+
+    T *get(const RID &p_rid) const {
+
+        ERR_FAIL_COND_V(!p_rid.is_valid(), nullptr);
+        ERR_FAIL_COND_V(!owns(p_rid), nullptr);
+        return static_cast<T *>(p_rid.get_data());
+    }
+
+    _FORCE_INLINE_ T *getornull(const RID &p_rid) const {
+
+        if (!owns(p_rid)) {
+#ifdef DEBUG_ENABLED
+            ERR_FAIL_COND_V(p_rid.get_data(), nullptr);
+#endif
+            return nullptr;
+        }
+        return static_cast<T *>(p_rid.get_data());
+    }
+
+    T *getptr(const RID &p_rid) const {
+
+        return owns(p_rid) ? static_cast<T *>(p_rid.get_data()) : nullptr;
+    }
+
+    //! Destroys the object and recycles its slot, any remaining copies of p_rid stop being owned.
+    void free(const RID &p_rid) {
+
+        ERR_FAIL_COND(!owns(p_rid));
+        T *object = static_cast<T *>(p_rid.get_data());
+        Slot *slot = _get_slot(object);
+        slot->validator = 0;
+        object->~T();
+        free_slots.push_back(slot->index);
+        alive_count--;
+    }
+
+    uint32_t get_rid_count() const { return alive_count; }
+
+    //! Calls p_func(T *) for every live object, in storage order.
+    template <class F>
+    void for_each(F p_func) {
+        for (uint32_t i = 0; i < used_slots; i++) {
+            Slot &slot = pages[i / PAGE_SIZE][i % PAGE_SIZE];
+            if (slot.validator) {
+                p_func(slot.object());
+            }
+        }
+    }
+
+    void get_owned_list(Vector<RID> *p_owned) {
+        for_each([p_owned](T *p_object) {
+            p_owned->push_back(_make_handle(p_object));
+        });
+    }
+
+    RID_Alloc() = default;
+    RID_Alloc(const RID_Alloc &) = delete;
+    RID_Alloc &operator=(const RID_Alloc &) = delete;
+
+    ~RID_Alloc() override {
+        // leaked objects are not destructed, same as with RID_Owner, only their storage is released.
+        if (alive_count) {
+            ERR_PRINT("RID_Alloc destroyed while still owning objects, they were leaked.");
+        }
+        for (uint32_t i = 0; i < page_count; i++) {
+            memfree(pages[i]);
+        }
+        if (pages) {
+            memfree(pages);
+        }
+    }
+};
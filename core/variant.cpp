@@ -62,11 +62,134 @@
 
 #include "EASTL/sort.h"
 
+#include <mutex>
+#include <type_traits>
+
 template class EXPORT_TEMPLATE_DEFINE(GODOT_EXPORT) eastl::vector<Variant, wrap_allocator>;
 
 const Variant Variant::null_variant;
 const Vector<Variant> null_variant_pvec;
 
+namespace {
+/// Storage for the math types Variant keeps on the heap (Transform2D, AABB, Basis, Transform).
+/// All of them share fixed size blocks. Every thread keeps a private free list, so creating and destroying a payload
+/// normally takes no lock; blocks move between threads and the shared list in batches, which also lets a payload be
+/// freed on another thread than the one that created it. Slabs are never returned to the system.
+class VariantPayloadPool {
+    union Block {
+        Block *next;
+        alignas(Transform) uint8_t mem[sizeof(Transform)];
+    };
+    static_assert(sizeof(Transform2D) <= sizeof(Block) && sizeof(::AABB) <= sizeof(Block) && sizeof(Basis) <= sizeof(Block),
+            "Variant payload does not fit the pool block");
+
+    enum {
+        BATCH_SIZE = 64, // blocks moved between a thread and the shared list at once
+        MAX_CACHED = 512, // a thread's free list is trimmed back to half of this
+        SLAB_BLOCKS = 1024,
+    };
+
+    struct Shared {
+        std::mutex mutex;
+        Block *free_list = nullptr;
+    };
+
+    // trivially destructible, so it stays usable while thread local Variants are destroyed at thread exit
+    struct Cache {
+        Block *head;
+        uint32_t count;
+    };
+
+    struct CacheFlusher {
+        ~CacheFlusher() {
+            Cache &cache = _get_cache();
+            if (cache.count) {
+                _release(cache, cache.count);
+            }
+        }
+    };
+
+    static Shared &_get_shared() {
+        // never destroyed, Variants with static storage may outlive any other static
+        static Shared *shared = memnew(Shared);
+        return *shared;
+    }
+
+    static _FORCE_INLINE_ Cache &_get_cache() {
+        static thread_local Cache cache = { nullptr, 0 };
+        return cache;
+    }
+
+    static void _register_flusher() {
+        static thread_local CacheFlusher flusher;
+        (void)flusher;
+    }
+
+    static void _refill(Cache &r_cache) {
+        _register_flusher();
+        Shared &shared = _get_shared();
+        std::lock_guard<std::mutex> guard(shared.mutex);
+        if (!shared.free_list) {
+            Block *slab = (Block *)memalloc(sizeof(Block) * SLAB_BLOCKS);
+            for (int i = 0; i < SLAB_BLOCKS - 1; i++) {
+                slab[i].next = &slab[i + 1];
+            }
+            slab[SLAB_BLOCKS - 1].next = nullptr;
+            shared.free_list = slab;
+        }
+        for (int i = 0; i < BATCH_SIZE && shared.free_list; i++) {
+            Block *block = shared.free_list;
+            shared.free_list = block->next;
+            block->next = r_cache.head;
+            r_cache.head = block;
+            r_cache.count++;
+        }
+    }
+
+    static void _release(Cache &r_cache, uint32_t p_count) {
+        Block *first = r_cache.head;
+        Block *last = first;
+        for (uint32_t i = 1; i < p_count; i++) {
+            last = last->next;
+        }
+        r_cache.head = last->next;
+        r_cache.count -= p_count;
+
+        Shared &shared = _get_shared();
+        std::lock_guard<std::mutex> guard(shared.mutex);
+        last->next = shared.free_list;
+        shared.free_list = first;
+    }
+
+public:
+    template <class T>
+    static T *create(const T &p_value) {
+        Cache &cache = _get_cache();
+        if (unlikely(!cache.head)) {
+            _refill(cache);
+        }
+        Block *block = cache.head;
+        cache.head = block->next;
+        cache.count--;
+        return memnew_placement(block->mem, T(p_value));
+    }
+
+    template <class T>
+    static void destroy(T *p_value) {
+        static_assert(std::is_trivially_destructible<T>::value, "pooled Variant payloads are not destructed");
+        Cache &cache = _get_cache();
+        Block *block = reinterpret_cast<Block *>(p_value);
+        block->next = cache.head;
+        cache.head = block;
+        cache.count++;
+        if (unlikely(cache.count > MAX_CACHED)) {
+            _register_flusher();
+            _release(cache, cache.count - MAX_CACHED / 2);
+        }
+    }
+};
+} // namespace
+
 const char *Variant::get_type_name(VariantType p_type) {
     switch (p_type) {
         case VariantType::NIL:
@@ -775,7 +898,7 @@ void Variant::reference(const Variant &p_variant) {
             memnew_placement(_data._mem, Rect2(*reinterpret_cast<const Rect2 *>(p_variant._data._mem)));
         } break;
         case VariantType::TRANSFORM2D: {
-            _data._transform2d = memnew(Transform2D(*p_variant._data._transform2d));
+            _data._transform2d = VariantPayloadPool::create(*p_variant._data._transform2d);
         } break;
         case VariantType::VECTOR3: {
             memnew_placement(_data._mem, Vector3(*reinterpret_cast<const Vector3 *>(p_variant._data._mem)));
@@ -785,18 +908,18 @@ void Variant::reference(const Variant &p_variant) {
         } break;
 
         case VariantType::AABB: {
-            _data._aabb = memnew(::AABB(*p_variant._data._aabb));
+            _data._aabb = VariantPayloadPool::create(*p_variant._data._aabb);
         } break;
         case VariantType::QUAT: {
             memnew_placement(_data._mem, Quat(*reinterpret_cast<const Quat *>(p_variant._data._mem)));
 
         } break;
         case VariantType::BASIS: {
-            _data._basis = memnew(Basis(*p_variant._data._basis));
+            _data._basis = VariantPayloadPool::create(*p_variant._data._basis);
 
         } break;
         case VariantType::TRANSFORM: {
-            _data._transform = memnew(Transform(*p_variant._data._transform));
+            _data._transform = VariantPayloadPool::create(*p_variant._data._transform);
         } break;
 
         // misc types
@@ -932,16 +1055,16 @@ void Variant::clear() {
         VariantType::RECT2
     */
         case VariantType::TRANSFORM2D: {
-            memdelete(_data._transform2d);
+            VariantPayloadPool::destroy(_data._transform2d);
         } break;
         case VariantType::AABB: {
-            memdelete(_data._aabb);
+            VariantPayloadPool::destroy(_data._aabb);
         } break;
         case VariantType::BASIS: {
-            memdelete(_data._basis);
+            VariantPayloadPool::destroy(_data._basis);
         } break;
         case VariantType::TRANSFORM: {
-            memdelete(_data._transform);
+            VariantPayloadPool::destroy(_data._transform);
         } break;
 
         // misc types
@@ -2065,12 +2188,12 @@ Variant::Variant(const Plane &p_plane) {
 }
 Variant::Variant(const ::AABB &p_aabb) {
     type = VariantType::AABB;
-    _data._aabb = memnew(::AABB(p_aabb));
+    _data._aabb = VariantPayloadPool::create(p_aabb);
 }
 
 Variant::Variant(const Basis &p_matrix) {
     type = VariantType::BASIS;
-    _data._basis = memnew(Basis(p_matrix));
+    _data._basis = VariantPayloadPool::create(p_matrix);
 }
 
 Variant::Variant(const Quat &p_quat) {
@@ -2079,12 +2202,12 @@ Variant::Variant(const Quat &p_quat) {
 }
 Variant::Variant(const Transform &p_transform) {
     type = VariantType::TRANSFORM;
-    _data._transform = memnew(Transform(p_transform));
+    _data._transform = VariantPayloadPool::create(p_transform);
 }
 
 Variant::Variant(const Transform2D &p_transform) {
     type = VariantType::TRANSFORM2D;
-    _data._transform2d = memnew(Transform2D(p_transform));
+    _data._transform2d = VariantPayloadPool::create(p_transform);
 }
 Variant::Variant(const Color &p_color) {
     type = VariantType::COLOR;
@@ -59,60 +59,95 @@
 
 struct StreamFile : public VariantParserStream {
 
+    enum {
+        READAHEAD_SIZE = 65536
+    };
+
     FileAccess *f;
+    // start of the current window and its offset in f; the window is either a mapped range of f or the readahead.
+    const char *window = nullptr;
+    uint64_t window_offset = 0;
+    char readahead[READAHEAD_SIZE];
 
-    char get_char() override;
     bool is_utf8() const override;
-    bool is_eof() const override;
+    uint64_t get_position() const override;
 
     StreamFile(FileAccess *fl = nullptr) : f(fl) {}
+
+protected:
+    char _refill() override;
 };
 
 struct StreamString : public VariantParserStream {
 
     String s;
-    int pos=0;
 
-    char get_char() override;
     bool is_utf8() const override;
-    bool is_eof() const override;
+    uint64_t get_position() const override;
 
-    StreamString(const String &str) : s(str) {}
-    StreamString(String &&str) noexcept : s(eastl::move(str)) {}
+    StreamString(const String &str) : s(str) { _reset_window(); }
+    StreamString(String &&str) noexcept : s(eastl::move(str)) { _reset_window(); }
+
+protected:
+    char _refill() override;
+    void _reset_window() {
+        read_pos = s.data();
+        read_end = s.data() + s.size();
+    }
 };
 
-char StreamFile::get_char() {
+char StreamFile::_refill() {
 
-    return f->get_8();
+    if (eof) {
+        return 0;
+    }
+    window_offset = f->get_position();
+    const uint64_t len = f->get_len();
+    const size_t remaining = len > window_offset ? size_t(len - window_offset) : 0;
+    // Mapped files hand out the whole remainder at once, everything else goes through the readahead buffer.
+    const uint8_t *mapped = remaining ? f->get_mapped_range(window_offset, remaining) : nullptr;
+    size_t available;
+    if (mapped) {
+        f->seek(window_offset + remaining);
+        window = reinterpret_cast<const char *>(mapped);
+        available = remaining;
+    } else {
+        window = readahead;
+        available = size_t(f->get_buffer(reinterpret_cast<uint8_t *>(readahead), READAHEAD_SIZE));
+    }
+    if (available == 0) {
+        // You need to try to read again when you have reached the end for EOF to be reported, like FileAccess::get_8.
+        eof = true;
+        read_pos = read_end = window;
+        return 0;
+    }
+    read_pos = window + 1;
+    read_end = window + available;
+    return window[0];
 }
 
 bool StreamFile::is_utf8() const {
 
     return true;
 }
-bool StreamFile::is_eof() const {
 
-    return f->eof_reached();
+uint64_t StreamFile::get_position() const {
+
+    return window ? window_offset + uint64_t(read_pos - window) : f->get_position();
 }
 
-char StreamString::get_char() {
-    if (pos > s.length()) {
-        return 0;
-    } else if (pos == s.length()) {
-        // You need to try to read again when you have reached the end for EOF to be reported,
-        // so this works the same as files (like StreamFile does)
-        pos++;
-        return 0;
-    } else {
-        return s[pos++];
-    }
+char StreamString::_refill() {
+    // Reading past the end once reports EOF, so this works the same as files (like StreamFile does).
+    eof = true;
+    return 0;
 }
 
 bool StreamString::is_utf8() const {
     return false;
 }
-bool StreamString::is_eof() const {
-    return pos > s.length();
+
+uint64_t StreamString::get_position() const {
+    return uint64_t(read_pos - s.data());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,6 +502,77 @@ Error VariantParser::get_token(VariantParserStream *p_stream, Token &r_token, in
     return ERR_PARSE_ERROR;
 }
 
+// Returns the next character of a constructor argument list, skipping blanks and comments the same way get_token does.
+static char _next_construct_char(VariantParserStream *p_stream, int &line) {
+
+    char c;
+    if (p_stream->saved) {
+        c = p_stream->saved;
+        p_stream->saved = 0;
+    } else {
+        c = p_stream->get_char();
+    }
+    while (true) {
+        if (c == '\n') {
+            line++;
+        } else if (c == ';') {
+            do {
+                c = p_stream->get_char();
+            } while (c != '\n' && !p_stream->is_eof());
+            if (p_stream->is_eof()) {
+                return 0;
+            }
+            continue;
+        } else if (c == 0 || c > 32) {
+            return c;
+        }
+        c = p_stream->get_char();
+    }
+}
+
+// Scans a number starting with p_first using get_token's number grammar, leaving the terminating character saved.
+template <class T>
+static T _scan_construct_number(VariantParserStream *p_stream, char p_first) {
+
+    eastl::fixed_string<char, 64, true> buf;
+    char c = p_first;
+    if (c == '-') {
+        buf.push_back(c);
+        c = p_stream->get_char();
+    }
+    while (c >= '0' && c <= '9') {
+        buf.push_back(c);
+        c = p_stream->get_char();
+    }
+    bool is_float = false;
+    if (c == '.') {
+        is_float = true;
+        do {
+            buf.push_back(c);
+            c = p_stream->get_char();
+        } while (c >= '0' && c <= '9');
+    }
+    if (c == 'e') {
+        is_float = true;
+        buf.push_back(c);
+        c = p_stream->get_char();
+        if (c == '-' || c == '+') {
+            buf.push_back(c);
+            c = p_stream->get_char();
+        }
+        while (c >= '0' && c <= '9') {
+            buf.push_back(c);
+            c = p_stream->get_char();
+        }
+    }
+    p_stream->saved = c;
+
+    if (is_float) {
+        return T(StringUtils::to_double(StringView(buf.data(), buf.size())));
+    }
+    return T(StringUtils::to_int(StringView(buf.data(), buf.size())));
+}
+
 template <class T>
 Error VariantParser::_parse_construct(VariantParserStream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 
@@ -477,31 +583,31 @@ Error VariantParser::_parse_construct(VariantParserStream *p_stream, Vector<T> &
         return ERR_PARSE_ERROR;
     }
 
+    // Constructor arguments are plain number lists and make up the bulk of large scenes (pool arrays, transforms),
+    // so they are scanned straight from the stream instead of producing a Token and a Variant per element.
     bool first = true;
     while (true) {
 
+        char c = _next_construct_char(p_stream, line);
         if (!first) {
-            get_token(p_stream, token, line, r_err_str);
-            if (token.type == TK_COMMA) {
-                //do none
-            } else if (token.type == TK_PARENTHESIS_CLOSE) {
+            if (c == ')') {
                 break;
-            } else {
+            }
+            if (c != ',') {
                 r_err_str = "Expected ',' or ')' in constructor";
                 return ERR_PARSE_ERROR;
             }
-        }
-        get_token(p_stream, token, line, r_err_str);
-
-        if (first && token.type == TK_PARENTHESIS_CLOSE) {
+            c = _next_construct_char(p_stream, line);
+        } else if (c == ')') {
             break;
         }
-        if (token.type != TK_NUMBER) {
+
+        if (c != '-' && (c < '0' || c > '9')) {
             r_err_str = "Expected float in constructor";
             return ERR_PARSE_ERROR;
         }
 
-        r_construct.push_back(token.value.as<T>());
+        r_construct.push_back(_scan_construct_number<T>(p_stream, c));
         first = false;
     }
 
@@ -38,14 +38,30 @@
 
 struct VariantParserStream {
 
-    virtual char get_char() = 0;
+    //! Characters are served inline from the [read_pos, read_end) window, _refill() only runs once it is exhausted.
+    char get_char() {
+        if (read_pos != read_end) {
+            return *read_pos++;
+        }
+        return _refill();
+    }
     virtual bool is_utf8() const = 0;
-    virtual bool is_eof() const = 0;
+    bool is_eof() const { return eof; }
+    //! Offset in the underlying source of the next character get_char() will return.
+    virtual uint64_t get_position() const = 0;
 
     char saved = 0;
 
     VariantParserStream() {}
     virtual ~VariantParserStream() {}
+
+protected:
+    //! Makes more characters available and returns the first one, or sets eof and returns 0 when the source is exhausted.
+    virtual char _refill() = 0;
+
+    const char *read_pos = nullptr;
+    const char *read_end = nullptr;
+    bool eof = false;
 };
 
 class GODOT_EXPORT VariantParser {
@@ -1285,6 +1285,8 @@ void RasterizerSceneGLES3::_setup_geometry(RenderList::Element *e, const Transfo
             } else if (state.debug_draw == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME && s->array_wireframe_id) {
                 glBindVertexArray(s->array_wireframe_id); // everything is so easy nowadays
 #endif
+            } else if (e->lod >= 0) {
+                glBindVertexArray(s->lods[e->lod].array_id);
             } else {
                 glBindVertexArray(s->array_id); // everything is so easy nowadays
             }
@@ -1480,7 +1482,14 @@ void RasterizerSceneGLES3::_render_geometry(RenderList::Element *e) {
                 storage->info.render.vertices_count += s->index_array_len;
             } else
 #endif
-                    if (s->index_array_len > 0) {
+                    if (e->lod >= 0) {
+
+                const RasterizerStorageGLES3::Surface::LOD &lod = s->lods[e->lod];
+                glDrawElements(gl_primitive[s->primitive], lod.index_array_len, (s->array_len >= (1 << 16)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, nullptr);
+
+                storage->info.render.vertices_count += lod.index_array_len;
+
+            } else if (s->index_array_len > 0) {
 
                 glDrawElements(gl_primitive[s->primitive], s->index_array_len, (s->array_len >= (1 << 16)) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT, nullptr);
 
@@ -1956,6 +1965,7 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
     RasterizerStorageGLES3::Geometry *prev_geometry = nullptr;
     RasterizerStorageGLES3::GeometryOwner *prev_owner = nullptr;
     RS::InstanceType prev_base_type = RS::INSTANCE_MAX;
+    int prev_lod = -1;
 
     int current_blend_mode = -1;
 
@@ -2150,7 +2160,7 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
             _setup_light(e, p_view_transform);
         }
 
-        if (e->owner != prev_owner || prev_base_type != e->instance->base_type || prev_geometry != e->geometry) {
+        if (e->owner != prev_owner || prev_base_type != e->instance->base_type || prev_geometry != e->geometry || prev_lod != e->lod) {
 
             _setup_geometry(e, p_view_transform);
             storage->info.render.surface_switch_count++;
@@ -2165,6 +2175,7 @@ void RasterizerSceneGLES3::_render_list(RenderList::Element **p_elements, int p_
         prev_material = material;
         prev_base_type = e->instance->base_type;
         prev_geometry = e->geometry;
+        prev_lod = e->lod;
         prev_owner = e->owner;
         prev_shading = shading;
         prev_skeleton = skeleton;
@@ -2299,6 +2310,15 @@ void RasterizerSceneGLES3::_add_geometry_with_material(RasterizerStorageGLES3::G
     e->instance = p_instance;
     e->owner = p_owner;
     e->sort_key = 0;
+    e->lod = -1;
+
+    if (p_instance->base_type == RS::INSTANCE_MESH && p_instance->lod_error_scale > 0.0f) {
+        const RasterizerStorageGLES3::Surface *s = static_cast<const RasterizerStorageGLES3::Surface *>(p_geometry);
+        // blend shapes are rendered through transform feedback into the full index buffer.
+        if (!s->lods.empty() && (s->blend_shapes.empty() || p_instance->blend_values.empty())) {
+            e->lod = RasterizerStorageGLES3::mesh_surface_select_lod(s, p_instance->lod_error_scale);
+        }
+    }
 
     if (e->geometry->last_pass != render_pass) {
         e->geometry->last_pass = render_pass;
@@ -626,6 +626,7 @@ public:
             RasterizerStorageGLES3::Material *material;
             RasterizerStorageGLES3::GeometryOwner *owner;
             uint64_t sort_key;
+            int lod; // index into the surface's LOD list, -1 draws the full index buffer
         };
 
         Element *base_elements;
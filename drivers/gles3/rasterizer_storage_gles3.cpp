@@ -3998,6 +3998,121 @@ const Vector<AABB> &RasterizerStorageGLES3::mesh_surface_get_skeleton_aabb(RID p
     return mesh->surfaces[p_surface]->skeleton_bone_aabb;
 }
 
+void RasterizerStorageGLES3::_mesh_surface_clear_lods(Surface *p_surface) {
+
+    for (const Surface::LOD &lod : p_surface->lods) {
+        glDeleteBuffers(1, &lod.index_id);
+        glDeleteVertexArrays(1, &lod.array_id);
+        p_surface->total_data_size -= lod.index_array_byte_size;
+        info.vertex_mem -= lod.index_array_byte_size;
+    }
+    p_surface->lods.clear();
+}
+
+void RasterizerStorageGLES3::mesh_surface_set_lods(RID p_mesh, int p_surface, const Vector<float> &p_lod_errors, const Vector<PoolVector<uint8_t>> &p_lod_index_arrays) {
+
+    Mesh *mesh = mesh_owner.getornull(p_mesh);
+    ERR_FAIL_COND(!mesh);
+    ERR_FAIL_INDEX(p_surface, mesh->surfaces.size());
+    ERR_FAIL_COND(p_lod_errors.size() != p_lod_index_arrays.size());
+
+    Surface *surface = mesh->surfaces[p_surface];
+    ERR_FAIL_COND_MSG(!surface->index_id, "Only indexed surfaces can have LODs.");
+
+    _mesh_surface_clear_lods(surface);
+
+    const Surface::Attrib *attribs = surface->attribs;
+    const int index_stride = attribs[RS::ARRAY_INDEX].stride;
+
+    for (int l = 0; l < p_lod_index_arrays.size(); l++) {
+
+        const PoolVector<uint8_t> &index_array = p_lod_index_arrays[l];
+        ERR_CONTINUE(index_array.size() == 0 || index_array.size() % index_stride != 0);
+
+        Surface::LOD lod;
+        lod.index_array_byte_size = index_array.size();
+        lod.index_array_len = index_array.size() / index_stride;
+        lod.error = p_lod_errors[l];
+
+        {
+            PoolVector<uint8_t>::Read ir = index_array.read();
+            glGenBuffers(1, &lod.index_id);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lod.index_id);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, lod.index_array_byte_size, ir.ptr(), GL_STATIC_DRAW);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); //unbind
+        }
+
+        glGenVertexArrays(1, &lod.array_id);
+        glBindVertexArray(lod.array_id);
+        glBindBuffer(GL_ARRAY_BUFFER, surface->vertex_id);
+
+        for (int i = 0; i < RS::ARRAY_MAX - 1; i++) {
+
+            if (!attribs[i].enabled)
+                continue;
+
+            if (attribs[i].integer) {
+                glVertexAttribIPointer(attribs[i].index, attribs[i].size, attribs[i].type, attribs[i].stride, CAST_INT_TO_UCHAR_PTR(attribs[i].offset));
+            } else {
+                glVertexAttribPointer(attribs[i].index, attribs[i].size, attribs[i].type, attribs[i].normalized, attribs[i].stride, CAST_INT_TO_UCHAR_PTR(attribs[i].offset));
+            }
+            glEnableVertexAttribArray(attribs[i].index);
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lod.index_id);
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0); //unbind
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+        surface->total_data_size += lod.index_array_byte_size;
+        info.vertex_mem += lod.index_array_byte_size;
+        surface->lods.push_back(lod);
+    }
+}
+
+Vector<float> RasterizerStorageGLES3::mesh_surface_get_lod_errors(RID p_mesh, int p_surface) const {
+
+    const Mesh *mesh = mesh_owner.getornull(p_mesh);
+    ERR_FAIL_COND_V(!mesh, Vector<float>());
+    ERR_FAIL_INDEX_V(p_surface, mesh->surfaces.size(), Vector<float>());
+
+    Vector<float> ret;
+    for (const Surface::LOD &lod : mesh->surfaces[p_surface]->lods) {
+        ret.push_back(lod.error);
+    }
+    return ret;
+}
+
+Vector<Vector<uint8_t>> RasterizerStorageGLES3::mesh_surface_get_lod_index_arrays(RID p_mesh, int p_surface) const {
+
+    const Mesh *mesh = mesh_owner.getornull(p_mesh);
+    ERR_FAIL_COND_V(!mesh, Vector<Vector<uint8_t>>());
+    ERR_FAIL_INDEX_V(p_surface, mesh->surfaces.size(), Vector<Vector<uint8_t>>());
+
+    Vector<Vector<uint8_t>> ret;
+    for (const Surface::LOD &lod : mesh->surfaces[p_surface]->lods) {
+        Vector<uint8_t> data;
+        data.resize(lod.index_array_byte_size);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lod.index_id);
+        glGetBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, lod.index_array_byte_size, data.data());
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        ret.emplace_back(eastl::move(data));
+    }
+    return ret;
+}
+
+int RasterizerStorageGLES3::mesh_surface_select_lod(const Surface *p_surface, float p_error_scale) {
+
+    int selected = -1;
+    for (int i = 0; i < p_surface->lods.size(); i++) {
+        if (p_surface->lods[i].error * p_error_scale > 1.0f) {
+            break;
+        }
+        selected = i;
+    }
+    return selected;
+}
+
 void RasterizerStorageGLES3::mesh_remove_surface(RID p_mesh, int p_surface) {
 
     Mesh *mesh = mesh_owner.getornull(p_mesh);
@@ -4024,6 +4139,8 @@ void RasterizerStorageGLES3::mesh_remove_surface(RID p_mesh, int p_surface) {
         glDeleteVertexArrays(1, &surface->blend_shapes[i].array_id);
     }
 
+    _mesh_surface_clear_lods(surface);
+
     if (surface->index_wireframe_id) {
         glDeleteBuffers(1, &surface->index_wireframe_id);
         glDeleteVertexArrays(1, &surface->array_wireframe_id);
@@ -8280,6 +8397,10 @@ void RasterizerStorageGLES3::initialize() {
         glGenVertexArrays(1, &resources.transform_feedback_array);
     }
 
+    if (GLOBAL_DEF("rendering/quality/shaders/persistent_compile_cache", false).as<bool>()) {
+        shaders.compiler.set_persistent_cache_dir("user://shader_cache");
+    }
+
     shaders.cubemap_filter.init();
     bool ggx_hq = GLOBAL_GET("rendering/quality/reflections/high_quality_ggx").as<bool>();
     shaders.cubemap_filter.set_conditional(CubemapFilterShaderGLES3::LOW_QUALITY, !ggx_hq);
@@ -590,11 +590,20 @@ public:
             GLuint vertex_id;
             GLuint array_id;
         };
+        // reduced index buffers sharing the surface's vertex buffer, ordered from finest to coarsest.
+        struct LOD {
+            GLuint index_id;
+            GLuint array_id;
+            int index_array_len;
+            int index_array_byte_size;
+            float error;
+        };
 
         Attrib attribs[RS::ARRAY_MAX];
         Vector<AABB> skeleton_bone_aabb;
         Vector<bool> skeleton_bone_used;
         Vector<BlendShape> blend_shapes;
+        Vector<LOD> lods;
 
         AABB aabb;
         Mesh *mesh;
@@ -711,6 +720,13 @@ public:
     Vector<Vector<uint8_t>> mesh_surface_get_blend_shapes(RID p_mesh, int p_surface) const override;
     const Vector<AABB> &mesh_surface_get_skeleton_aabb(RID p_mesh, int p_surface) const override;
 
+    void mesh_surface_set_lods(RID p_mesh, int p_surface, const Vector<float> &p_lod_errors, const Vector<PoolVector<uint8_t>> &p_lod_index_arrays) override;
+    Vector<float> mesh_surface_get_lod_errors(RID p_mesh, int p_surface) const override;
+    Vector<Vector<uint8_t>> mesh_surface_get_lod_index_arrays(RID p_mesh, int p_surface) const override;
+    void _mesh_surface_clear_lods(Surface *p_surface);
+    //! Picks the coarsest level whose scaled error stays within 1, -1 selects the full index buffer.
+    static int mesh_surface_select_lod(const Surface *p_surface, float p_error_scale);
+
     void mesh_remove_surface(RID p_mesh, int p_surface) override;
     int mesh_get_surface_count(RID p_mesh) const override;
 
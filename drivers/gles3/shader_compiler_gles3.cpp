@@ -30,11 +30,15 @@
 
 #include "shader_compiler_gles3.h"
 
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
 #include "core/os/os.h"
 #include "core/project_settings.h"
 #include "core/print_string.h"
 #include "core/string_utils.h"
 
+#include <EASTL/sort.h>
+
 #define SL ShaderLanguage
 
 using namespace eastl;
@@ -547,6 +551,7 @@ String ShaderCompilerGLES3::_dump_node_code(SL::Node *p_node, int p_level, Gener
 
             if (p_assigning && p_actions.write_flag_pointers.contains(vnode->name)) {
                 *p_actions.write_flag_pointers[vnode->name] = true;
+                written_flag_pointers.insert(vnode->name);
             }
 
             if (p_default_actions.usage_defines.contains(vnode->name) && !used_name_defines.contains(vnode->name)) {
@@ -618,6 +623,7 @@ String ShaderCompilerGLES3::_dump_node_code(SL::Node *p_node, int p_level, Gener
 
             if (p_assigning && p_actions.write_flag_pointers.contains(anode->name)) {
                 *p_actions.write_flag_pointers[anode->name] = true;
+                written_flag_pointers.insert(anode->name);
             }
 
             if (p_default_actions.usage_defines.contains(anode->name) && !used_name_defines.contains(anode->name)) {
@@ -824,8 +830,287 @@ String ShaderCompilerGLES3::_dump_node_code(SL::Node *p_node, int p_level, Gener
     return code;
 }
 
+namespace {
+enum {
+    COMPILED_SHADER_MAGIC = 0x43534c47, // "GLSC"
+    COMPILED_SHADER_VERSION = 2,
+};
+
+//! Appends the entries of p_map in a stable order, hash map iteration order isn't.
+void _append_sorted(String &r_to, const HashMap<StringName, String> &p_map) {
+    Vector<String> entries;
+    entries.reserve(p_map.size());
+    for (const eastl::pair<const StringName, String> &E : p_map) {
+        entries.emplace_back(String(E.first.asCString()) + "=" + E.second);
+    }
+    eastl::sort(entries.begin(), entries.end());
+    for (const String &entry : entries) {
+        r_to += entry;
+        r_to += '\n';
+    }
+    r_to += '\n';
+}
+
+void _store_strings(FileAccess *f, const Vector<String> &p_strings) {
+    f->store_32(p_strings.size());
+    for (const String &s : p_strings) {
+        f->store_pascal_string(s);
+    }
+}
+
+void _store_names(FileAccess *f, const Vector<StringName> &p_names) {
+    f->store_32(p_names.size());
+    for (const StringName &n : p_names) {
+        f->store_pascal_string(n.asCString());
+    }
+}
+
+void _get_strings(FileAccess *f, Vector<String> &r_strings) {
+    r_strings.resize(f->get_32());
+    for (String &s : r_strings) {
+        s = f->get_pascal_string();
+    }
+}
+
+void _get_names(FileAccess *f, Vector<StringName> &r_names) {
+    r_names.resize(f->get_32());
+    for (StringName &n : r_names) {
+        n = StringName(f->get_pascal_string());
+    }
+}
+} // namespace
+
+void ShaderCompilerGLES3::_apply_compiled(const CompiledShader &p_compiled, IdentifierActions &p_actions) {
+
+    // same effects, in the same order, as _dump_node_code has on the actions while compiling.
+    for (const StringName &render_mode : p_compiled.render_modes) {
+        auto flag = p_actions.render_mode_flags.find(render_mode);
+        if (flag != p_actions.render_mode_flags.end()) {
+            *flag->second = true;
+        }
+        auto value = p_actions.render_mode_values.find(render_mode);
+        if (value != p_actions.render_mode_values.end()) {
+            *value->second.first = value->second.second;
+        }
+    }
+    for (const eastl::pair<const StringName, SL::ShaderNode::Uniform> &E : p_compiled.uniforms) {
+        p_actions.uniforms->emplace(E.first, E.second);
+    }
+    for (const StringName &name : p_compiled.used_flags) {
+        auto flag = p_actions.usage_flag_pointers.find(name);
+        if (flag != p_actions.usage_flag_pointers.end()) {
+            *flag->second = true;
+        }
+    }
+    for (const StringName &name : p_compiled.written_flags) {
+        auto flag = p_actions.write_flag_pointers.find(name);
+        if (flag != p_actions.write_flag_pointers.end()) {
+            *flag->second = true;
+        }
+    }
+}
+
+bool ShaderCompilerGLES3::_load_compiled(RS::ShaderMode p_mode, StringView p_key, CompiledShader &r_compiled) const {
+
+    FileAccessRef f = FileAccess::open(PathUtils::plus_file(persistent_cache_dir, String(p_key) + ".glsc"), FileAccess::READ);
+    if (!f)
+        return false;
+    if (f->get_len() < 8 || f->get_32() != COMPILED_SHADER_MAGIC || f->get_32() != COMPILED_SHADER_VERSION)
+        return false;
+    if (f->get_pascal_string() != actions_hash[int(p_mode)])
+        return false; // written under other shading settings
+
+    GeneratedCode &gen = r_compiled.gen_code;
+    _get_strings(f, gen.defines);
+    _get_names(f, gen.texture_uniforms);
+    gen.texture_types.resize(gen.texture_uniforms.size());
+    gen.texture_hints.resize(gen.texture_uniforms.size());
+    for (size_t i = 0; i < gen.texture_uniforms.size(); i++) {
+        gen.texture_types[i] = SL::DataType(f->get_32());
+        gen.texture_hints[i] = SL::ShaderNode::Uniform::Hint(f->get_32());
+    }
+    gen.uniform_offsets.resize(f->get_32());
+    for (uint32_t &offset : gen.uniform_offsets) {
+        offset = f->get_32();
+    }
+    gen.uniform_total_size = f->get_32();
+    gen.uniforms = f->get_pascal_string();
+    gen.vertex_global = f->get_pascal_string();
+    gen.vertex = f->get_pascal_string();
+    gen.fragment_global = f->get_pascal_string();
+    gen.fragment = f->get_pascal_string();
+    gen.light = f->get_pascal_string();
+    gen.uses_fragment_time = f->get_8() != 0;
+    gen.uses_vertex_time = f->get_8() != 0;
+
+    uint32_t uniform_count = f->get_32();
+    for (uint32_t i = 0; i < uniform_count && !f->eof_reached(); i++) {
+        StringName name(f->get_pascal_string());
+        SL::ShaderNode::Uniform uniform;
+        uniform.order = int32_t(f->get_32());
+        uniform.texture_order = int32_t(f->get_32());
+        uniform.type = SL::DataType(f->get_32());
+        uniform.precision = SL::DataPrecision(f->get_32());
+        uniform.default_value.resize(f->get_32());
+        for (SL::ConstantNode::Value &value : uniform.default_value) {
+            value.uint = f->get_32();
+        }
+        uniform.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+        for (float &range : uniform.hint_range) {
+            range = f->get_float();
+        }
+        r_compiled.uniforms.emplace(name, uniform);
+    }
+
+    _get_names(f, r_compiled.render_modes);
+    _get_names(f, r_compiled.used_flags);
+    _get_names(f, r_compiled.written_flags);
+
+    // a file cut short while it was being written does not end with the magic.
+    return !f->eof_reached() && f->get_32() == COMPILED_SHADER_MAGIC;
+}
+
+void ShaderCompilerGLES3::_save_compiled(RS::ShaderMode p_mode, StringView p_key, const CompiledShader &p_compiled) {
+
+    DirAccessRef da = DirAccess::create_for_path(persistent_cache_dir);
+    if (!da->dir_exists(persistent_cache_dir)) {
+        ERR_FAIL_COND(da->make_dir_recursive(persistent_cache_dir) != OK);
+    }
+
+    String path = PathUtils::plus_file(persistent_cache_dir, String(p_key) + ".glsc");
+    bool is_new = !FileAccess::exists(path);
+
+    FileAccessRef f = FileAccess::open(path, FileAccess::WRITE);
+    ERR_FAIL_COND(!f);
+
+    f->store_32(COMPILED_SHADER_MAGIC);
+    f->store_32(COMPILED_SHADER_VERSION);
+    f->store_pascal_string(actions_hash[int(p_mode)]);
+
+    const GeneratedCode &gen = p_compiled.gen_code;
+    _store_strings(f, gen.defines);
+    _store_names(f, gen.texture_uniforms);
+    for (size_t i = 0; i < gen.texture_uniforms.size(); i++) {
+        f->store_32(gen.texture_types[i]);
+        f->store_32(gen.texture_hints[i]);
+    }
+    f->store_32(gen.uniform_offsets.size());
+    for (uint32_t offset : gen.uniform_offsets) {
+        f->store_32(offset);
+    }
+    f->store_32(gen.uniform_total_size);
+    f->store_pascal_string(gen.uniforms);
+    f->store_pascal_string(gen.vertex_global);
+    f->store_pascal_string(gen.vertex);
+    f->store_pascal_string(gen.fragment_global);
+    f->store_pascal_string(gen.fragment);
+    f->store_pascal_string(gen.light);
+    f->store_8(gen.uses_fragment_time);
+    f->store_8(gen.uses_vertex_time);
+
+    f->store_32(p_compiled.uniforms.size());
+    for (const eastl::pair<const StringName, SL::ShaderNode::Uniform> &E : p_compiled.uniforms) {
+        f->store_pascal_string(E.first.asCString());
+        f->store_32(E.second.order);
+        f->store_32(E.second.texture_order);
+        f->store_32(E.second.type);
+        f->store_32(E.second.precision);
+        f->store_32(E.second.default_value.size());
+        for (const SL::ConstantNode::Value &value : E.second.default_value) {
+            f->store_32(value.uint);
+        }
+        f->store_32(E.second.hint);
+        for (float range : E.second.hint_range) {
+            f->store_float(range);
+        }
+    }
+
+    _store_names(f, p_compiled.render_modes);
+    _store_names(f, p_compiled.used_flags);
+    _store_names(f, p_compiled.written_flags);
+    f->store_32(COMPILED_SHADER_MAGIC);
+    f->close();
+
+    if (is_new && ++persistent_cache_files > MAX_PERSISTENT_SHADERS) {
+        _trim_persistent_cache();
+    }
+}
+
+void ShaderCompilerGLES3::_trim_persistent_cache() {
+
+    // edited shaders leave their old files behind, drop the least recently written half.
+    DirAccessRef da = DirAccess::create_for_path(persistent_cache_dir);
+    if (da->change_dir(persistent_cache_dir) != OK)
+        return;
+
+    Vector<eastl::pair<uint64_t, String>> files;
+    da->list_dir_begin();
+    for (String f = da->get_next(); !f.empty(); f = da->get_next()) {
+        if (!da->current_is_dir() && PathUtils::get_extension(f) == StringView("glsc")) {
+            files.emplace_back(FileAccess::get_modified_time(PathUtils::plus_file(persistent_cache_dir, f)), f);
+        }
+    }
+    da->list_dir_end();
+
+    persistent_cache_files = files.size();
+    if (persistent_cache_files <= MAX_PERSISTENT_SHADERS)
+        return;
+
+    eastl::sort(files.begin(), files.end());
+    size_t to_remove = files.size() - MAX_PERSISTENT_SHADERS / 2;
+    for (size_t i = 0; i < to_remove; i++) {
+        if (da->remove(files[i].second) == OK)
+            persistent_cache_files--;
+    }
+}
+
+void ShaderCompilerGLES3::_evict_compiled() {
+
+    // every lookup hands out a new tick, so at least half of the entries are older than this.
+    const uint64_t keep_from = compiled_tick - MAX_COMPILED_SHADERS / 2;
+    for (auto iter = compiled_cache.begin(); iter != compiled_cache.end();) {
+        if (iter->second.last_used < keep_from)
+            iter = compiled_cache.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+void ShaderCompilerGLES3::set_persistent_cache_dir(const String &p_dir) {
+
+    persistent_cache_dir = p_dir;
+    persistent_cache_files = 0;
+    if (!persistent_cache_dir.empty()) {
+        // counts the files already there, trimming them if an older run left too many.
+        _trim_persistent_cache();
+    }
+}
+
+void ShaderCompilerGLES3::clear_cache() {
+
+    compiled_cache.clear();
+}
+
 Error ShaderCompilerGLES3::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 
+    // materials sharing a shader, and visual shaders regenerating the same code, compile it only once.
+    const String key = ::to_string(int(p_mode)) + "_" + StringUtils::md5_text(p_code);
+    auto cached = compiled_cache.find(key);
+    if (cached == compiled_cache.end() && !persistent_cache_dir.empty()) {
+        CompiledShader loaded;
+        if (_load_compiled(p_mode, key, loaded)) {
+            if (compiled_cache.size() >= MAX_COMPILED_SHADERS)
+                _evict_compiled();
+            cached = compiled_cache.emplace(key, eastl::move(loaded)).first;
+        }
+    }
+    if (cached != compiled_cache.end()) {
+        cached->second.last_used = ++compiled_tick;
+        _apply_compiled(cached->second, *p_actions);
+        r_gen_code = cached->second.gen_code;
+        return OK;
+    }
+
     Error err = parser.compile(p_code, ShaderTypes::get_singleton()->get_functions(p_mode),
             ShaderTypes::get_singleton()->get_modes(p_mode), ShaderTypes::get_singleton()->get_types());
 
@@ -853,6 +1138,7 @@ Error ShaderCompilerGLES3::compile(RS::ShaderMode p_mode, const String &p_code,
     used_name_defines.clear();
     used_rmode_defines.clear();
     used_flag_pointers.clear();
+    written_flag_pointers.clear();
 
     _dump_node_code(parser.get_shader(), 1, r_gen_code, *p_actions, actions[(int)p_mode], false);
 
@@ -864,6 +1150,22 @@ Error ShaderCompilerGLES3::compile(RS::ShaderMode p_mode, const String &p_code,
         r_gen_code.uniform_total_size += md; //pad just in case
     }
 
+    if (compiled_cache.size() >= MAX_COMPILED_SHADERS)
+        _evict_compiled();
+
+    const SL::ShaderNode *shader = parser.get_shader();
+    CompiledShader &compiled = compiled_cache[key];
+    compiled.gen_code = r_gen_code;
+    compiled.uniforms = shader->uniforms;
+    compiled.render_modes = shader->render_modes;
+    compiled.used_flags.assign(used_flag_pointers.begin(), used_flag_pointers.end());
+    compiled.written_flags.assign(written_flag_pointers.begin(), written_flag_pointers.end());
+    compiled.last_used = ++compiled_tick;
+
+    if (!persistent_cache_dir.empty()) {
+        _save_compiled(p_mode, key, compiled);
+    }
+
     return OK;
 }
 
@@ -1077,4 +1379,13 @@ ShaderCompilerGLES3::ShaderCompilerGLES3() {
     for (const String &E : func_list) {
         internal_functions.emplace(E);
     }
+
+    // the default actions are all that project settings change, so their hash tells cache files from other settings apart.
+    for (int i = 0; i < int(RS::ShaderMode::MAX); i++) {
+        String actions_text;
+        _append_sorted(actions_text, actions[i].renames);
+        _append_sorted(actions_text, actions[i].render_mode_defines);
+        _append_sorted(actions_text, actions[i].usage_defines);
+        actions_hash[i] = StringUtils::md5_text(actions_text);
+    }
 }
@@ -89,13 +89,49 @@ private:
 
     HashSet<StringName> used_name_defines;
     HashSet<StringName> used_flag_pointers;
+    HashSet<StringName> written_flag_pointers;
     HashSet<StringName> used_rmode_defines;
     HashSet<StringName> internal_functions;
 
     DefaultIdentifierActions actions[int(RenderingServerEnums::ShaderMode::MAX)];
 
+    enum {
+        MAX_COMPILED_SHADERS = 1024,
+        MAX_PERSISTENT_SHADERS = 4096,
+    };
+
+    //! Result of a successful compile, together with what it did to the IdentifierActions, so a cache hit can
+    //! replay it without running the parser.
+    struct CompiledShader {
+        GeneratedCode gen_code;
+        HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+        Vector<StringName> render_modes;
+        Vector<StringName> used_flags;
+        Vector<StringName> written_flags;
+        uint64_t last_used = 0;
+    };
+
+    //! Keyed by shader mode and a hash of the code.
+    HashMap<String, CompiledShader> compiled_cache;
+    uint64_t compiled_tick = 0;
+    String persistent_cache_dir;
+    int persistent_cache_files = 0;
+    //! Hash of each mode's default actions, which depend on project settings (e.g. force_blinn_over_ggx).
+    //! Cache files written under other settings are rejected.
+    String actions_hash[int(RenderingServerEnums::ShaderMode::MAX)];
+
+    static void _apply_compiled(const CompiledShader &p_compiled, IdentifierActions &p_actions);
+    bool _load_compiled(RS::ShaderMode p_mode, StringView p_key, CompiledShader &r_compiled) const;
+    void _save_compiled(RS::ShaderMode p_mode, StringView p_key, const CompiledShader &p_compiled);
+    void _trim_persistent_cache();
+    void _evict_compiled();
+
 public:
     Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
+    //! Compiled shaders are also written to, and looked up in, this directory. Empty keeps the cache in memory only.
+    void set_persistent_cache_dir(const String &p_dir);
+    void clear_cache();
+
     ShaderCompilerGLES3();
 };
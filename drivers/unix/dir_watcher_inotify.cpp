@@ -0,0 +1,135 @@
+/*************************************************************************/
+/*  dir_watcher_inotify.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "dir_watcher_inotify.h"
+
+#if defined(__linux__)
+
+#include "core/error_macros.h"
+#include "core/os/memory.h"
+#include "core/project_settings.h"
+#include "core/string_utils.h"
+
+#include <cerrno>
+#include <climits>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+// Everything that changes a directory listing or the contents and modification time of a file in it.
+#define INOTIFY_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_MOVE_SELF | IN_DELETE_SELF | IN_ONLYDIR)
+
+DirWatcher *DirWatcherInotify::_create_func() {
+    return memnew(DirWatcherInotify);
+}
+
+void DirWatcherInotify::make_default() {
+    _create = _create_func;
+}
+
+bool DirWatcherInotify::add_watch(StringView p_path) {
+    ERR_FAIL_COND_V(_fd < 0, false);
+
+    String path(p_path);
+    String global_path = ProjectSettings::get_singleton()->globalize_path(path);
+    int wd = inotify_add_watch(_fd, global_path.c_str(), INOTIFY_WATCH_MASK);
+    if (wd < 0) {
+        // ENOSPC means fs.inotify.max_user_watches was reached, no point in printing that for every directory.
+        ERR_FAIL_COND_V_MSG(errno != ENOSPC && errno != ENOENT, false, "inotify_add_watch failed for '" + global_path + "', errno: " + itos(errno) + ".");
+        return false;
+    }
+
+    MutexLock lock(_mutex);
+    _paths[wd] = path;
+    _watches[path] = wd;
+    return true;
+}
+
+void DirWatcherInotify::remove_watch(StringView p_path) {
+    MutexLock lock(_mutex);
+    auto iter = _watches.find(String(p_path));
+    if (iter == _watches.end())
+        return;
+    inotify_rm_watch(_fd, iter->second);
+    _paths.erase(iter->second);
+    _watches.erase(iter);
+}
+
+void DirWatcherInotify::read_changes(Vector<String> &r_changed, bool &r_overflow) {
+    if (_fd < 0)
+        return;
+
+    alignas(struct inotify_event) char buffer[64 * 1024];
+    MutexLock lock(_mutex);
+    while (true) {
+        ssize_t len = read(_fd, buffer, sizeof(buffer));
+        if (len <= 0) {
+            break; // EAGAIN, nothing left to read.
+        }
+        for (char *ptr = buffer; ptr < buffer + len;) {
+            const struct inotify_event *event = (const struct inotify_event *)ptr;
+            ptr += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                r_overflow = true;
+                continue;
+            }
+            auto iter = _paths.find(event->wd);
+            if (iter == _paths.end()) {
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                // the directory was removed, the kernel already dropped the watch.
+                _watches.erase(iter->second);
+                _paths.erase(iter);
+                continue;
+            }
+            if (event->mask & IN_MOVE_SELF) {
+                // the directory and everything below it now lives under a path this watcher doesn't know.
+                r_overflow = true;
+                inotify_rm_watch(_fd, event->wd);
+                continue;
+            }
+            r_changed.push_back(iter->second);
+        }
+    }
+}
+
+DirWatcherInotify::DirWatcherInotify() {
+    _fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    ERR_FAIL_COND_MSG(_fd < 0, "inotify_init1 failed, errno: " + itos(errno) + ".");
+}
+
+DirWatcherInotify::~DirWatcherInotify() {
+    if (_fd >= 0)
+        close(_fd);
+}
+
+#endif
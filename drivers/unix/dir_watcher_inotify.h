@@ -0,0 +1,60 @@
+/*************************************************************************/
+/*  dir_watcher_inotify.h                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#pragma once
+
+#if defined(__linux__)
+
+#include "core/hash_map.h"
+#include "core/os/dir_watcher.h"
+#include "core/os/mutex.h"
+
+class DirWatcherInotify : public DirWatcher {
+
+    int _fd;
+    Mutex _mutex;
+    HashMap<int, String> _paths; // watch descriptor -> path passed to add_watch
+    HashMap<String, int> _watches;
+
+    static DirWatcher *_create_func();
+
+public:
+    static void make_default();
+
+    bool add_watch(StringView p_path) override;
+    void remove_watch(StringView p_path) override;
+    void read_changes(Vector<String> &r_changed, bool &r_overflow) override;
+
+    DirWatcherInotify();
+    ~DirWatcherInotify() override;
+};
+
+#endif
@@ -0,0 +1,198 @@
+/*************************************************************************/
+/*  file_access_mmap.cpp                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "file_access_mmap.h"
+
+#if defined(UNIX_ENABLED)
+
+#include "core/error_macros.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+void FileAccessMMap::_unmap() {
+    if (data) {
+        munmap(const_cast<uint8_t *>(data), length);
+    }
+    data = nullptr;
+    length = 0;
+}
+
+Error FileAccessMMap::_open(StringView p_path, int p_mode_flags) {
+
+    close();
+    ERR_FAIL_COND_V_MSG(p_mode_flags != READ, ERR_INVALID_PARAMETER, "Memory mapped files are read-only.");
+
+    path_src = p_path;
+    path = fix_path(p_path);
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return errno == ENOENT ? ERR_FILE_NOT_FOUND : ERR_FILE_CANT_OPEN;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (st.st_mode & S_IFMT) != S_IFREG) {
+        ::close(fd);
+        return ERR_FILE_CANT_OPEN;
+    }
+
+    length = st.st_size;
+    if (length > 0) {
+        // the mapping keeps the file referenced, the descriptor is not needed past this point.
+        void *mem = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mem == MAP_FAILED) {
+            ::close(fd);
+            length = 0;
+            return ERR_FILE_CANT_OPEN;
+        }
+        data = static_cast<const uint8_t *>(mem);
+    }
+    ::close(fd);
+
+    pos = 0;
+    eof = false;
+    opened = true;
+    return OK;
+}
+
+void FileAccessMMap::close() {
+
+    _unmap();
+    opened = false;
+}
+
+bool FileAccessMMap::is_open() const {
+
+    return opened;
+}
+
+void FileAccessMMap::seek(size_t p_position) {
+
+    ERR_FAIL_COND_MSG(!opened, "File must be opened before use.");
+    eof = p_position > length;
+    pos = p_position;
+}
+
+void FileAccessMMap::seek_end(int64_t p_position) {
+
+    seek(length + p_position);
+}
+
+size_t FileAccessMMap::get_position() const {
+
+    return pos;
+}
+
+size_t FileAccessMMap::get_len() const {
+
+    return length;
+}
+
+bool FileAccessMMap::eof_reached() const {
+
+    return eof;
+}
+
+uint8_t FileAccessMMap::get_8() const {
+
+    if (pos >= length) {
+        eof = true;
+        return 0;
+    }
+    return data[pos++];
+}
+
+uint32_t FileAccessMMap::get_32() const {
+
+    if (pos + 4 > length || endian_swap) {
+        return FileAccess::get_32();
+    }
+    uint32_t v;
+    memcpy(&v, data + pos, 4);
+    pos += 4;
+    return v;
+}
+
+int FileAccessMMap::get_buffer(uint8_t *p_dst, int p_length) const {
+
+    ERR_FAIL_COND_V(p_length < 0, -1);
+    size_t to_read = p_length;
+    if (pos >= length) {
+        eof = true;
+        return 0;
+    }
+    if (pos + to_read > length) {
+        eof = true;
+        to_read = length - pos;
+    }
+    memcpy(p_dst, data + pos, to_read);
+    pos += to_read;
+    return int(to_read);
+}
+
+const uint8_t *FileAccessMMap::get_mapped_range(size_t p_offset, size_t p_length) const {
+
+    if (!data || p_offset > length || p_length > length - p_offset) {
+        return nullptr;
+    }
+    return data + p_offset;
+}
+
+Error FileAccessMMap::get_error() const {
+
+    return eof ? ERR_FILE_EOF : OK;
+}
+
+void FileAccessMMap::flush() {
+
+    ERR_FAIL();
+}
+
+void FileAccessMMap::store_8(uint8_t p_dest) {
+
+    ERR_FAIL();
+}
+
+void FileAccessMMap::store_buffer(const uint8_t *p_src, int p_length) {
+
+    ERR_FAIL();
+}
+
+FileAccessMMap::~FileAccessMMap() {
+    _unmap();
+}
+
+#endif
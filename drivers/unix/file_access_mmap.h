@@ -0,0 +1,83 @@
+/*************************************************************************/
+/*  file_access_mmap.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#pragma once
+
+#include "drivers/unix/file_access_unix.h"
+
+#if defined(UNIX_ENABLED)
+
+/// Read-only file access backed by a memory mapping of the whole file.
+/// Reads are plain copies out of the mapping and get_mapped_range hands out pointers into it, so callers can consume
+/// large blocks straight from the page cache. Used through FileAccess::open_mapped, for packs and large resources.
+class FileAccessMMap : public FileAccessUnix {
+
+    const uint8_t *data = nullptr;
+    size_t length = 0;
+    mutable size_t pos = 0;
+    mutable bool eof = false;
+    bool opened = false;
+    String path;
+    String path_src;
+
+    void _unmap();
+
+public:
+    Error _open(StringView p_path, int p_mode_flags) override;
+    void close() override;
+    bool is_open() const override;
+
+    const String &get_path() const override { return path_src; }
+    const String &get_path_absolute() const override { return path; }
+
+    void seek(size_t p_position) override;
+    void seek_end(int64_t p_position = 0) override;
+    size_t get_position() const override;
+    size_t get_len() const override;
+
+    bool eof_reached() const override;
+
+    uint8_t get_8() const override;
+    uint32_t get_32() const override;
+    int get_buffer(uint8_t *p_dst, int p_length) const override;
+    const uint8_t *get_mapped_range(size_t p_offset, size_t p_length) const override;
+
+    Error get_error() const override;
+
+    void flush() override;
+    void store_8(uint8_t p_dest) override;
+    void store_buffer(const uint8_t *p_src, int p_length) override;
+
+    FileAccessMMap() = default;
+    ~FileAccessMMap() override;
+};
+
+#endif
@@ -318,6 +318,25 @@ uint64_t FileAccessUnix::_get_modified_time(StringView p_file) {
     }
 }
 
+bool FileAccessUnix::_get_file_identity(StringView p_file, FileIdentity &r_identity) {
+
+    String file(fix_path(p_file));
+    struct stat flags;
+    if (stat(file.c_str(), &flags) != 0) {
+        return false;
+    }
+#if defined(__APPLE__)
+    r_identity.modified_time = uint64_t(flags.st_mtimespec.tv_sec) * 1000000000 + flags.st_mtimespec.tv_nsec;
+#elif defined(UNIX_ENABLED)
+    r_identity.modified_time = uint64_t(flags.st_mtim.tv_sec) * 1000000000 + flags.st_mtim.tv_nsec;
+#else
+    r_identity.modified_time = uint64_t(flags.st_mtime) * 1000000000;
+#endif
+    r_identity.size = flags.st_size;
+    r_identity.inode = flags.st_ino;
+    return true;
+}
+
 uint32_t FileAccessUnix::_get_unix_permissions(StringView p_file) {
 
     String file(fix_path(p_file));
@@ -85,6 +85,7 @@ public:
     bool file_exists(StringView p_path) override; ///< return true if a file exists
 
     uint64_t _get_modified_time(StringView p_file) override;
+    bool _get_file_identity(StringView p_file, FileIdentity &r_identity) override;
     uint32_t _get_unix_permissions(StringView p_file) override;
     Error _set_unix_permissions(StringView p_file, uint32_t p_permissions) override;
 
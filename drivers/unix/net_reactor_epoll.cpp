@@ -0,0 +1,139 @@
+/*************************************************************************/
+/*  net_reactor_epoll.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "net_reactor_epoll.h"
+
+#if defined(__linux__)
+
+#include "net_socket_posix.h"
+#include "core/error_macros.h"
+#include "core/os/memory.h"
+#include "core/string_utils.h"
+
+#include <cerrno>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+// Upper bound of events returned by a single wait, the remaining ones are reported by the next call.
+#define EPOLL_MAX_EVENTS 256
+
+namespace {
+
+int _socket_fd(const Ref<NetSocket> &p_socket) {
+    const NetSocketPosix *sock = dynamic_cast<const NetSocketPosix *>(p_socket.get());
+    return sock ? sock->get_fd() : -1;
+}
+
+uint32_t _to_epoll_events(uint32_t p_events) {
+    uint32_t events = 0;
+    if (p_events & NetReactor::EVENT_READ)
+        events |= EPOLLIN | EPOLLRDHUP;
+    if (p_events & NetReactor::EVENT_WRITE)
+        events |= EPOLLOUT;
+    return events;
+}
+
+Error _control(int p_epfd, int p_op, const Ref<NetSocket> &p_socket, uint32_t p_events, uint64_t p_token) {
+    int fd = _socket_fd(p_socket);
+    ERR_FAIL_COND_V_MSG(fd < 0, ERR_INVALID_PARAMETER, "Socket is not open or not a posix socket.");
+
+    struct epoll_event ev;
+    ev.events = _to_epoll_events(p_events);
+    ev.data.u64 = p_token;
+    if (epoll_ctl(p_epfd, p_op, fd, &ev) != 0) {
+        ERR_FAIL_V_MSG(FAILED, "epoll_ctl failed, errno: " + itos(errno) + ".");
+    }
+    return OK;
+}
+
+} // end of anonymous namespace
+
+NetReactor *NetReactorEpoll::_create_func() {
+    return memnew(NetReactorEpoll);
+}
+
+void NetReactorEpoll::make_default() {
+    _create = _create_func;
+}
+
+Error NetReactorEpoll::add(const Ref<NetSocket> &p_socket, uint32_t p_events, uint64_t p_token) {
+    ERR_FAIL_COND_V(_epfd < 0, ERR_UNCONFIGURED);
+    return _control(_epfd, EPOLL_CTL_ADD, p_socket, p_events, p_token);
+}
+
+Error NetReactorEpoll::modify(const Ref<NetSocket> &p_socket, uint32_t p_events, uint64_t p_token) {
+    ERR_FAIL_COND_V(_epfd < 0, ERR_UNCONFIGURED);
+    return _control(_epfd, EPOLL_CTL_MOD, p_socket, p_events, p_token);
+}
+
+void NetReactorEpoll::remove(const Ref<NetSocket> &p_socket) {
+    int fd = _socket_fd(p_socket);
+    if (_epfd < 0 || fd < 0)
+        return; // closed sockets are dropped by the kernel.
+    struct epoll_event ev = {};
+    epoll_ctl(_epfd, EPOLL_CTL_DEL, fd, &ev);
+}
+
+int NetReactorEpoll::wait(int p_timeout_msec, Vector<Event> &r_events) {
+    ERR_FAIL_COND_V(_epfd < 0, -1);
+
+    struct epoll_event events[EPOLL_MAX_EVENTS];
+    int count = epoll_wait(_epfd, events, EPOLL_MAX_EVENTS, p_timeout_msec);
+    if (count < 0) {
+        if (errno == EINTR)
+            return 0;
+        ERR_FAIL_V_MSG(-1, "epoll_wait failed, errno: " + itos(errno) + ".");
+    }
+
+    r_events.reserve(r_events.size() + count);
+    for (int i = 0; i < count; i++) {
+        uint32_t flags = 0;
+        if (events[i].events & (EPOLLIN | EPOLLRDHUP))
+            flags |= EVENT_READ;
+        if (events[i].events & EPOLLOUT)
+            flags |= EVENT_WRITE;
+        if (events[i].events & (EPOLLERR | EPOLLHUP))
+            flags |= EVENT_ERROR;
+        r_events.push_back({ events[i].data.u64, flags });
+    }
+    return count;
+}
+
+NetReactorEpoll::NetReactorEpoll() {
+    _epfd = epoll_create1(EPOLL_CLOEXEC);
+    ERR_FAIL_COND_MSG(_epfd < 0, "Unable to create epoll instance, errno: " + itos(errno) + ".");
+}
+
+NetReactorEpoll::~NetReactorEpoll() {
+    if (_epfd >= 0)
+        ::close(_epfd);
+}
+
+#endif // __linux__
@@ -29,6 +29,7 @@
 /*************************************************************************/
 
 #include "net_socket_posix.h"
+#include "net_reactor_epoll.h"
 #include "core/print_string.h"
 #include "core/string_utils.h"
 
@@ -178,6 +179,9 @@ GODOT_EXPORT void NetSocketPosix::make_default() {
     }
 #endif
     _create = _create_func;
+#if defined(__linux__)
+    NetReactorEpoll::make_default();
+#endif
 }
 
 GODOT_EXPORT void NetSocketPosix::cleanup() {
@@ -726,6 +730,12 @@ bool NetSocketPosix::is_open() const {
     return _sock->sock != SOCK_EMPTY;
 }
 
+#if defined(UNIX_ENABLED)
+int NetSocketPosix::get_fd() const {
+    return _sock->sock;
+}
+#endif
+
 int NetSocketPosix::get_available_bytes() const {
 
     ERR_FAIL_COND_V(!is_open(), -1);
@@ -86,6 +86,10 @@ public:
     virtual void set_reuse_port_enabled(bool p_enabled);
     Error join_multicast_group(const IP_Address &p_multi_address, StringView p_if_name) override;
     Error leave_multicast_group(const IP_Address &p_multi_address, StringView p_if_name) override;
+#if defined(UNIX_ENABLED)
+    //! Native descriptor, used by NetReactorEpoll. Returns -1 when the socket is closed.
+    int get_fd() const;
+#endif
 
     GODOT_EXPORT NetSocketPosix();
     GODOT_EXPORT ~NetSocketPosix() override;
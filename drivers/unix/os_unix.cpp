@@ -37,6 +37,8 @@
 #include "core/script_language.h"
 #include "core/string_utils.inl"
 #include "drivers/unix/dir_access_unix.h"
+#include "drivers/unix/dir_watcher_inotify.h"
+#include "drivers/unix/file_access_mmap.h"
 #include "drivers/unix/file_access_unix.h"
 #include "drivers/unix/net_socket_posix.h"
 
@@ -127,9 +129,13 @@ void OS_Unix::initialize_core() {
     FileAccess::make_default<FileAccessUnix>(FileAccess::ACCESS_RESOURCES);
     FileAccess::make_default<FileAccessUnix>(FileAccess::ACCESS_USERDATA);
     FileAccess::make_default<FileAccessUnix>(FileAccess::ACCESS_FILESYSTEM);
+    FileAccess::make_mapped_default<FileAccessMMap>();
     DirAccess::make_default<DirAccessUnix>(DirAccess::ACCESS_RESOURCES);
     DirAccess::make_default<DirAccessUnix>(DirAccess::ACCESS_USERDATA);
     DirAccess::make_default<DirAccessUnix>(DirAccess::ACCESS_FILESYSTEM);
+#if defined(__linux__)
+    DirWatcherInotify::make_default();
+#endif
 
 #ifndef NO_NETWORK
     NetSocketPosix::make_default();
@@ -944,6 +944,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, S
         header_size += 16; // md5
     }
 
+    const int64_t index_pos = header_size;
+    header_size += 4 + int64_t(pd.file_ofs.size()) * PACK_HASH_INDEX_ENTRY_SIZE; // hash index, see PACK_FLAG_HASH_INDEX
+
     int header_padding = _get_pad(PCK_PADDING, header_size);
 
     for (int i = 0; i < pd.file_ofs.size(); i++) {
@@ -961,6 +964,28 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, S
         f->store_buffer(pd.file_ofs[i].md5.data(), 16); // also save md5 for file
     }
 
+    Vector<eastl::pair<uint64_t, int>> index_order;
+    index_order.reserve(pd.file_ofs.size());
+    for (int i = 0; i < pd.file_ofs.size(); i++) {
+        index_order.emplace_back(PackedData::hash_path(pd.file_ofs[i].path_utf8), i);
+    }
+    eastl::sort(index_order.begin(), index_order.end());
+
+    f->store_32(pd.file_ofs.size());
+    for (const eastl::pair<uint64_t, int> &entry : index_order) {
+        const SavedData &sd = pd.file_ofs[entry.second];
+        f->store_64(entry.first);
+        f->store_64(sd.ofs + header_padding + header_size);
+        f->store_64(sd.size);
+        f->store_buffer(sd.md5.data(), 16);
+    }
+
+    const uint64_t index_end = f->get_position();
+    f->seek(pck_start_pos + PACK_RESERVED_OFFSET);
+    f->store_32(PACK_FLAG_HASH_INDEX);
+    f->store_64(index_pos);
+    f->seek(index_end);
+
     for (int i = 0; i < header_padding; i++) {
         f->store_8(0);
     }
@@ -41,6 +41,7 @@
 #include "core/os/file_access.h"
 #include "core/os/mutex.h"
 #include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/project_settings.h"
 #include "core/resource/resource_manager.h"
 #include "core/variant_parser.h"
@@ -55,7 +56,13 @@ IMPL_GDCLASS(EditorFileSystem)
 EditorFileSystem *EditorFileSystem::singleton = nullptr;
 
 //the name is the version, to keep compatibility with different versions of Godot
-#define CACHE_FILE_NAME "filesystem_cache6"
+#define CACHE_FILE_NAME "filesystem_cache7"
+#define CACHE_FILE_MAGIC 0x43534647 // "GFSC"
+// files processed per parallel batch, progress is reported in between.
+#define SCAN_FILE_BATCH_SIZE 1024
+// part of the scan progress bar used while listing directories, processing the files found fills the rest.
+#define SCAN_LIST_PROGRESS_SHARE 0.2f
+#define CONTENT_HASH_FILE_NAME "filesystem_content_hashes"
 
 void EditorFileSystemDirectory::sort_files() {
     eastl::sort(files.begin(),files.end());
@@ -218,72 +225,61 @@ void EditorFileSystem::_scan_from_cache()
 {
     String fscache = PathUtils::plus_file(EditorSettings::get_singleton()->get_project_settings_dir(), CACHE_FILE_NAME);
 
-    FileAccess *f = FileAccess::open(fscache, FileAccess::READ);
+    FileAccessRef f = FileAccess::open(fscache, FileAccess::READ);
     if (!f)
         return;
-    // read .fscache
-    String cpath;
-
-    bool first = true;
-
-    while (!f->eof_reached()) {
+    if (f->get_len() < 4 || f->get_32() != CACHE_FILE_MAGIC)
+        return;
 
-        String l(StringUtils::strip_edges(f->get_line()));
-        if (first) {
-            if (first_scan) {
-                // only use this on first scan, afterwards it gets ignored
-                // this is so on first reimport we synchronize versions, then
-                // we don't care until editor restart. This is for usability mainly so
-                // your workflow is not killed after changing a setting by forceful reimporting
-                // everything there is.
-                filesystem_settings_version_for_import = StringUtils::strip_edges(l);
-                if (filesystem_settings_version_for_import !=
-                        ResourceFormatImporter::get_singleton()->get_import_settings_hash()) {
-                    revalidate_import_files = true;
-                }
-            }
-            first = false;
-            continue;
+    String settings_hash = f->get_pascal_string();
+    if (first_scan) {
+        // only use this on first scan, afterwards it gets ignored
+        // this is so on first reimport we synchronize versions, then
+        // we don't care until editor restart. This is for usability mainly so
+        // your workflow is not killed after changing a setting by forceful reimporting
+        // everything there is.
+        filesystem_settings_version_for_import = settings_hash;
+        if (filesystem_settings_version_for_import != ResourceFormatImporter::get_singleton()->get_import_settings_hash()) {
+            revalidate_import_files = true;
         }
-        if (l.empty()) continue;
-
-        if (StringUtils::begins_with(l, "::")) {
-            Vector<StringView> split = StringUtils::split(l, "::");
-            ERR_CONTINUE(split.size() != 3);
-            StringView name = split[1];
+    }
 
-            cpath = name;
+    // a directory record is its path and file count, followed by that many file records.
+    while (f->get_8() == 1 && !f->eof_reached()) {
+        String cpath = f->get_pascal_string();
+        uint32_t file_count = f->get_32();
 
-        } else {
-            Vector<StringView> split = StringUtils::split(l, "::");
-            ERR_CONTINUE(split.size() != 8);
-            String name = PathUtils::plus_file(cpath, split[0]);
+        for (uint32_t i = 0; i < file_count && !f->eof_reached(); i++) {
+            String name = PathUtils::plus_file(cpath, f->get_pascal_string());
 
             FileCache fc;
-            fc.type = split[1];
-            fc.modification_time = StringUtils::to_int64(split[2]);
-            fc.import_modification_time = StringUtils::to_int64(split[3]);
-            fc.import_valid = StringUtils::to_int64(split[4]) != 0;
-            fc.import_group_file = StringUtils::strip_edges(split[5]);
-            fc.script_class_name = StringName(StringUtils::get_slice(split[6], "<>", 0));
-            fc.script_class_extends = StringName(StringUtils::get_slice(split[6], "<>", 1));
-            fc.script_class_icon_path = StringUtils::get_slice(split[6], "<>", 2);
-
-            StringView deps = StringUtils::strip_edges(split[7]);
-            if (deps.length()) {
-                Vector<StringView> dp = StringUtils::split(deps, "<>");
-                for (int i = 0; i < dp.size(); i++) {
-                    StringView path = dp[i];
-                    fc.deps.emplace_back(path);
-                }
+            fc.type = f->get_pascal_string();
+            fc.modification_time = f->get_64();
+            fc.import_modification_time = f->get_64();
+            fc.import_valid = f->get_8() != 0;
+            fc.import_group_file = f->get_pascal_string();
+            fc.script_class_name = StringName(f->get_pascal_string());
+            fc.script_class_extends = StringName(f->get_pascal_string());
+            fc.script_class_icon_path = f->get_pascal_string();
+
+            uint32_t dep_count = f->get_32();
+            fc.deps.reserve(dep_count);
+            for (uint32_t j = 0; j < dep_count && !f->eof_reached(); j++) {
+                fc.deps.emplace_back(f->get_pascal_string());
             }
 
-            file_cache[String(name)] = fc;
+            fc.imported_files_known = f->get_8() != 0;
+            uint32_t imported_count = f->get_32();
+            fc.imported_files.reserve(imported_count);
+            for (uint32_t j = 0; j < imported_count && !f->eof_reached(); j++) {
+                fc.imported_files.emplace_back(f->get_pascal_string());
+            }
+
+            if (f->eof_reached())
+                break; // truncated file, drop the partial entry.
+            file_cache[name] = eastl::move(fc);
         }
     }
-
-    f->close();
-    memdelete(f);
 }
 
 void EditorFileSystem::_scan_mark_updates()
@@ -330,6 +326,9 @@ void EditorFileSystem::_scan_filesystem() {
     new_filesystem = memnew(EditorFileSystemDirectory);
     new_filesystem->parent = nullptr;
 
+    // imported files live outside the scanned tree, changes there make change scans check every import again.
+    _watch_dir("res://.import");
+
     DirAccess *d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
     d->change_dir("res://");
     _scan_new_dir(new_filesystem, d, sp);
@@ -355,10 +354,116 @@ void EditorFileSystem::_save_filesystem_cache() {
     FileAccess *f = FileAccess::open(fscache, FileAccess::WRITE);
     ERR_FAIL_COND_MSG(!f, "Cannot create file '" + fscache + "'. Check user write permissions.");
 
-    f->store_line(filesystem_settings_version_for_import);
+    f->store_32(CACHE_FILE_MAGIC);
+    f->store_pascal_string(filesystem_settings_version_for_import);
     _save_filesystem_cache(filesystem, f);
+    f->store_8(0);
     f->close();
     memdelete(f);
+
+    _save_content_hashes();
+}
+
+void EditorFileSystem::_load_content_hashes() {
+
+    content_hashes_loaded = true;
+    String path = PathUtils::plus_file(EditorSettings::get_singleton()->get_project_settings_dir(), CONTENT_HASH_FILE_NAME);
+    FileAccessRef f = FileAccess::open(path, FileAccess::READ);
+    if (!f)
+        return;
+
+    while (!f->eof_reached()) {
+        String l(StringUtils::strip_edges(f->get_line()));
+        if (l.empty())
+            continue;
+
+        // md5::path<>path...::mtime,size,inode<>mtime,size,inode...
+        Vector<StringView> split = StringUtils::split(l, "::");
+        ERR_CONTINUE(split.size() != 3);
+        Vector<StringView> paths = StringUtils::split(split[1], "<>");
+        Vector<StringView> identities = StringUtils::split(split[2], "<>");
+        ERR_CONTINUE(paths.size() != identities.size());
+
+        ContentHash hash;
+        hash.md5 = split[0];
+        bool unchanged = true;
+        for (size_t i = 0; i < paths.size() && unchanged; i++) {
+            Vector<StringView> fields = StringUtils::split(identities[i], ",");
+            if (fields.size() != 3) {
+                unchanged = false;
+                break;
+            }
+            FileAccess::FileIdentity stored;
+            stored.modified_time = StringUtils::to_int64(fields[0]);
+            stored.size = StringUtils::to_int64(fields[1]);
+            stored.inode = StringUtils::to_int64(fields[2]);
+            // entries of files that changed or went away since the last session would never match again.
+            FileAccess::FileIdentity current;
+            unchanged = FileAccess::get_file_identity(paths[i], current) && current == stored;
+            hash.identities.push_back(stored);
+        }
+        if (unchanged) {
+            content_hashes[String(split[1])] = eastl::move(hash);
+        }
+    }
+}
+
+void EditorFileSystem::_save_content_hashes() {
+
+    MutexLock lock(content_hash_mutex);
+    if (!content_hashes_dirty)
+        return;
+
+    String path = PathUtils::plus_file(EditorSettings::get_singleton()->get_project_settings_dir(), CONTENT_HASH_FILE_NAME);
+    FileAccessRef f = FileAccess::open(path, FileAccess::WRITE);
+    ERR_FAIL_COND_MSG(!f, "Cannot create file '" + path + "'. Check user write permissions.");
+
+    for (const eastl::pair<const String, ContentHash> &E : content_hashes) {
+        String identities;
+        for (const FileAccess::FileIdentity &id : E.second.identities) {
+            if (!identities.empty())
+                identities += "<>";
+            identities += ::to_string(id.modified_time) + "," + ::to_string(id.size) + "," + ::to_string(id.inode);
+        }
+        f->store_line(E.second.md5 + "::" + E.first + "::" + identities);
+    }
+    content_hashes_dirty = false;
+}
+
+String EditorFileSystem::_get_content_md5(const Vector<String> &p_paths) {
+
+    Vector<FileAccess::FileIdentity> identities;
+    identities.resize(p_paths.size());
+    bool identified = true;
+    String key;
+    for (size_t i = 0; i < p_paths.size(); i++) {
+        identified = identified && FileAccess::get_file_identity(p_paths[i], identities[i]);
+        if (i > 0)
+            key += "<>";
+        key += p_paths[i];
+    }
+
+    if (identified) {
+        MutexLock lock(content_hash_mutex);
+        if (!content_hashes_loaded) {
+            _load_content_hashes();
+        }
+        auto iter = content_hashes.find(key);
+        if (iter != content_hashes.end() && iter->second.identities == identities) {
+            return iter->second.md5;
+        }
+    }
+
+    // hash outside of the lock, workers importing side by side hash their own files concurrently.
+    String md5 = p_paths.size() == 1 ? FileAccess::get_md5(p_paths[0]) : FileAccess::get_multiple_md5(p_paths);
+    if (identified && !md5.empty()) {
+        MutexLock lock(content_hash_mutex);
+        ContentHash &hash = content_hashes[key];
+        hash.identities = eastl::move(identities);
+        hash.md5 = md5;
+        content_hashes_dirty = true;
+    }
+    return md5;
 }
 
 void EditorFileSystem::_thread_func(void *_userdata) {
@@ -367,7 +472,7 @@ void EditorFileSystem::_thread_func(void *_userdata) {
     sd->_scan_filesystem();
 }
 
-bool EditorFileSystem::_test_for_reimport(StringView p_path, bool p_only_imported_files) {
+bool EditorFileSystem::_test_for_reimport(StringView p_path, bool p_only_imported_files, Vector<String> *r_imported_files) {
 
     if (!reimport_on_missing_imported_files && p_only_imported_files)
         return false;
@@ -478,6 +583,12 @@ bool EditorFileSystem::_test_for_reimport(StringView p_path, bool p_only_importe
     VariantParser::release_stream(md5_stream);
     memdelete(md5s);
 
+    if (r_imported_files) {
+        *r_imported_files = to_check;
+        // the md5 file is written by the import as well, losing it must trigger a reimport like losing any output.
+        r_imported_files->push_back(base_path + ".md5");
+    }
+
     //imported files are gone, reimport
     for (const String &E : to_check) {
         if (!FileAccess::exists(E)) {
@@ -496,13 +607,13 @@ bool EditorFileSystem::_test_for_reimport(StringView p_path, bool p_only_importe
             return true; //lacks md5, so just reimport
         }
 
-        String md5(FileAccess::get_md5(p_path));
+        String md5(_get_content_md5({ String(p_path) }));
         if (md5 != source_md5) {
             return true;
         }
 
         if (!dest_files.empty() && !dest_md5.empty()) {
-            md5 = FileAccess::get_multiple_md5(dest_files);
+            md5 = _get_content_md5(dest_files);
             if (md5 != dest_md5) {
                 return true;
             }
@@ -512,6 +623,31 @@ bool EditorFileSystem::_test_for_reimport(StringView p_path, bool p_only_importe
     return false; //nothing changed
 }
 
+bool EditorFileSystem::_test_imported_files(StringView p_path, EditorFileSystemDirectory::FileInfo *p_file) {
+
+    if (!reimport_on_missing_imported_files)
+        return false;
+
+    if (p_file->imported_files_known && trust_imported_files && !revalidate_import_files) {
+        // the .import file and the import settings are unchanged since it was parsed, only check that its outputs
+        // (including the .md5 file) still exist.
+        for (const String &E : p_file->imported_files) {
+            if (!FileAccess::exists(E)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Vector<String> imported_files;
+    if (_test_for_reimport(p_path, true, &imported_files)) {
+        return true;
+    }
+    p_file->imported_files = eastl::move(imported_files);
+    p_file->imported_files_known = true;
+    return false;
+}
+
 bool EditorFileSystem::_update_scan_actions() {
 
     sources_changed.clear();
@@ -594,6 +730,7 @@ bool EditorFileSystem::_update_scan_actions() {
                     //update modified times, to avoid reimport
                     ia.dir->files[idx]->modified_time = FileAccess::get_modified_time(full_path);
                     ia.dir->files[idx]->import_modified_time = FileAccess::get_modified_time(full_path + ".import");
+                    ia.dir->files[idx]->imported_files_known = false;
                 }
 
                 fs_changed = true;
@@ -639,6 +776,18 @@ void EditorFileSystem::scan() {
 
     _update_extensions();
 
+    // everything gets listed again, the directories are watched anew while that happens.
+    if (dir_watcher) {
+        Vector<String> ignored;
+        bool overflow = false;
+        dir_watcher->read_changes(ignored, overflow);
+    }
+    dir_watch_failed = false;
+    // lists gathered under other import settings need are_import_settings_valid() to run again.
+    String settings_hash = ResourceFormatImporter::get_singleton()->get_import_settings_hash();
+    trust_imported_files = imported_files_settings_hash.empty() || settings_hash == imported_files_settings_hash;
+    imported_files_settings_hash = settings_hash;
+
     abort_scan = false;
     if (!use_threads) {
         scanning = true;
@@ -684,15 +833,74 @@ EditorFileSystem::ScanProgress EditorFileSystem::ScanProgress::get_sub(int p_cur
     return sp;
 }
 
-void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess *da, const ScanProgress &p_progress) {
+namespace {
+template <class T>
+void _run_scan_tasks(bool p_threaded, uint32_t p_count, EditorFileSystem *p_efs, void (EditorFileSystem::*p_method)(uint32_t, T *), T *p_tasks) {
+    if (p_threaded) {
+        ThreadWorkPool::get_singleton()->do_work(p_count, p_efs, p_method, p_tasks);
+    } else {
+        for (uint32_t i = 0; i < p_count; i++) {
+            (p_efs->*p_method)(i, p_tasks);
+        }
+    }
+}
+} // end of anonymous namespace
 
-    Vector<String> dirs;
-    Vector<String> files;
+void EditorFileSystem::_watch_dir(const String &p_path) {
+
+    if (dir_watcher && !dir_watch_failed && !dir_watcher->add_watch(p_path)) {
+        // without a complete set of watches change scans have to look at every directory again.
+        dir_watch_failed = true;
+    }
+}
+
+void EditorFileSystem::_collect_watched_changes() {
+
+    changed_dirs.clear();
+    scan_changed_dirs_only = false;
+
+    // outputs listed under other import settings may not be the ones a reimport would produce now.
+    String settings_hash = ResourceFormatImporter::get_singleton()->get_import_settings_hash();
+    trust_imported_files = settings_hash == imported_files_settings_hash;
+    imported_files_settings_hash = settings_hash;
+
+    if (!dir_watcher || dir_watch_failed)
+        return;
+
+    Vector<String> changed;
+    bool overflow = false;
+    dir_watcher->read_changes(changed, overflow);
+    if (overflow || !trust_imported_files)
+        return;
+    for (String &path : changed) {
+        if (path == "res://.import") {
+            changed_dirs.clear();
+            return;
+        }
+        changed_dirs.insert(eastl::move(path));
+    }
+    scan_changed_dirs_only = true;
+}
+
+void EditorFileSystem::_scan_dir_entries(uint32_t p_index, ScanDirTask *p_tasks) {
 
-    String cd = da->get_current_dir();
+    EditorFileSystemDirectory *p_dir = p_tasks[p_index].dir;
+    const String &cd = p_tasks[p_index].path;
 
+    // watch before listing, so nothing that changes in between is missed. Keyed like get_path(), which the change
+    // scan looks the directories up with.
+    _watch_dir(p_dir->get_path());
     p_dir->modified_time = FileAccess::get_modified_time(cd);
 
+    DirAccessRef da = DirAccess::create(DirAccess::ACCESS_RESOURCES);
+    if (da->change_dir(cd) != OK) {
+        ERR_PRINT("Cannot go into subdir: " + cd);
+        return;
+    }
+
+    Vector<String> dirs;
+    Vector<String> files;
+
     da->list_dir_begin();
     while (true) {
 
@@ -725,51 +933,28 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess
     eastl::sort(dirs.begin(),dirs.end(),NaturalNoCaseComparator());
     eastl::sort(files.begin(),files.end(),NaturalNoCaseComparator());
 
-    int total = dirs.size() + files.size();
-    int idx = -1;
-
     for (const String &entry : dirs) {
-        idx++;
-
-        if (da->change_dir(entry) == OK) {
-
-            String d = da->get_current_dir();
-
-            if (d == cd || !StringUtils::begins_with(d,cd)) {
-                da->change_dir(cd); //avoid recursion
-            } else {
-
-                EditorFileSystemDirectory *efd = memnew(EditorFileSystemDirectory);
-
-                efd->parent = p_dir;
-                efd->name = entry;
 
-                _scan_new_dir(efd, da, p_progress.get_sub(idx, total));
-
-                int idx2 = 0;
-                for (int j = 0; j < p_dir->subdirs.size(); j++) {
-
-                    if (efd->name < p_dir->subdirs[j]->name)
-                        break;
-                    idx2++;
-                }
-                if (idx2 == p_dir->subdirs.size()) {
-                    p_dir->subdirs.push_back(efd);
-                } else {
-                    p_dir->subdirs.insert(p_dir->subdirs.begin()+idx2, efd);
-                }
-
-                da->change_dir("..");
-            }
-        } else {
+        if (da->change_dir(entry) != OK) {
             ERR_PRINT("Cannot go into subdir: " + entry);
+            continue;
+        }
+        String d = da->get_current_dir();
+        da->change_dir(cd);
+        if (d == cd || !StringUtils::begins_with(d,cd)) {
+            continue; //avoid recursion
         }
 
-        p_progress.update(idx, total);
+        EditorFileSystemDirectory *efd = memnew(EditorFileSystemDirectory);
+        efd->parent = p_dir;
+        efd->name = entry;
+        p_dir->subdirs.push_back(efd);
     }
-    ResourceFormatImporter *rfi = ResourceFormatImporter::get_singleton();
-    for (size_t i=0,fin=files.size(); i<fin; ++i, ++idx) {
-        const String &fname(files[i]);
+    eastl::sort(p_dir->subdirs.begin(), p_dir->subdirs.end(), [](const EditorFileSystemDirectory *a, const EditorFileSystemDirectory *b) {
+        return a->name < b->name;
+    });
+
+    for (const String &fname : files) {
 
         String ext = StringUtils::to_lower(PathUtils::get_extension(fname));
         if (!valid_extensions.contains(ext)) {
@@ -778,99 +963,163 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess
 
         EditorFileSystemDirectory::FileInfo *fi = memnew(EditorFileSystemDirectory::FileInfo);
         fi->file = fname;
+        p_dir->files.push_back(fi);
+    }
+}
 
-        String path = PathUtils::plus_file(cd,fi->file);
-
-        auto fc_iter = file_cache.find(path);
-        FileCache *fc = file_cache.end()==fc_iter ? nullptr : &fc_iter->second;
-        uint64_t mt = FileAccess::get_modified_time(path);
+void EditorFileSystem::_scan_file_info(uint32_t p_index, ScanFileTask *p_tasks) {
 
-        if (import_extensions.contains(ext) && ResourceFormatImporter::get_singleton()->any_can_import(path)) {
+    ScanFileTask &task = p_tasks[p_index];
+    EditorFileSystemDirectory::FileInfo *fi = task.file;
+    const String &path = task.path;
+    String ext = StringUtils::to_lower(PathUtils::get_extension(fi->file));
+    ResourceFormatImporter *rfi = ResourceFormatImporter::get_singleton();
 
-            //is imported
-            uint64_t import_mt = 0;
-            if (FileAccess::exists(path + ".import")) {
-                import_mt = FileAccess::get_modified_time(path + ".import");
-            }
+    auto fc_iter = file_cache.find(path);
+    const FileCache *fc = file_cache.end()==fc_iter ? nullptr : &fc_iter->second;
+    uint64_t mt = FileAccess::get_modified_time(path);
 
-            if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
+    if (import_extensions.contains(ext) && rfi->any_can_import(path)) {
 
-                fi->type = StringName(fc->type);
-                fi->deps = fc->deps;
-                fi->modified_time = fc->modification_time;
-                fi->import_modified_time = fc->import_modification_time;
+        //is imported
+        uint64_t import_mt = 0;
+        if (FileAccess::exists(path + ".import")) {
+            import_mt = FileAccess::get_modified_time(path + ".import");
+        }
 
-                fi->import_valid = fc->import_valid;
-                fi->script_class_name = fc->script_class_name;
-                fi->import_group_file = fc->import_group_file;
-                fi->script_class_extends = fc->script_class_extends;
-                fi->script_class_icon_path = fc->script_class_icon_path;
+        bool cache_valid = false;
+        if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt) {
+            fi->imported_files = fc->imported_files;
+            fi->imported_files_known = fc->imported_files_known;
+            cache_valid = !_test_imported_files(path, fi);
+        }
 
-                if (revalidate_import_files && !rfi->are_import_settings_valid(path)) {
-                    ItemAction ia;
-                    ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-                    ia.dir = p_dir;
-                    ia.file = fname;
-                    scan_actions.push_back(ia);
-                }
+        if (cache_valid) {
 
-                if (fc->type.empty()) {
-                    fi->type = StringName(gResourceManager().get_resource_type(path));
-                    fi->import_group_file = gResourceManager().get_import_group_file(path);
-                    //there is also the chance that file type changed due to reimport, must probably check this somehow here
-                    //(or kind of note it for next time in another file?)
-                    //note: I think this should not happen any longer..
-                }
+            fi->type = StringName(fc->type);
+            fi->deps = fc->deps;
+            fi->modified_time = fc->modification_time;
+            fi->import_modified_time = fc->import_modification_time;
 
-            } else {
+            fi->import_valid = fc->import_valid;
+            fi->script_class_name = fc->script_class_name;
+            fi->import_group_file = fc->import_group_file;
+            fi->script_class_extends = fc->script_class_extends;
+            fi->script_class_icon_path = fc->script_class_icon_path;
 
-                fi->type = StringName(rfi->get_resource_type(path));
-                fi->import_group_file = rfi->get_import_group_file(path);
-                fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-                fi->modified_time = 0;
-                fi->import_modified_time = 0;
-                fi->import_valid = gResourceManager().is_import_valid(path);
+            if (revalidate_import_files && !rfi->are_import_settings_valid(path)) {
+                task.test_reimport = true;
+            }
 
-                ItemAction ia;
-                ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-                ia.dir = p_dir;
-                ia.file = fname;
-                scan_actions.push_back(ia);
+            if (fc->type.empty()) {
+                fi->type = StringName(gResourceManager().get_resource_type(path));
+                fi->import_group_file = gResourceManager().get_import_group_file(path);
+                //there is also the chance that file type changed due to reimport, must probably check this somehow here
+                //(or kind of note it for next time in another file?)
+                //note: I think this should not happen any longer..
             }
+
         } else {
 
-            if (fc && fc->modification_time == mt) {
-                //not imported, so just update type if changed
-                fi->type = StringName(fc->type);
-                fi->modified_time = fc->modification_time;
-                fi->deps = fc->deps;
-                fi->import_modified_time = 0;
-                fi->import_valid = true;
-                fi->script_class_name = fc->script_class_name;
-                fi->script_class_extends = fc->script_class_extends;
-                fi->script_class_icon_path = fc->script_class_icon_path;
-            } else {
-                //new or modified time
-                fi->type = StringName(gResourceManager().get_resource_type(path));
-                fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-                fi->deps = _get_dependencies(path);
-                fi->modified_time = mt;
-                fi->import_modified_time = 0;
-                fi->import_valid = true;
+            fi->type = StringName(rfi->get_resource_type(path));
+            fi->import_group_file = rfi->get_import_group_file(path);
+            fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
+            fi->modified_time = 0;
+            fi->import_modified_time = 0;
+            fi->import_valid = gResourceManager().is_import_valid(path);
+            fi->imported_files_known = false;
+
+            task.test_reimport = true;
+        }
+    } else {
+
+        if (fc && fc->modification_time == mt) {
+            //not imported, so just update type if changed
+            fi->type = StringName(fc->type);
+            fi->modified_time = fc->modification_time;
+            fi->deps = fc->deps;
+            fi->import_modified_time = 0;
+            fi->import_valid = true;
+            fi->script_class_name = fc->script_class_name;
+            fi->script_class_extends = fc->script_class_extends;
+            fi->script_class_icon_path = fc->script_class_icon_path;
+        } else {
+            //new or modified time
+            fi->type = StringName(gResourceManager().get_resource_type(path));
+            fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
+            fi->deps = _get_dependencies(path);
+            fi->modified_time = mt;
+            fi->import_modified_time = 0;
+            fi->import_valid = true;
+        }
+    }
+}
+
+void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess *da, const ScanProgress &p_progress) {
+
+    // The tree is listed one level at a time, with the directories of a level spread over the work pool, then the
+    // files found are processed in parallel batches. This keeps workers busy however unbalanced the tree is.
+    Vector<ScanDirTask> level;
+    level.push_back({ p_dir, da->get_current_dir() });
+    Vector<ScanFileTask> files;
+
+    // the depth isn't known while listing, so every level moves the listing part of the bar closer to its end.
+    ScanProgress list_progress = p_progress;
+    list_progress.hi = p_progress.low + (p_progress.hi - p_progress.low) * SCAN_LIST_PROGRESS_SHARE;
+    ScanProgress file_progress = p_progress;
+    file_progress.low = list_progress.hi;
+    int levels = 0;
+
+    while (!level.empty()) {
+        _run_scan_tasks(use_threads, level.size(), this, &EditorFileSystem::_scan_dir_entries, level.data());
+
+        Vector<ScanDirTask> next_level;
+        for (const ScanDirTask &task : level) {
+            for (EditorFileSystemDirectory *subdir : task.dir->subdirs) {
+                next_level.push_back({ subdir, PathUtils::plus_file(task.path, subdir->name) });
+            }
+            for (EditorFileSystemDirectory::FileInfo *fi : task.dir->files) {
+                files.push_back({ task.dir, fi, PathUtils::plus_file(task.path, fi->file), false });
             }
         }
+        level = eastl::move(next_level);
+        levels++;
+        list_progress.update(levels, levels + 1);
+    }
 
-        p_dir->files.push_back(fi);
-        p_progress.update(idx, total);
+    const int total = files.size();
+    for (int from = 0; from < total; from += SCAN_FILE_BATCH_SIZE) {
+        int count = MIN(SCAN_FILE_BATCH_SIZE, total - from);
+        _run_scan_tasks(use_threads, count, this, &EditorFileSystem::_scan_file_info, files.data() + from);
+        file_progress.update(from + count, total);
+    }
+
+    for (const ScanFileTask &task : files) {
+        if (task.test_reimport) {
+            ItemAction ia;
+            ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+            ia.dir = task.dir;
+            ia.file = task.file->file;
+            scan_actions.push_back(ia);
+        }
     }
 }
 
 void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress) {
 
-    uint64_t current_mtime = FileAccess::get_modified_time(p_dir->get_path());
+    String cd = p_dir->get_path();
+
+    if (scan_changed_dirs_only && !changed_dirs.contains(cd)) {
+        // nothing in this directory changed since it was last looked at.
+        for (EditorFileSystemDirectory *subdir : p_dir->subdirs) {
+            _scan_fs_changes(subdir, p_progress);
+        }
+        return;
+    }
+
+    uint64_t current_mtime = FileAccess::get_modified_time(cd);
 
     bool updated_dir = false;
-    String cd = p_dir->get_path();
 
     if (current_mtime != p_dir->modified_time || using_fat32_or_exfat) {
 
@@ -1016,7 +1265,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
                 uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
                 if (import_mt != p_dir->files[i]->import_modified_time) {
                     reimport = true;
-                } else if (_test_for_reimport(path, true)) {
+                } else if (_test_imported_files(path, p_dir->files[i])) {
                     reimport = true;
                 }
             }
@@ -1103,6 +1352,7 @@ void EditorFileSystem::scan_changes() {
 
     _update_extensions();
     sources_changed.clear();
+    _collect_watched_changes();
     scanning_changes = true;
     scanning_changes_done = false;
 
@@ -1225,31 +1475,38 @@ void EditorFileSystem::_save_filesystem_cache(EditorFileSystemDirectory *p_dir,
 
     if (!p_dir)
         return; //none
-    p_file->store_line(FormatVE("::%s::%luz",p_dir->get_path().c_str(),p_dir->modified_time));
+    p_file->store_8(1);
+    p_file->store_pascal_string(p_dir->get_path());
+    p_file->store_32(p_dir->files.size());
 
-    for (size_t i = 0; i < p_dir->files.size(); i++) {
+    for (const EditorFileSystemDirectory::FileInfo *fi : p_dir->files) {
 
-        if (!p_dir->files[i]->import_group_file.empty()) {
-            group_file_cache.insert(p_dir->files[i]->import_group_file);
+        if (!fi->import_group_file.empty()) {
+            group_file_cache.insert(fi->import_group_file);
         }
-        String s = p_dir->files[i]->file + "::" + p_dir->files[i]->type + "::" + ::to_string(p_dir->files[i]->modified_time) +
-                   "::" + ::to_string(p_dir->files[i]->import_modified_time) + "::" + ::to_string(p_dir->files[i]->import_valid) +
-                   "::" + p_dir->files[i]->import_group_file + "::" + p_dir->files[i]->script_class_name + "<>" +
-                   p_dir->files[i]->script_class_extends + "<>" + p_dir->files[i]->script_class_icon_path;
-        s += "::";
-        for (int j = 0; j < p_dir->files[i]->deps.size(); j++) {
-
-            if (j > 0)
-                s += "<>";
-            s += p_dir->files[i]->deps[j];
+        p_file->store_pascal_string(fi->file);
+        p_file->store_pascal_string(fi->type);
+        p_file->store_64(fi->modified_time);
+        p_file->store_64(fi->import_modified_time);
+        p_file->store_8(fi->import_valid);
+        p_file->store_pascal_string(fi->import_group_file);
+        p_file->store_pascal_string(fi->script_class_name);
+        p_file->store_pascal_string(fi->script_class_extends);
+        p_file->store_pascal_string(fi->script_class_icon_path);
+        p_file->store_32(fi->deps.size());
+        for (const String &dep : fi->deps) {
+            p_file->store_pascal_string(dep);
+        }
+        p_file->store_8(fi->imported_files_known);
+        p_file->store_32(fi->imported_files.size());
+        for (const String &imported : fi->imported_files) {
+            p_file->store_pascal_string(imported);
         }
-
-        p_file->store_line(s);
     }
 
-    for (size_t i = 0; i < p_dir->subdirs.size(); i++) {
+    for (EditorFileSystemDirectory *subdir : p_dir->subdirs) {
 
-        _save_filesystem_cache(p_dir->subdirs[i], p_file);
+        _save_filesystem_cache(subdir, p_file);
     }
 }
 
@@ -1694,9 +1951,9 @@ Error EditorFileSystem::_reimport_group(StringView p_group_file, const Vector<St
         FileAccessRef md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
         ERR_FAIL_COND_V_MSG(!md5s, ERR_FILE_CANT_OPEN, "Cannot open MD5 file '" + base_path + ".md5'.");
 
-        md5s->store_line("source_md5=\"" + FileAccess::get_md5(file) + "\"");
+        md5s->store_line("source_md5=\"" + _get_content_md5({ file }) + "\"");
         if (!dest_paths.empty()) {
-            md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
+            md5s->store_line("dest_md5=\"" + _get_content_md5(dest_paths) + "\"\n");
         }
         md5s->close();
 
@@ -1708,6 +1965,7 @@ Error EditorFileSystem::_reimport_group(StringView p_group_file, const Vector<St
         //update modified times, to avoid reimport
         fs->files[cpos]->modified_time = FileAccess::get_modified_time(file);
         fs->files[cpos]->import_modified_time = FileAccess::get_modified_time(file + ".import");
+        fs->files[cpos]->imported_files_known = false;
         fs->files[cpos]->deps = _get_dependencies(file);
         fs->files[cpos]->type = importer->get_resource_type();
         fs->files[cpos]->import_valid = err == OK;
@@ -1732,7 +1990,7 @@ Error EditorFileSystem::_reimport_group(StringView p_group_file, const Vector<St
     return err;
 }
 
-Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_missing_deps, bool final_try) {
+Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_missing_deps, bool final_try, bool p_threaded) {
 
     EditorFileSystemDirectory *fs = nullptr;
     int cpos = -1;
@@ -1761,6 +2019,7 @@ Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_m
         }
 
     } else {
+        MutexLock lock(reimport_mutex);
         late_added_files.insert(p_file); //imported files do not call update_file(), but just in case..
     }
 
@@ -1905,9 +2164,9 @@ Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_m
     // Store the md5's of the various files. These are stored separately so that the .import files can be version controlled.
     FileAccess *md5s = FileAccess::open(base_path + ".md5", FileAccess::WRITE);
     ERR_FAIL_COND_V(!md5s,ERR_FILE_CANT_WRITE);
-    md5s->store_line("source_md5=\"" + FileAccess::get_md5(p_file) + "\"");
+    md5s->store_line("source_md5=\"" + _get_content_md5({ p_file }) + "\"");
     if (!dest_paths.empty()) {
-        md5s->store_line("dest_md5=\"" + FileAccess::get_multiple_md5(dest_paths) + "\"\n");
+        md5s->store_line("dest_md5=\"" + _get_content_md5(dest_paths) + "\"\n");
     }
     md5s->close();
     memdelete(md5s);
@@ -1915,10 +2174,20 @@ Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_m
     //update modified times, to avoid reimport
     fs->files[cpos]->modified_time = FileAccess::get_modified_time(p_file);
     fs->files[cpos]->import_modified_time = FileAccess::get_modified_time(p_file + ".import");
+    fs->files[cpos]->imported_files_known = false;
     fs->files[cpos]->deps = _get_dependencies(p_file);
     fs->files[cpos]->type = importer->get_resource_type();
     fs->files[cpos]->import_valid = gResourceManager().is_import_valid(p_file);
 
+    // threaded imports leave the main thread steps to the caller, which runs them once the batch is done.
+    if (!p_threaded) {
+        _reimport_file_finish(p_file);
+    }
+    return OK;
+}
+
+void EditorFileSystem::_reimport_file_finish(const String &p_file) {
+
     //if file is currently up, maybe the source it was loaded from changed, so import math must be updated for it
     //to reload properly
     if (ResourceCache::has(p_file)) {
@@ -1934,7 +2203,11 @@ Error EditorFileSystem::_reimport_file(const String &p_file, Vector<String> &r_m
     }
 
     EditorResourcePreview::get_singleton()->check_for_invalidation(p_file);
-    return OK;
+}
+
+void EditorFileSystem::_reimport_file_threaded(uint32_t p_index, ThreadedImportBatch *p_batch) {
+
+    p_batch->errors[p_index] = _reimport_file(p_batch->files[p_index].path, p_batch->missing_deps[p_index], false, true);
 }
 
 void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, Map<String, Vector<String> > &group_files, Set<String> &groups_to_reimport) {
@@ -1959,21 +2232,45 @@ void EditorFileSystem::ordered_reimport(EditorProgress &pr, Vector<ImportFile> &
     correct_imports.reserve(files.size());
 
     int idx=0;
-    // At the beginning we don't know cross-resource dependencies, so we go linearly
-    for (const auto & fi : files) {
-        pr.step(StringName(PathUtils::get_file(fi.path)), idx);
-        Vector<String> deps;
-
-        auto err = _reimport_file(fi.path, deps);
-
-        if (err == OK) {
-            idx++; // count success as progress
-            correct_imports.insert(fi.path);
+    // At the beginning we don't know cross-resource dependencies, so we go linearly.
+    // Runs of files sharing an import order whose importer is thread-safe are imported side by side, in batches small
+    // enough to keep the progress dialog moving.
+    ThreadWorkPool *pool = ThreadWorkPool::get_singleton();
+    const size_t batch_size = (pool->get_thread_count() + 1) * 4;
+    size_t i = 0;
+    while (i < files.size()) {
+        size_t end = i + 1;
+        while (files[i].threaded && end < files.size() && end - i < batch_size && files[end].threaded &&
+                files[end].order == files[i].order) {
+            ++end;
+        }
+        const size_t count = end - i;
+        pr.step(StringName(PathUtils::get_file(files[i].path)), idx);
+
+        Vector<Vector<String>> deps(count);
+        Vector<Error> errors(count, OK);
+        if (count == 1) {
+            errors[0] = _reimport_file(files[i].path, deps[0]);
+        } else {
+            ThreadedImportBatch batch { files.data() + i, deps.data(), errors.data() };
+            pool->do_work(uint32_t(count), this, &EditorFileSystem::_reimport_file_threaded, &batch);
         }
-        else if(ERR_FILE_MISSING_DEPENDENCIES==err) {
-            // This path is missing those dependencies:
-            missing_deps[fi.path].insert(eastl::make_move_iterator(deps.begin()), eastl::make_move_iterator(deps.end()));
+
+        for (size_t j = 0; j < count; j++) {
+            const String &path = files[i + j].path;
+            if (errors[j] == OK) {
+                if (count > 1) {
+                    _reimport_file_finish(path);
+                }
+                idx++; // count success as progress
+                correct_imports.insert(path);
+            }
+            else if(ERR_FILE_MISSING_DEPENDENCIES==errors[j]) {
+                // This path is missing those dependencies:
+                missing_deps[path].insert(eastl::make_move_iterator(deps[j].begin()), eastl::make_move_iterator(deps[j].end()));
+            }
         }
+        i = end;
     }
     if(missing_deps.empty())
         return;
@@ -2077,7 +2374,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
             //it's a regular file
             ImportFile ifile;
             ifile.path = p_file;
-            ifile.order = ResourceFormatImporter::get_singleton()->get_import_order(p_file);
+            ResourceImporterInterface *importer = ResourceFormatImporter::get_singleton()->get_importer_for_path(p_file);
+            ifile.order = importer ? importer->get_import_order() : 0;
+            ifile.threaded = importer && importer->can_import_threaded();
             files.push_back(ifile);
         }
 
@@ -2249,7 +2548,15 @@ EditorFileSystem::EditorFileSystem() {
     first_scan = true;
     scan_changes_pending = false;
     revalidate_import_files = false;
+
+    dir_watcher = DirWatcher::create();
+    dir_watch_failed = false;
+    scan_changed_dirs_only = false;
+    trust_imported_files = true;
 }
 
 EditorFileSystem::~EditorFileSystem() {
+    if (dir_watcher) {
+        memdelete(dir_watcher);
+    }
 }
@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/os/dir_access.h"
+#include "core/os/dir_watcher.h"
+#include "core/os/file_access.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/list.h"
@@ -41,7 +44,8 @@
 #include "core/string.h"
 #include "core/translation_helpers.h"
 #include "scene/main/node.h"
-class FileAccess;
+
+#include <atomic>
 
 struct EditorProgressBG;
 struct EditorProgress;
@@ -69,6 +73,9 @@ class GODOT_EXPORT EditorFileSystemDirectory : public Object {
         StringName script_class_name;
         StringName script_class_extends;
         String script_class_icon_path;
+        // outputs listed in the .import file, so unchanged imports don't need it parsed again to check they exist.
+        Vector<String> imported_files;
+        bool imported_files_known = false;
     };
 
     struct FileInfoSort {
@@ -181,6 +188,8 @@ class GODOT_EXPORT EditorFileSystem : public Node {
         StringName script_class_name;
         StringName script_class_extends;
         String script_class_icon_path;
+        Vector<String> imported_files;
+        bool imported_files_known;
     };
 
     HashMap<String, FileCache> file_cache;
@@ -206,7 +215,30 @@ class GODOT_EXPORT EditorFileSystem : public Node {
     Set<String> valid_extensions;
     Set<String> import_extensions;
 
+    struct ScanDirTask {
+        EditorFileSystemDirectory *dir;
+        String path;
+    };
+
+    struct ScanFileTask {
+        EditorFileSystemDirectory *dir;
+        EditorFileSystemDirectory::FileInfo *file;
+        String path;
+        bool test_reimport;
+    };
+
     void _scan_new_dir(EditorFileSystemDirectory *p_dir, DirAccess *da, const ScanProgress &p_progress);
+    void _scan_dir_entries(uint32_t p_index, ScanDirTask *p_tasks);
+    void _scan_file_info(uint32_t p_index, ScanFileTask *p_tasks);
+
+    // Directories that changed since the last scan, reported by the platform so change scans can skip the others.
+    DirWatcher *dir_watcher;
+    std::atomic<bool> dir_watch_failed;
+    bool scan_changed_dirs_only;
+    Set<String> changed_dirs;
+
+    void _watch_dir(const String &p_path);
+    void _collect_watched_changes();
 
     Thread thread_sources;
     bool scanning_changes;
@@ -221,10 +253,16 @@ class GODOT_EXPORT EditorFileSystem : public Node {
 
     void _update_extensions();
 
-    Error _reimport_file(const String &p_file, Vector<String> &r_missing_deps, bool final_try=false);
+    Error _reimport_file(const String &p_file, Vector<String> &r_missing_deps, bool final_try=false, bool p_threaded=false);
+    void _reimport_file_finish(const String &p_file);
     Error _reimport_group(StringView p_group_file, const Vector<String> &p_files);
 
-    bool _test_for_reimport(StringView p_path, bool p_only_imported_files);
+    bool _test_for_reimport(StringView p_path, bool p_only_imported_files, Vector<String> *r_imported_files = nullptr);
+    bool _test_imported_files(StringView p_path, EditorFileSystemDirectory::FileInfo *p_file);
+
+    // Import settings the cached FileInfo::imported_files were checked against.
+    String imported_files_settings_hash;
+    bool trust_imported_files;
 
     bool reimport_on_missing_imported_files;
 
@@ -233,11 +271,34 @@ class GODOT_EXPORT EditorFileSystem : public Node {
     struct ImportFile {
         String path;
         int order;
+        bool threaded = false; // importer can run on worker threads
         bool operator<(const ImportFile &p_if) const {
             return order < p_if.order;
         }
     };
 
+    struct ThreadedImportBatch {
+        const ImportFile *files;
+        Vector<String> *missing_deps;
+        Error *errors;
+    };
+    Mutex reimport_mutex; // guards state touched by _reimport_file from worker threads
+    void _reimport_file_threaded(uint32_t p_index, ThreadedImportBatch *p_batch);
+
+    // MD5s of imported sources and of their outputs, reused while the files' identities don't change.
+    struct ContentHash {
+        Vector<FileAccess::FileIdentity> identities;
+        String md5;
+    };
+    HashMap<String, ContentHash> content_hashes; // keyed by the '<>' separated list of hashed paths
+    Mutex content_hash_mutex;
+    bool content_hashes_loaded = false;
+    bool content_hashes_dirty = false;
+
+    String _get_content_md5(const Vector<String> &p_paths);
+    void _load_content_hashes();
+    void _save_content_hashes();
+
     void _scan_script_classes(EditorFileSystemDirectory *p_dir);
     volatile bool update_script_classes_queued;
     void _queue_update_script_classes();
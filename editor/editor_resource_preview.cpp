@@ -35,12 +35,16 @@
 #include "editor_settings.h"
 
 #include "core/method_bind.h"
+#include "core/io/compression.h"
+#include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/resource/resource_manager.h"
 #include "core/message_queue.h"
+#include "core/os/dir_access.h"
 #include "core/os/file_access.h"
 #include "core/os/mutex.h"
 #include "core/project_settings.h"
+#include "core/set.h"
 
 #include "servers/rendering_server.h"
 
@@ -107,6 +111,368 @@ EditorResourcePreviewGenerator::EditorResourcePreviewGenerator() {
 
 EditorResourcePreview *EditorResourcePreview::singleton = nullptr;
 
+// Every on-disk thumbnail lives in a single append-only file. A path record maps a globalized file path to its
+// modification time and content md5, a thumbnail record stores the zstd compressed images generated for one md5 at one
+// thumbnail size. Superseded records are skipped when the file is indexed and dropped when it gets compacted.
+struct EditorResourcePreview::ThumbnailDatabase {
+    enum {
+        MAGIC = 0x42445452, // "RTDB"
+        VERSION = 1,
+        RECORD_PATH = 1,
+        RECORD_THUMBNAIL = 2,
+        RECORD_HEADER_SIZE = 5,
+        MIN_COMPACT_SIZE = 256 * 1024,
+    };
+
+    struct PathEntry {
+        String md5;
+        uint64_t modified_time;
+        uint32_t record_size;
+    };
+
+    struct ThumbnailEntry {
+        uint64_t record_offset;
+        uint32_t record_size;
+    };
+
+    Mutex mutex;
+    String db_path;
+    FileAccess *file = nullptr;
+    Map<String, PathEntry> paths;
+    Map<String, ThumbnailEntry> thumbnails;
+    // end of the last valid record, a damaged tail gets overwritten by the next append.
+    uint64_t append_offset = 0;
+    uint64_t dead_bytes = 0;
+
+    static String _thumbnail_key(StringView p_md5, int p_size) {
+        return String(p_md5) + ":" + itos(p_size);
+    }
+
+    void _store_path_record(FileAccess *f, StringView p_path, const PathEntry &p_entry) {
+        uint64_t start = f->get_position();
+        f->store_8(RECORD_PATH);
+        f->store_32(0);
+        f->store_pascal_string(p_path);
+        f->store_64(p_entry.modified_time);
+        f->store_pascal_string(p_entry.md5);
+        uint64_t end = f->get_position();
+        f->seek(start + 1);
+        f->store_32(uint32_t(end - start - RECORD_HEADER_SIZE));
+        f->seek(end);
+    }
+
+    bool _create(StringView p_path) {
+        file = FileAccess::open(p_path, FileAccess::WRITE_READ);
+        ERR_FAIL_COND_V_MSG(!file, false, "Cannot create thumbnail database '" + String(p_path) + "'. Check user write permissions.");
+        file->store_32(MAGIC);
+        file->store_32(VERSION);
+        append_offset = file->get_position();
+        return true;
+    }
+
+    //! Builds the in-memory index, stops at the first truncated record (e.g. after a crash while appending).
+    void _index() {
+        uint64_t len = file->get_len();
+        uint64_t pos = 8;
+        while (pos + RECORD_HEADER_SIZE <= len) {
+            file->seek(pos);
+            uint8_t type = file->get_8();
+            uint32_t size = file->get_32();
+            uint64_t record_end = pos + RECORD_HEADER_SIZE + size;
+            if (record_end > len) {
+                break;
+            }
+            if (type == RECORD_PATH) {
+                String path = file->get_pascal_string();
+                PathEntry entry;
+                entry.modified_time = file->get_64();
+                entry.md5 = file->get_pascal_string();
+                entry.record_size = RECORD_HEADER_SIZE + size;
+                auto iter = paths.find(path);
+                if (iter != paths.end()) {
+                    dead_bytes += iter->second.record_size;
+                }
+                paths[path] = entry;
+            } else if (type == RECORD_THUMBNAIL) {
+                String md5 = file->get_pascal_string();
+                int thumbnail_size = file->get_32();
+                String key = _thumbnail_key(md5, thumbnail_size);
+                auto iter = thumbnails.find(key);
+                if (iter != thumbnails.end()) {
+                    dead_bytes += iter->second.record_size;
+                }
+                thumbnails[key] = { pos, RECORD_HEADER_SIZE + size };
+            } else {
+                break;
+            }
+            pos = record_end;
+        }
+        if (pos < len) {
+            // drop the damaged tail, new records are appended after the last valid one.
+            dead_bytes += len - pos;
+        }
+        append_offset = pos;
+    }
+
+    //! Rewrites the database with live records only, entries for files that no longer exist are dropped as well.
+    void _compact() {
+        String tmp_path = db_path + ".tmp";
+        FileAccess *out = FileAccess::open(tmp_path, FileAccess::WRITE);
+        ERR_FAIL_COND_MSG(!out, "Cannot create file '" + tmp_path + "'. Check user write permissions.");
+        out->store_32(MAGIC);
+        out->store_32(VERSION);
+
+        Map<String, PathEntry> live_paths;
+        Set<String> live_md5;
+        for (const auto &e : paths) {
+            if (!FileAccess::exists(e.first)) {
+                continue;
+            }
+            _store_path_record(out, e.first, e.second);
+            live_paths[e.first] = e.second;
+            live_md5.insert(e.second.md5);
+        }
+
+        Map<String, ThumbnailEntry> live_thumbnails;
+        Vector<uint8_t> buffer;
+        for (const auto &e : thumbnails) {
+            if (!live_md5.contains(StringUtils::get_slice(e.first, ':', 0))) {
+                continue;
+            }
+            buffer.resize(e.second.record_size);
+            file->seek(e.second.record_offset);
+            if (file->get_buffer(buffer.data(), e.second.record_size) != int(e.second.record_size)) {
+                continue;
+            }
+            live_thumbnails[e.first] = { out->get_position(), e.second.record_size };
+            out->store_buffer(buffer.data(), e.second.record_size);
+        }
+        bool failed = out->get_error() != OK;
+        out->close();
+        memdelete(out);
+
+        DirAccess *da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+        if (failed) {
+            da->remove(tmp_path);
+            memdelete(da);
+            ERR_FAIL_MSG("Cannot compact thumbnail database '" + db_path + "'.");
+        }
+        file->close();
+        memdelete(file);
+        file = nullptr;
+        da->remove(db_path);
+        Error err = da->rename(tmp_path, db_path);
+        memdelete(da);
+
+        paths = eastl::move(live_paths);
+        thumbnails = eastl::move(live_thumbnails);
+        dead_bytes = 0;
+        if (err == OK) {
+            file = FileAccess::open(db_path, FileAccess::READ_WRITE);
+        }
+        if (!file) {
+            // losing the cache only costs regenerating previews.
+            paths.clear();
+            thumbnails.clear();
+            if (!_create(db_path)) {
+                append_offset = 0;
+            }
+            return;
+        }
+        append_offset = file->get_len();
+    }
+
+    void open(StringView p_path) {
+        MutexLock guard(mutex);
+        ERR_FAIL_COND(file != nullptr);
+        db_path = p_path;
+
+        file = FileAccess::exists(db_path) ? FileAccess::open(db_path, FileAccess::READ_WRITE) : nullptr;
+        if (file && (file->get_len() < 8 || file->get_32() != MAGIC || file->get_32() != VERSION)) {
+            memdelete(file);
+            file = nullptr;
+        }
+        if (!file) {
+            _create(db_path);
+            return;
+        }
+        _index();
+        if (dead_bytes > MIN_COMPACT_SIZE && dead_bytes > file->get_len() / 2) {
+            _compact();
+        }
+    }
+
+    void close() {
+        MutexLock guard(mutex);
+        if (file) {
+            memdelete(file);
+            file = nullptr;
+        }
+        paths.clear();
+        thumbnails.clear();
+        dead_bytes = 0;
+        append_offset = 0;
+    }
+
+    //! Returns the md5 of the file contents, only hashing the file again when its modification time changed.
+    String get_content_hash(StringView p_path) {
+        String key = ProjectSettings::get_singleton()->globalize_path(p_path);
+        uint64_t modified_time = FileAccess::get_modified_time(p_path);
+        {
+            MutexLock guard(mutex);
+            auto iter = paths.find(key);
+            if (iter != paths.end() && iter->second.modified_time == modified_time) {
+                return iter->second.md5;
+            }
+        }
+
+        PathEntry entry;
+        entry.md5 = FileAccess::get_md5(p_path);
+        entry.modified_time = modified_time;
+        if (entry.md5.empty()) {
+            return entry.md5;
+        }
+
+        MutexLock guard(mutex);
+        if (!file) {
+            return entry.md5;
+        }
+        auto iter = paths.find(key);
+        if (iter != paths.end()) {
+            dead_bytes += iter->second.record_size;
+        }
+        file->seek(append_offset);
+        uint64_t start = file->get_position();
+        _store_path_record(file, key, entry);
+        append_offset = file->get_position();
+        entry.record_size = uint32_t(append_offset - start);
+        paths[key] = entry;
+        return entry.md5;
+    }
+
+    bool load(StringView p_md5, int p_thumbnail_size, Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture) {
+        Vector<uint8_t> record;
+        {
+            MutexLock guard(mutex);
+            if (!file) {
+                return false;
+            }
+            auto iter = thumbnails.find(_thumbnail_key(p_md5, p_thumbnail_size));
+            if (iter == thumbnails.end()) {
+                return false;
+            }
+            record.resize(iter->second.record_size);
+            file->seek(iter->second.record_offset);
+            int read = file->get_buffer(record.data(), iter->second.record_size);
+            file->seek(append_offset);
+            if (read != int(iter->second.record_size)) {
+                return false;
+            }
+        }
+
+        // decoding happens outside the lock, so other workers can keep reading.
+        const uint8_t *ptr = record.data() + RECORD_HEADER_SIZE;
+        const uint8_t *end = record.data() + record.size();
+        uint32_t md5_len = decode_uint32(ptr);
+        ptr += 4 + md5_len + 4; // md5 and thumbnail size, already matched through the index.
+        ERR_FAIL_COND_V(ptr >= end, false);
+        int image_count = *ptr++;
+
+        Ref<ImageTexture> textures[2];
+        for (int i = 0; i < image_count && i < 2; i++) {
+            ERR_FAIL_COND_V(end - ptr < 18, false);
+            int width = decode_uint32(ptr);
+            int height = decode_uint32(ptr + 4);
+            Image::Format format = Image::Format(ptr[8]);
+            bool mipmaps = ptr[9] != 0;
+            int raw_size = decode_uint32(ptr + 10);
+            int compressed_size = decode_uint32(ptr + 14);
+            ptr += 18;
+            ERR_FAIL_COND_V(end - ptr < compressed_size || format >= Image::FORMAT_MAX, false);
+
+            PoolVector<uint8_t> data;
+            data.resize(raw_size);
+            {
+                PoolVector<uint8_t>::Write w = data.write();
+                int decoded = Compression::decompress(w.ptr(), raw_size, ptr, compressed_size, Compression::MODE_ZSTD);
+                ERR_FAIL_COND_V(decoded != raw_size, false);
+            }
+            ptr += compressed_size;
+
+            Ref<Image> img(make_ref_counted<Image>());
+            img->create(width, height, mipmaps, format, data);
+            textures[i] = make_ref_counted<ImageTexture>();
+            textures[i]->create_from_image(img, Texture::FLAG_FILTER);
+        }
+        if (!textures[0]) {
+            return false;
+        }
+        r_texture = textures[0];
+        r_small_texture = textures[1];
+        return true;
+    }
+
+    void store(StringView p_md5, int p_thumbnail_size, const Ref<ImageTexture> &p_texture, const Ref<ImageTexture> &p_small_texture) {
+        Ref<Image> images[2] = { p_texture->get_data(), p_small_texture ? p_small_texture->get_data() : Ref<Image>() };
+
+        // compress before taking the lock, the records are only appended below.
+        Vector<uint8_t> payload;
+        int image_count = 0;
+        for (const Ref<Image> &img : images) {
+            if (!img || img->is_empty()) {
+                break;
+            }
+            const PoolVector<uint8_t> &data = img->get_data();
+            int raw_size = data.size();
+            size_t ofs = payload.size();
+            payload.resize(ofs + 18 + Compression::get_max_compressed_buffer_size(raw_size, Compression::MODE_ZSTD));
+            uint8_t *header = payload.data() + ofs;
+            encode_uint32(img->get_width(), header);
+            encode_uint32(img->get_height(), header + 4);
+            header[8] = uint8_t(img->get_format());
+            header[9] = img->has_mipmaps() ? 1 : 0;
+            encode_uint32(raw_size, header + 10);
+            PoolVector<uint8_t>::Read r = data.read();
+            int compressed_size = Compression::compress(header + 18, r.ptr(), raw_size, Compression::MODE_ZSTD);
+            ERR_FAIL_COND(compressed_size < 0);
+            encode_uint32(compressed_size, header + 14);
+            payload.resize(ofs + 18 + compressed_size);
+            image_count++;
+        }
+        if (image_count == 0) {
+            return;
+        }
+
+        MutexLock guard(mutex);
+        if (!file) {
+            return;
+        }
+        String key = _thumbnail_key(p_md5, p_thumbnail_size);
+        auto iter = thumbnails.find(key);
+        if (iter != thumbnails.end()) {
+            dead_bytes += iter->second.record_size;
+        }
+        file->seek(append_offset);
+        uint64_t start = file->get_position();
+        file->store_8(RECORD_THUMBNAIL);
+        file->store_32(0);
+        file->store_pascal_string(p_md5);
+        file->store_32(p_thumbnail_size);
+        file->store_8(image_count);
+        file->store_buffer(payload.data(), payload.size());
+        uint64_t end = file->get_position();
+        file->seek(start + 1);
+        file->store_32(uint32_t(end - start - RECORD_HEADER_SIZE));
+        file->seek(end);
+        append_offset = end;
+        thumbnails[key] = { start, uint32_t(end - start) };
+    }
+
+    ~ThumbnailDatabase() {
+        close();
+    }
+};
+
 void EditorResourcePreview::_thread_func(void *ud) {
 
     EditorResourcePreview *erp = (EditorResourcePreview *)ud;
@@ -142,7 +508,7 @@ void EditorResourcePreview::_preview_ready(StringView p_str, const Ref<Texture>
     MessageQueue::get_singleton()->push_callable(callit, path, p_texture, p_small_texture, p_ud);
 }
 
-void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, StringView cache_base) {
+void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item) {
     String type;
 
     if (p_item.resource)
@@ -199,32 +565,11 @@ void EditorResourcePreview::_generate_preview(Ref<ImageTexture> &r_texture, Ref<
 
         break;
     }
-
-    if (not p_item.resource) {
-        // cache the preview in case it's a resource on disk
-        if (r_texture) {
-            //wow it generated a preview... save cache
-            bool has_small_texture = r_small_texture;
-            gResourceManager().save(String(cache_base) + ".png", r_texture);
-            if (has_small_texture) {
-                gResourceManager().save(String(cache_base) + "_small.png", r_small_texture);
-            }
-            FileAccess *f = FileAccess::open(String(cache_base) + ".txt", FileAccess::WRITE);
-            ERR_FAIL_COND_MSG(!f, "Cannot create file '" + cache_base + ".txt'. Check user write permissions.");
-            f->store_line(itos(thumbnail_size));
-            f->store_line(itos(has_small_texture));
-            f->store_line(itos(FileAccess::get_modified_time(p_item.path)));
-            f->store_line(FileAccess::get_md5(p_item.path));
-            f->close();
-            memdelete(f);
-        }
-    }
 }
 
 void EditorResourcePreview::_thread() {
 
 #ifndef SERVER_ENABLED
-    exited = false;
     while (!exit) {
 
         preview_sem.wait();
@@ -248,114 +593,57 @@ void EditorResourcePreview::_thread() {
             _preview_ready(path, cache[item.path].preview, cache[item.path].small_preview, item.callable, item.userdata);
 
             preview_mutex.unlock();
-        } else {
-
-            preview_mutex.unlock();
-
-            Ref<ImageTexture> texture;
-            Ref<ImageTexture> small_texture;
-
-            int thumbnail_size = EditorSettings::get_singleton()->getT<int>("filesystem/file_dialog/thumbnail_size");
-            thumbnail_size *= EDSCALE;
-
-            if (item.resource) {
-
-                _generate_preview(texture, small_texture, item, {});
-
-                //adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
-                _preview_ready(item.path + ":" + itos(item.resource->hash_edited_version()), texture, small_texture, item.callable, item.userdata);
-
-            } else {
-
-                String temp_path = EditorSettings::get_singleton()->get_cache_dir();
-                String cache_base(StringUtils::md5_text(ProjectSettings::get_singleton()->globalize_path(item.path)));
-                cache_base = PathUtils::plus_file(temp_path,"resthumb-" + cache_base);
-
-                //does not have it, try to load a cached thumbnail
-
-                String file = cache_base + ".txt";
-                FileAccess *f = FileAccess::open(file, FileAccess::READ);
-                if (!f) {
-
-                    // No cache found, generate
-                    _generate_preview(texture, small_texture, item, cache_base);
-                } else {
-
-                    uint64_t modtime = FileAccess::get_modified_time(item.path);
-                    int tsize = StringUtils::to_int64(f->get_line());
-                    bool has_small_texture = StringUtils::to_int(f->get_line());
-                    uint64_t last_modtime = StringUtils::to_int64(f->get_line());
-
-                    bool cache_valid = true;
-
-                    if (tsize != thumbnail_size) {
-
-                        cache_valid = false;
-                        memdelete(f);
-                    } else if (last_modtime != modtime) {
-
-                        String last_md5 = f->get_line();
-                        String md5 = FileAccess::get_md5(item.path);
-                        memdelete(f);
-
-                        if (last_md5 != md5) {
-
-                            cache_valid = false;
-
-                        } else {
-                            //update modified time
-
-                            f = FileAccess::open(file, FileAccess::WRITE);
-                            if (!f) {
-                                // Not returning as this would leave the thread hanging and would require
-                                // some proper cleanup/disabling of resource preview generation.
-                                ERR_PRINT("Cannot create file '" + file + "'. Check user write permissions.");
-                            } else {
-                                f->store_line(itos(thumbnail_size));
-                                f->store_line(itos(has_small_texture));
-                                f->store_line(itos(modtime));
-                                f->store_line(md5);
-                                memdelete(f);
-                            }
-                        }
-                    } else {
-                        memdelete(f);
-                    }
-
-                    if (cache_valid) {
+            continue;
+        }
 
-                        Ref<Image> img(make_ref_counted<Image>());
-                        Ref<Image> small_img(make_ref_counted<Image>());
+        preview_mutex.unlock();
 
-                        if (img->load(cache_base + ".png") != OK) {
-                            cache_valid = false;
-                        } else {
+        Ref<ImageTexture> texture;
+        Ref<ImageTexture> small_texture;
 
-                            texture = make_ref_counted<ImageTexture>();
-                            texture->create_from_image(img, Texture::FLAG_FILTER);
+        if (item.resource) {
 
-                            if (has_small_texture) {
-                                if (small_img->load(cache_base + "_small.png") != OK) {
-                                    cache_valid = false;
-                                } else {
-                                    small_texture = make_ref_counted<ImageTexture>();
-                                    small_texture->create_from_image(small_img, Texture::FLAG_FILTER);
-                                }
-                            }
-                        }
-                    }
+            {
+                MutexLock guard(generator_mutex);
+                _generate_preview(texture, small_texture, item);
+            }
 
-                    if (!cache_valid) {
+            //adding hash to the end of path (should be ID:<objid>:<hash>) because of 5 argument limit to call_deferred
+            _preview_ready(item.path + ":" + itos(item.resource->hash_edited_version()), texture, small_texture, item.callable, item.userdata);
+            continue;
+        }
 
-                        _generate_preview(texture, small_texture, item, cache_base);
-                    }
+        int thumbnail_size = EditorSettings::get_singleton()->getT<int>("filesystem/file_dialog/thumbnail_size");
+        thumbnail_size *= EDSCALE;
+
+        // hashing and loading stored thumbnails runs on all workers in parallel.
+        String content_hash = thumbnail_db->get_content_hash(item.path);
+        if (content_hash.empty() || !thumbnail_db->load(content_hash, thumbnail_size, texture, small_texture)) {
+
+            bool generated = false;
+            {
+                MutexLock guard(generator_mutex);
+                // another worker may have finished the same path while this one waited for the generators.
+                preview_mutex.lock();
+                auto iter = cache.find(item.path);
+                if (iter != cache.end()) {
+                    texture = dynamic_ref_cast<ImageTexture>(iter->second.preview);
+                    small_texture = dynamic_ref_cast<ImageTexture>(iter->second.small_preview);
+                }
+                preview_mutex.unlock();
+                if (iter == cache.end()) {
+                    _generate_preview(texture, small_texture, item);
+                    generated = true;
                 }
-                _preview_ready(item.path, texture, small_texture, item.callable, item.userdata);
+            }
+            if (generated && texture && !content_hash.empty()) {
+                thumbnail_db->store(content_hash, thumbnail_size, texture, small_texture);
             }
         }
+        _preview_ready(item.path, texture, small_texture, item.callable, item.userdata);
     }
 #endif
-    exited = true;
+    running_threads.fetch_sub(1);
 }
 //TODO: make this function take a eastl::function<void(Variant)>, would need to support c# delegate to eastl::function wrapping.
 void EditorResourcePreview::queue_edited_resource_preview(const Ref<Resource> &p_res, const Callable &entry, const Variant &p_userdata) {
@@ -446,6 +734,8 @@ void EditorResourcePreview::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("add_preview_generator", {"generator"}), &EditorResourcePreview::add_preview_generator);
     MethodBinder::bind_method(D_METHOD("remove_preview_generator", {"generator"}), &EditorResourcePreview::remove_preview_generator);
     MethodBinder::bind_method(D_METHOD("check_for_invalidation", {"path"}), &EditorResourcePreview::check_for_invalidation);
+    MethodBinder::bind_method(D_METHOD("prioritize_previews", {"paths"}), &EditorResourcePreview::prioritize_previews);
+    MethodBinder::bind_method(D_METHOD("cancel_queued_previews", {"callback"}), &EditorResourcePreview::cancel_queued_previews);
 
     ADD_SIGNAL(MethodInfo("preview_invalidated", PropertyInfo(VariantType::STRING, "path")));
 }
@@ -472,30 +762,79 @@ void EditorResourcePreview::check_for_invalidation(StringView p_path) {
     }
 }
 
+void EditorResourcePreview::prioritize_previews(const Vector<String> &p_paths) {
+
+    if (p_paths.empty()) {
+        return;
+    }
+    Set<String> wanted(p_paths.begin(), p_paths.end());
+
+    MutexLock guard(preview_mutex);
+    // matching items keep their relative order and are moved in front of everything else.
+    List<QueueItem> front;
+    for (auto iter = queue.begin(); iter != queue.end();) {
+        auto next = eastl::next(iter);
+        if (wanted.contains(iter->path)) {
+            front.splice(front.end(), queue, iter);
+        }
+        iter = next;
+    }
+    queue.splice(queue.begin(), front);
+}
+
+void EditorResourcePreview::cancel_queued_previews(const Callable &p_callback) {
+
+    MutexLock guard(preview_mutex);
+    // the semaphore was posted once per item, workers treat the surplus posts as empty wakeups.
+    queue.remove_if([&p_callback](const QueueItem &item) { return item.callable == p_callback; });
+}
+
 void EditorResourcePreview::start() {
-    ERR_FAIL_COND_MSG(thread.is_started(), "Thread already started.");
-    thread.start(_thread_func, this);
+    ERR_FAIL_COND_MSG(threads != nullptr, "Threads already started.");
+
+    thumbnail_db->open(PathUtils::plus_file(EditorSettings::get_singleton()->get_cache_dir(), "thumbnails.db"));
+
+    // leave a core for the main thread, generation itself is serialized so more workers bring little.
+    thread_count = CLAMP(OS::get_singleton()->get_processor_count() - 1, 1, int(MAX_PREVIEW_THREADS));
+    exit = false;
+    running_threads = thread_count;
+    threads = memnew_arr(Thread, thread_count);
+    for (int i = 0; i < thread_count; i++) {
+        threads[i].start(_thread_func, this);
+    }
 }
 
 void EditorResourcePreview::stop() {
-    if (thread.is_started()) {
+    if (threads) {
         exit = true;
-        preview_sem.post();
-        while (!exited) {
+        for (int i = 0; i < thread_count; i++) {
+            preview_sem.post();
+        }
+        while (running_threads.load() > 0) {
             OS::get_singleton()->delay_usec(10000);
             RenderingServer::sync_thread(); //sync pending stuff, as thread may be blocked on visual server
         }
-        thread.wait_to_finish();
+        for (int i = 0; i < thread_count; i++) {
+            threads[i].wait_to_finish();
+        }
+        memdelete_arr(threads);
+        threads = nullptr;
+        thread_count = 0;
     }
+    thumbnail_db->close();
 }
 
 EditorResourcePreview::EditorResourcePreview() {
     singleton = this;
     order = 0;
     exit = false;
-    exited = false;
+    running_threads = 0;
+    threads = nullptr;
+    thread_count = 0;
+    thumbnail_db = memnew(ThumbnailDatabase);
 }
 
 EditorResourcePreview::~EditorResourcePreview() {
     stop();
+    memdelete(thumbnail_db);
 }
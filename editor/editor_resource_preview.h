@@ -32,12 +32,15 @@
 
 #include "core/os/semaphore.h"
 #include "core/os/thread.h"
+#include "core/os/mutex.h"
 #include "core/string.h"
 #include "core/list.h"
 #include "core/map.h"
 #include "scene/main/node.h"
 #include "scene/resources/texture.h"
 
+#include <atomic>
+
 class GODOT_EXPORT EditorResourcePreviewGenerator : public RefCounted {
 
     GDCLASS(EditorResourcePreviewGenerator,RefCounted)
@@ -76,19 +79,29 @@ class GODOT_EXPORT EditorResourcePreview : public Node {
         uint64_t modified_time;
     };
 
+    enum {
+        MAX_PREVIEW_THREADS = 4
+    };
+
+    struct ThumbnailDatabase;
+
     List<QueueItem> queue;
 
     Mutex preview_mutex;
+    // generators share viewports and other state, so at most one worker runs them at a time.
+    Mutex generator_mutex;
     Semaphore preview_sem;
-    Thread thread;
-    volatile bool exit;
-    volatile bool exited;
+    Thread *threads;
+    int thread_count;
+    std::atomic<bool> exit;
+    std::atomic<int> running_threads;
     int order;
     Map<String, Item> cache;
     Vector<Ref<EditorResourcePreviewGenerator> > preview_generators;
+    ThumbnailDatabase *thumbnail_db;
 
     void _preview_ready(StringView p_str, const Ref<Texture> &p_texture, const Ref<Texture> &p_small_texture, const Callable &callit, const Variant &p_ud);
-    void _generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item, StringView cache_base);
+    void _generate_preview(Ref<ImageTexture> &r_texture, Ref<ImageTexture> &r_small_texture, const QueueItem &p_item);
 
     static void _thread_func(void *ud);
     void _thread();
@@ -108,6 +121,11 @@ public:
     void remove_preview_generator(const Ref<EditorResourcePreviewGenerator> &p_generator);
     void check_for_invalidation(StringView p_path);
 
+    //! Moves queued requests for p_paths ahead of all others, e.g. the ones currently visible in a list.
+    void prioritize_previews(const Vector<String> &p_paths);
+    //! Drops every request queued with p_callback that did not start yet.
+    void cancel_queued_previews(const Callable &p_callback);
+
     void start();
     void stop();
 
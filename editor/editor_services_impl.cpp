@@ -8,6 +8,16 @@ public:
     void reportError(const StringName &msg) override {
         EditorNode::add_io_error(msg);
     }
+    void progressAddTask(const StringName &task, const StringName &label, int steps, bool can_cancel) override {
+        EditorNode::progress_add_task(task, label, steps, can_cancel);
+    }
+    bool progressTaskStep(const StringName &task, const StringName &state, int step) override {
+        // not forced, so polling callers only redraw the dialog every 200ms.
+        return EditorNode::progress_task_step(task, state, step, false);
+    }
+    void progressEndTask(const StringName &task) override {
+        EditorNode::progress_end_task(task);
+    }
 
 };
 EditorServiceInterface *getEditorInterface() {
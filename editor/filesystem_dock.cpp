@@ -545,6 +545,22 @@ void FileSystemDock::_file_list_thumbnail_done(StringView p_path, const Ref<Text
     }
 }
 
+void FileSystemDock::_file_list_scrolled(float p_value) {
+
+    // Request the thumbnails of the items in view before the ones that were queued for the rest of the list.
+    int first = files->get_item_at_position(Point2(), false);
+    int last = files->get_item_at_position(files->get_size(), false);
+    if (first < 0 || last < first) {
+        return;
+    }
+    Vector<String> visible;
+    visible.reserve(last - first + 1);
+    for (int i = first; i <= last; i++) {
+        visible.emplace_back(files->get_item_metadata(i).as<String>());
+    }
+    EditorResourcePreview::get_singleton()->prioritize_previews(visible);
+}
+
 void FileSystemDock::_tree_thumbnail_done(StringView p_path, const Ref<Texture> &p_preview, const Ref<Texture> &p_small_preview, const Variant &p_udata) {
     if (p_small_preview) {
         Array uarr = p_udata.as<Array>();
@@ -639,6 +655,9 @@ void FileSystemDock::_update_file_list(bool p_keep_selection) {
         }
     }
 
+    // Thumbnails still queued for the previous contents are not needed anymore.
+    EditorResourcePreview::get_singleton()->cancel_queued_previews(callable_mp(this, &FileSystemDock::_file_list_thumbnail_done));
+
     files->clear();
 
     _set_current_path_text(path);
@@ -2673,6 +2692,7 @@ FileSystemDock::FileSystemDock(EditorNode *p_editor) {
     files->connect("gui_input",callable_mp(this, &ClassName::_file_list_gui_input));
     files->connect("multi_selected",callable_mp(this, &ClassName::_file_multi_selected));
     files->connect("rmb_clicked",callable_mp(this, &ClassName::_file_list_rmb_pressed));
+    files->get_v_scroll()->connect("value_changed",callable_mp(this, &ClassName::_file_list_scrolled));
     files->set_custom_minimum_size(Size2(0, 15 * EDSCALE));
     files->set_allow_rmb_select(true);
     file_list_vb->add_child(files);
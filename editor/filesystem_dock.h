@@ -270,6 +270,7 @@ private:
 
     void _preview_invalidated(StringView p_path);
     void _file_list_thumbnail_done(StringView p_path, const Ref<Texture> &p_preview, const Ref<Texture> &p_small_preview, const Variant &p_udata);
+    void _file_list_scrolled(float p_value);
     void _tree_thumbnail_done(StringView p_path, const Ref<Texture> &p_preview, const Ref<Texture> &p_small_preview, const Variant &p_udata);
 
     void _update_display_mode(bool p_force = false);
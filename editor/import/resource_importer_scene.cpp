@@ -224,6 +224,10 @@ bool ResourceImporterScene::get_option_visibility(
         return false;
     }
 
+    if (p_option == "meshes/lod_max_error" && !p_options.at("meshes/generate_lods").as<bool>()) {
+        return false;
+    }
+
     if (p_option == "meshes/lightmap_texel_size" && p_options.at("meshes/light_baking").as<int>() < 2) {
         return false;
     }
@@ -1197,6 +1201,12 @@ void ResourceImporterScene::get_import_options(Vector<ResourceImporterInterface:
     r_options->push_back(ImportOption(PropertyInfo(VariantType::BOOL, "materials/keep_on_reimport"), materials_out));
     r_options->push_back(ImportOption(PropertyInfo(VariantType::BOOL, "meshes/compress"), true));
     r_options->push_back(ImportOption(PropertyInfo(VariantType::BOOL, "meshes/ensure_tangents"), true));
+    r_options->push_back(ImportOption(PropertyInfo(VariantType::BOOL, "meshes/optimize_indices"), true));
+    r_options->push_back(ImportOption(PropertyInfo(VariantType::BOOL, "meshes/generate_lods", PropertyHint::None, "",
+                                              PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED),
+            true));
+    r_options->push_back(ImportOption(
+            PropertyInfo(VariantType::FLOAT, "meshes/lod_max_error", PropertyHint::Range, "0.001,1,0.001"), 0.05));
     r_options->push_back(ImportOption(PropertyInfo(VariantType::INT, "meshes/storage", PropertyHint::Enum,
                                               "Built-In,Files (.mesh),Files (.tres)"),
             meshes_out ? 1 : 0));
@@ -1491,7 +1501,10 @@ Error ResourceImporterScene::import(StringView p_source_file, StringView p_save_
         }
     }
 
-    if (light_bake_mode == 2 /* || generate LOD */) {
+    bool optimize_indices = p_options.at("meshes/optimize_indices").as<bool>();
+    bool generate_lods = p_options.at("meshes/generate_lods").as<bool>();
+
+    if (light_bake_mode == 2 || optimize_indices || generate_lods) {
 
         Map<Ref<ArrayMesh>, Transform> meshes;
         _find_meshes(scene, meshes);
@@ -1523,6 +1536,27 @@ Error ResourceImporterScene::import(StringView p_source_file, StringView p_save_
                 step++;
             }
         }
+
+        if (optimize_indices || generate_lods) {
+
+            float lod_max_error = p_options.at("meshes/lod_max_error").as<float>();
+
+            EditorProgress progress2(("gen_lods"), TTR("Optimizing Meshes"), meshes.size());
+            int step = 0;
+            for (eastl::pair<const Ref<ArrayMesh>, Transform> &E : meshes) {
+
+                Ref<ArrayMesh> mesh = E.first;
+                progress2.step(TTR("Optimizing Mesh: ") + StringView(mesh->get_name()), step++);
+
+                // unwrapping above rebuilds the index arrays, so this has to run after it.
+                if (optimize_indices) {
+                    mesh->optimize_indices();
+                }
+                if (generate_lods) {
+                    mesh->generate_lods(4, lod_max_error);
+                }
+            }
+        }
     }
 
     if (external_animations || external_materials || external_meshes) {
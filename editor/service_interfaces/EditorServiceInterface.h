@@ -12,6 +12,11 @@ class GODOT_EXPORT EditorServiceInterface
 {
 public:
     virtual void reportError(const StringName &msg) = 0;
+    //! Progress dialog for long running work, these have to be called from the main thread.
+    virtual void progressAddTask(const StringName &task, const StringName &label, int steps, bool can_cancel) = 0;
+    //! Returns true once the user has cancelled the task.
+    virtual bool progressTaskStep(const StringName &task, const StringName &state, int step) = 0;
+    virtual void progressEndTask(const StringName &task) = 0;
 
 };
 // used internally by the engine to pass service interface to plugins
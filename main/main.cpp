@@ -44,6 +44,7 @@
 #include "core/message_queue.h"
 #include "core/os/dir_access.h"
 #include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/project_settings.h"
 #include "core/register_core_types.h"
 #include "core/resource/resource_manager.h"
@@ -1473,6 +1474,8 @@ Error Main::setup2(Thread::ID p_main_tid_override) {
 
     // This loads global classes, so it must happen before custom loaders and savers are registered
     ScriptServer::init_languages();
+    // workers are started after the languages, so they can attach script stacks when running scripted callbacks.
+    ThreadWorkPool::get_singleton()->init();
 #ifdef DEBUG_METHODS_ENABLED
     const Vector<String> & args(OS::get_singleton()->get_cmdline_args());
     int refl_idx = args.index_of("--gen-reflection");
@@ -2282,6 +2285,8 @@ void Main::cleanup() {
     gResourceRemapper().clear_translation_remaps();
     gResourceRemapper().clear_path_remaps();
 
+    gResourceManager().finish_threaded_loading();
+    ThreadWorkPool::get_singleton()->finish();
     ScriptServer::finish_languages();
 
     // Sync pending commands that may have been queued from a different thread during ScriptServer finalization
@@ -81,6 +81,7 @@ void Performance::_bind_methods() {
     BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
     BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
     BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+    BIND_ENUM_CONSTANT(RENDER_2D_ITEMS_CULLED_IN_FRAME);
 
     BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
@@ -128,6 +129,7 @@ StringView Performance::get_monitor_name(Monitor p_monitor) const {
         "physics_3d/collision_pairs",
         "physics_3d/islands",
         "audio/output_latency",
+        "2d/items_culled",
 
     };
 
@@ -168,6 +170,7 @@ float Performance::get_monitor(Monitor p_monitor) const {
         case PHYSICS_3D_COLLISION_PAIRS: return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS);
         case PHYSICS_3D_ISLAND_COUNT: return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
         case AUDIO_OUTPUT_LATENCY: return AudioServer::get_singleton()->get_output_latency();
+        case RENDER_2D_ITEMS_CULLED_IN_FRAME: return RenderingServer::get_singleton()->get_render_info(RS::INFO_2D_ITEMS_CULLED_IN_FRAME);
 
         default: {
         }
@@ -212,6 +215,7 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
         MONITOR_TYPE_QUANTITY,
         MONITOR_TYPE_QUANTITY,
         MONITOR_TYPE_TIME,
+        MONITOR_TYPE_QUANTITY,
 
     };
 
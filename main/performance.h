@@ -81,6 +81,7 @@ public:
         PHYSICS_3D_ISLAND_COUNT,
         //physics
         AUDIO_OUTPUT_LATENCY,
+        RENDER_2D_ITEMS_CULLED_IN_FRAME,
         MONITOR_MAX
     };
 
@@ -0,0 +1,150 @@
+/*************************************************************************/
+/*  test_image_compress.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+
+#include "test_image_compress.h"
+
+#include "core/image.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string_formatter.h"
+
+#include <atomic>
+
+namespace TestImageCompress {
+
+enum {
+    IMAGE_SIZE = 2048,
+};
+
+struct CancelWatcher {
+    CompressProgress *progress;
+    std::atomic<bool> finished { false };
+
+    //! Cancels as soon as the backend reports its first finished blocks.
+    static void run(void *p_ud) {
+        CancelWatcher *self = static_cast<CancelWatcher *>(p_ud);
+        while (!self->finished.load() && self->progress->blocks_done.load() == 0) {
+            OS::get_singleton()->delay_usec(100);
+        }
+        self->progress->cancel();
+    }
+};
+
+Ref<Image> make_noise_image() {
+    PoolVector<uint8_t> data;
+    data.resize(IMAGE_SIZE * IMAGE_SIZE * 4);
+    {
+        PoolVector<uint8_t>::Write w = data.write();
+        uint32_t state = 0x9E3779B9;
+        for (int i = 0; i < data.size(); i++) {
+            state = state * 1664525 + 1013904223;
+            w[i] = uint8_t(state >> 24);
+        }
+    }
+    Ref<Image> img(make_ref_counted<Image>());
+    img->create(IMAGE_SIZE, IMAGE_SIZE, false, Image::FORMAT_RGBA8, data);
+    img->generate_mipmaps();
+    return img;
+}
+
+bool test_cancel(ImageCompressMode p_mode, const char *p_name) {
+    if (!Image::can_compress(p_mode)) {
+        OS::get_singleton()->print(FormatVE("%s codec not loaded, skipped", p_name));
+        return true;
+    }
+
+    Ref<Image> img = make_noise_image();
+    CompressProgress progress;
+    CancelWatcher watcher;
+    watcher.progress = &progress;
+
+    Thread thread;
+    thread.start(&CancelWatcher::run, &watcher);
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    Error err = Image::compress_image(img.get(), { 1.0f, p_mode, ImageUsedChannels::USED_CHANNELS_RGBA, &progress });
+    uint64_t time = OS::get_singleton()->get_ticks_usec() - start;
+    watcher.finished.store(true);
+    thread.wait_to_finish();
+
+    uint32_t done = progress.blocks_done.load();
+    uint32_t total = progress.blocks_total.load();
+    OS::get_singleton()->print(FormatVE("%s: cancelled after %d of %d blocks, %d usec", p_name, int(done), int(total), int(time)));
+
+    // a cancelled job leaves the image untouched and skips the blocks that had not started yet.
+    return err == ERR_SKIP && img->get_format() == Image::FORMAT_RGBA8 && total > 0 && done < total;
+}
+
+bool test_cancel_s3tc() {
+    return test_cancel(COMPRESS_S3TC, "S3TC");
+}
+
+bool test_cancel_bptc() {
+    return test_cancel(COMPRESS_BPTC, "BPTC");
+}
+
+bool test_cancel_etc2() {
+    return test_cancel(COMPRESS_ETC2, "ETC2");
+}
+
+bool test_cancel_pvrtc() {
+    return test_cancel(COMPRESS_PVRTC4, "PVRTC");
+}
+
+using TestFunc = bool (*)();
+
+TestFunc test_funcs[] = {
+    test_cancel_s3tc,
+    test_cancel_bptc,
+    test_cancel_etc2,
+    test_cancel_pvrtc,
+    nullptr
+};
+
+MainLoop *test() {
+    int count = 0;
+    int passed = 0;
+
+    while (true) {
+        if (!test_funcs[count])
+            break;
+        bool pass = test_funcs[count]();
+        if (pass)
+            passed++;
+        OS::get_singleton()->print(FormatVE("\t%s\n", pass ? "PASS" : "FAILED"));
+
+        count++;
+    }
+    OS::get_singleton()->print("\n");
+    OS::get_singleton()->print(FormatVE("Passed %i of %i tests\n", passed, count));
+    return nullptr;
+}
+
+} // namespace TestImageCompress
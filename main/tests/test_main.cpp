@@ -36,12 +36,18 @@
 
 #include "test_astar.h"
 #include "test_gui.h"
+#include "test_image_compress.h"
 #include "test_math.h"
 #include "test_oa_hash_map.h"
+#include "test_packed_scene.h"
 #include "test_physics.h"
 #include "test_physics_2d.h"
 #include "test_render.h"
+#include "test_rid_alloc.h"
 #include "test_shader_lang.h"
+#include "test_theme_lookup.h"
+#include "test_variant.h"
+#include "test_variant_parser.h"
 //#include "test_string.h"
 
 const char **tests_get_names() {
@@ -61,6 +67,12 @@ const char **tests_get_names() {
         "gd_bytecode",
         "ordered_hash_map",
         "astar",
+        "packed_scene",
+        "variant_parser",
+        "theme_lookup",
+        "rid_alloc",
+        "variant",
+        "image_compress",
         nullptr
     };
 
@@ -116,6 +128,36 @@ MainLoop *test_main(const String& p_test, const Vector<String> &p_args) {
         return TestAStar::test();
     }
 
+    if (p_test == "packed_scene") {
+
+        return TestPackedScene::test();
+    }
+
+    if (p_test == "variant_parser") {
+
+        return TestVariantParser::test();
+    }
+
+    if (p_test == "theme_lookup") {
+
+        return TestThemeLookup::test();
+    }
+
+    if (p_test == "rid_alloc") {
+
+        return TestRIDAlloc::test();
+    }
+
+    if (p_test == "variant") {
+
+        return TestVariant::test();
+    }
+
+    if (p_test == "image_compress") {
+
+        return TestImageCompress::test();
+    }
+
     print_line("Unknown test: " + p_test);
     return nullptr;
 }
@@ -0,0 +1,144 @@
+/*************************************************************************/
+/*  test_packed_scene.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_packed_scene.h"
+
+#include "core/math/math_funcs.h"
+#include "core/os/os.h"
+#include "core/string_formatter.h"
+#include "scene/2d/node_2d.h"
+#include "scene/resources/packed_scene.h"
+
+namespace TestPackedScene {
+
+enum {
+    CHILD_COUNT = 32,
+    INSTANCE_COUNT = 2000,
+};
+
+Ref<PackedScene> make_scene() {
+    Node2D *root = memnew(Node2D);
+    root->set_name("Root");
+    for (int i = 0; i < CHILD_COUNT; ++i) {
+        Node2D *child = memnew(Node2D);
+        child->set_name(FormatVE("Child%d", i));
+        child->set_position(Vector2(i, i * 2));
+        child->set_rotation(i * 0.1f);
+        child->set_scale(Vector2(1 + i, 1 + i));
+        child->set_z_index(i);
+        root->add_child(child);
+        child->set_owner(root);
+    }
+    Ref<PackedScene> scene(make_ref_counted<PackedScene>());
+    Error err = scene->pack(root);
+    memdelete(root);
+    ERR_FAIL_COND_V(err != OK, Ref<PackedScene>());
+    return scene;
+}
+
+bool validate(Node *p_root) {
+    Node2D *root = object_cast<Node2D>(p_root);
+    if (!root || root->get_child_count() != CHILD_COUNT)
+        return false;
+    for (int i = 0; i < CHILD_COUNT; ++i) {
+        Node2D *child = object_cast<Node2D>(root->get_child(i));
+        if (!child)
+            return false;
+        if (child->get_position() != Vector2(i, i * 2) || child->get_z_index() != i)
+            return false;
+        if (!Math::is_equal_approx(child->get_rotation(), i * 0.1f))
+            return false;
+    }
+    return true;
+}
+
+bool test_instance() {
+    Ref<PackedScene> scene = make_scene();
+    if (!scene)
+        return false;
+
+    bool ok = true;
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    for (int i = 0; i < INSTANCE_COUNT; ++i) {
+        Node *n = scene->instance();
+        ok = ok && validate(n);
+        memdelete(n);
+    }
+    uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+    OS::get_singleton()->print(FormatVE("instance(): %d copies of %d nodes in %d usec\n", INSTANCE_COUNT, CHILD_COUNT + 1, int(elapsed)));
+    return ok;
+}
+
+bool test_instance_multiple() {
+    Ref<PackedScene> scene = make_scene();
+    if (!scene)
+        return false;
+
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    Vector<Node *> nodes = scene->instance_multiple(INSTANCE_COUNT);
+    uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+    OS::get_singleton()->print(FormatVE("instance_multiple(): %d copies of %d nodes in %d usec\n", INSTANCE_COUNT, CHILD_COUNT + 1, int(elapsed)));
+
+    bool ok = nodes.size() == INSTANCE_COUNT;
+    for (Node *n : nodes) {
+        ok = ok && validate(n);
+        memdelete(n);
+    }
+    return ok;
+}
+
+using TestFunc = bool (*)();
+
+TestFunc test_funcs[] = {
+    test_instance,
+    test_instance_multiple,
+    nullptr
+};
+
+MainLoop *test() {
+    int count = 0;
+    int passed = 0;
+
+    while (true) {
+        if (!test_funcs[count])
+            break;
+        bool pass = test_funcs[count]();
+        if (pass)
+            passed++;
+        OS::get_singleton()->print(FormatVE("\t%s\n", pass ? "PASS" : "FAILED"));
+
+        count++;
+    }
+    OS::get_singleton()->print("\n");
+    OS::get_singleton()->print(FormatVE("Passed %i of %i tests\n", passed, count));
+    return nullptr;
+}
+
+} // namespace TestPackedScene
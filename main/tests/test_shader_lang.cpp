@@ -303,36 +303,93 @@ static Error recreate_code(void *p_str, SL::ShaderNode *p_program) {
     return OK;
 }
 
+// used by --benchmark when no shader is given.
+static const char *benchmark_shader = R"(
+shader_type spatial;
+render_mode popo;
+
+uniform vec4 tint : hint_color = vec4(1.0);
+uniform float strength = 0.5;
+const int mask = 0xFF;
+
+float lum(vec3 c) {
+	return dot(c, vec3(0.299, 0.587, 0.114));
+}
+
+void fragment() {
+	vec3 c = tint.rgb * strength;
+	for (int i = 0; i < 8; i++) {
+		c += vec3(float(i & mask) * 1e-2, 2.0f, .5);
+	}
+	if (lum(c) > 10.0) {
+		discard;
+	}
+	ALBEDO = c;
+}
+)";
+
+static void benchmark(const String &p_code, const HashMap<StringName, SL::FunctionInfo> &p_functions, const Vector<StringName> &p_render_modes, const HashSet<StringName> &p_types) {
+
+    const int iterations = 1000;
+    SL sl;
+
+    uint64_t from = OS::get_singleton()->get_ticks_usec();
+    for (int i = 0; i < iterations; i++) {
+        sl.token_debug(p_code);
+    }
+    uint64_t tokenize_usec = OS::get_singleton()->get_ticks_usec() - from;
+
+    from = OS::get_singleton()->get_ticks_usec();
+    for (int i = 0; i < iterations; i++) {
+        if (sl.compile(p_code, p_functions, p_render_modes, p_types) != OK) {
+            print_line("Error at line: " + rtos(sl.get_error_line()) + ": " + sl.get_error_text());
+            return;
+        }
+    }
+    uint64_t parse_usec = OS::get_singleton()->get_ticks_usec() - from;
+
+    print_line(FormatVE("%d iterations, %d bytes: tokenize %.2f usec, tokenize and parse %.2f usec per shader",
+            iterations, int(p_code.length()), double(tokenize_usec) / iterations, double(parse_usec) / iterations));
+}
+
 MainLoop *test() {
 
     const Vector<String> &cmdlargs(OS::get_singleton()->get_cmdline_args());
 
+    bool run_benchmark = false;
+    for (const String &arg : cmdlargs) {
+        if (arg == "--benchmark") {
+            run_benchmark = true;
+        }
+    }
+
     if (cmdlargs.empty()) {
         //try editor!
-        print_line("usage: godot -test shader_lang <shader>");
+        print_line("usage: godot -test shader_lang [--benchmark] <shader>");
         return nullptr;
     }
 
-    const String &test(cmdlargs.back());
-
-    FileAccess *fa = FileAccess::open(test, FileAccess::READ);
+    String code;
+    if (cmdlargs.back() == "--benchmark") {
+        code = benchmark_shader;
+    } else {
+        const String &test(cmdlargs.back());
 
-    if (!fa) {
-        ERR_FAIL_V(nullptr);
-    }
+        FileAccess *fa = FileAccess::open(test, FileAccess::READ);
 
-    String code;
+        if (!fa) {
+            ERR_FAIL_V(nullptr);
+        }
 
-    while (true) {
-        uint8_t c = fa->get_8();
-        if (fa->eof_reached())
-            break;
-        code.push_back(c);
+        while (true) {
+            uint8_t c = fa->get_8();
+            if (fa->eof_reached())
+                break;
+            code.push_back(c);
+        }
+        memdelete(fa);
     }
 
-    SL sl;
-    print_line("tokens:\n\n" + sl.token_debug(code));
-
     HashMap<StringName, SL::FunctionInfo> dt;
     dt["fragment"].built_ins["ALBEDO"] = SL::TYPE_VEC3;
     dt["fragment"].can_discard = true;
@@ -342,6 +399,14 @@ MainLoop *test() {
     HashSet<StringName> types;
     types.insert("spatial");
 
+    if (run_benchmark) {
+        benchmark(code, dt, rm, types);
+        return nullptr;
+    }
+
+    SL sl;
+    print_line("tokens:\n\n" + sl.token_debug(code));
+
     Error err = sl.compile(code, dt, rm, types);
 
     if (err) {
@@ -0,0 +1,193 @@
+/*************************************************************************/
+/*  test_theme_lookup.cpp                                                */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_theme_lookup.h"
+
+#include "core/os/os.h"
+#include "core/string_formatter.h"
+#include "scene/gui/box_container.h"
+#include "scene/gui/button.h"
+#include "scene/gui/label.h"
+#include "scene/gui/panel.h"
+#include "scene/resources/style_box.h"
+#include "scene/resources/theme.h"
+
+namespace TestThemeLookup {
+
+enum {
+    CONTAINER_COUNT = 100,
+    CHILD_COUNT = 200, // controls in every container
+    NESTED_THEME_STEP = 10, // every n-th container owns a theme of its own
+    FRAME_COUNT = 20,
+};
+
+const Color FONT_COLOR(0.25f, 0.5f, 0.75f);
+const Color CHANGED_FONT_COLOR(1, 0, 0);
+
+struct ControlTree {
+    Control *root = nullptr;
+    Ref<Theme> theme;
+    Vector<Control *> controls;
+
+    ControlTree() {
+        theme = make_ref_counted<Theme>();
+        theme->set_color("font_color", "Label", FONT_COLOR);
+        theme->set_color("font_color", "Button", FONT_COLOR);
+        theme->set_constant("line_spacing", "Label", 3);
+        theme->set_stylebox("panel", "Panel", make_ref_counted<StyleBoxFlat>());
+
+        Ref<Theme> nested = make_ref_counted<Theme>();
+        nested->set_constant("hseparation", "Button", 7);
+
+        root = memnew(Control);
+        root->set_theme(theme);
+        for (int i = 0; i < CONTAINER_COUNT; ++i) {
+            VBoxContainer *container = memnew(VBoxContainer);
+            if (i % NESTED_THEME_STEP == 0) {
+                container->set_theme(nested);
+            }
+            root->add_child(container);
+            for (int j = 0; j < CHILD_COUNT; ++j) {
+                Control *c;
+                switch (j % 3) {
+                    case 0: c = memnew(Label); break;
+                    case 1: c = memnew(Button); break;
+                    default: c = memnew(Panel); break;
+                }
+                container->add_child(c);
+                controls.push_back(c);
+            }
+        }
+    }
+    ~ControlTree() {
+        memdelete(root);
+    }
+};
+
+// Queries the items the controls' NOTIFICATION_DRAW handlers use, returns false if any of them resolved wrongly.
+bool redraw(const ControlTree &p_tree, const Color &p_font_color) {
+    bool ok = true;
+    for (Control *c : p_tree.controls) {
+        if (object_cast<Label>(c)) {
+            ok = ok && c->get_theme_color("font_color") == p_font_color;
+            ok = ok && c->get_theme_constant("line_spacing") == 3;
+            c->get_theme_stylebox("normal");
+            c->get_theme_font("font");
+        } else if (object_cast<Button>(c)) {
+            ok = ok && c->get_theme_color("font_color") == p_font_color;
+            c->get_theme_constant("hseparation");
+            c->get_theme_stylebox("normal");
+            c->get_theme_stylebox("focus");
+            c->get_theme_font("font");
+        } else {
+            ok = ok && c->get_theme_stylebox("panel") == p_tree.theme->get_stylebox("panel", "Panel");
+        }
+    }
+    return ok;
+}
+
+bool test_redraw() {
+    ControlTree tree;
+    int control_count = tree.controls.size();
+
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    bool ok = redraw(tree, FONT_COLOR);
+    uint64_t first = OS::get_singleton()->get_ticks_usec() - start;
+
+    start = OS::get_singleton()->get_ticks_usec();
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        ok = redraw(tree, FONT_COLOR) && ok;
+    }
+    uint64_t frames = OS::get_singleton()->get_ticks_usec() - start;
+
+    OS::get_singleton()->print(FormatVE("redraw of %d controls: first frame %d usec, %d usec per frame after that\n",
+            control_count, int(first), int(frames / FRAME_COUNT)));
+    return ok;
+}
+
+bool test_invalidation() {
+    ControlTree tree;
+    bool ok = redraw(tree, FONT_COLOR);
+
+    // replacing an existing item does not emit "changed" immediately, but lookups must see it.
+    tree.theme->set_color("font_color", "Label", CHANGED_FONT_COLOR);
+    tree.theme->set_color("font_color", "Button", CHANGED_FONT_COLOR);
+    ok = ok && redraw(tree, CHANGED_FONT_COLOR);
+
+    // overrides are checked before the cache.
+    Control *label = tree.controls[0];
+    label->add_theme_color_override("font_color", FONT_COLOR);
+    ok = ok && label->get_theme_color("font_color") == FONT_COLOR;
+
+    // moving a control under a container with another theme owner.
+    Control *moved = tree.controls[1];
+    Ref<Theme> other = make_ref_counted<Theme>();
+    other->set_color("font_color", "Button", FONT_COLOR);
+    Control *target = memnew(Control);
+    target->set_theme(other);
+    tree.root->add_child(target);
+    moved->get_parent()->remove_child(moved);
+    target->add_child(moved);
+    ok = ok && moved->get_theme_color("font_color") == FONT_COLOR;
+
+    // removing the theme again falls back to the root owner.
+    target->set_theme(Ref<Theme>());
+    ok = ok && moved->get_theme_color("font_color") == CHANGED_FONT_COLOR;
+    return ok;
+}
+
+using TestFunc = bool (*)();
+
+TestFunc test_funcs[] = {
+    test_redraw,
+    test_invalidation,
+    nullptr
+};
+
+MainLoop *test() {
+    int count = 0;
+    int passed = 0;
+
+    while (true) {
+        if (!test_funcs[count])
+            break;
+        bool pass = test_funcs[count]();
+        if (pass)
+            passed++;
+        OS::get_singleton()->print(FormatVE("\t%s\n", pass ? "PASS" : "FAILED"));
+
+        count++;
+    }
+    OS::get_singleton()->print("\n");
+    OS::get_singleton()->print(FormatVE("Passed %i of %i tests\n", passed, count));
+    return nullptr;
+}
+
+} // namespace TestThemeLookup
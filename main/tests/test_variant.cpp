@@ -0,0 +1,178 @@
+/*************************************************************************/
+/*  test_variant.cpp                                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_variant.h"
+
+#include "core/math/aabb.h"
+#include "core/math/basis.h"
+#include "core/math/transform.h"
+#include "core/math/transform_2d.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string_formatter.h"
+#include "core/variant.h"
+
+namespace TestVariant {
+
+enum {
+    VARIANT_COUNT = 100000,
+    ROUNDS = 10,
+};
+
+struct TypeSample {
+    const char *name;
+    Variant value;
+};
+
+Vector<TypeSample> make_samples() {
+    return {
+        { "int", Variant(42) },
+        { "Vector3", Variant(Vector3(1, 2, 3)) },
+        { "String", Variant("benchmark") },
+        { "Transform2D", Variant(Transform2D(0.5f, Vector2(1, 2))) },
+        { "AABB", Variant(AABB(Vector3(1, 2, 3), Vector3(4, 5, 6))) },
+        { "Basis", Variant(Basis(Vector3(0, 1, 0), 0.5f)) },
+        { "Transform", Variant(Transform(Basis(Vector3(0, 1, 0), 0.5f), Vector3(1, 2, 3))) },
+    };
+}
+
+bool benchmark_type(const TypeSample &p_sample) {
+    bool ok = true;
+    uint64_t copy_time = 0;
+    uint64_t assign_time = 0;
+    uint64_t destroy_time = 0;
+
+    Vector<Variant> assigned;
+    assigned.resize(VARIANT_COUNT);
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        uint64_t start = OS::get_singleton()->get_ticks_usec();
+        Vector<Variant> copies;
+        copies.reserve(VARIANT_COUNT);
+        for (int i = 0; i < VARIANT_COUNT; ++i) {
+            copies.emplace_back(p_sample.value);
+        }
+        copy_time += OS::get_singleton()->get_ticks_usec() - start;
+
+        // every other round the targets hold a different type, so assignment has to replace the payload.
+        Variant other = round % 2 ? Variant() : Variant(Vector2());
+        for (Variant &v : assigned) {
+            v = other;
+        }
+        start = OS::get_singleton()->get_ticks_usec();
+        for (int i = 0; i < VARIANT_COUNT; ++i) {
+            assigned[i] = copies[i];
+        }
+        assign_time += OS::get_singleton()->get_ticks_usec() - start;
+
+        ok = ok && copies.back() == p_sample.value && assigned.front() == p_sample.value;
+
+        start = OS::get_singleton()->get_ticks_usec();
+        copies.clear();
+        destroy_time += OS::get_singleton()->get_ticks_usec() - start;
+    }
+
+    double count = double(VARIANT_COUNT) * ROUNDS;
+    OS::get_singleton()->print(FormatVE("%-12s copy %6.1f ns, assign %6.1f ns, destroy %6.1f ns\n", p_sample.name,
+            copy_time * 1000.0 / count, assign_time * 1000.0 / count, destroy_time * 1000.0 / count));
+    return ok;
+}
+
+bool test_throughput() {
+    bool ok = true;
+    for (const TypeSample &sample : make_samples()) {
+        ok = benchmark_type(sample) && ok;
+    }
+    return ok;
+}
+
+struct CrossThreadData {
+    Vector<Variant> variants;
+};
+
+void create_on_thread(void *p_user) {
+    CrossThreadData *data = static_cast<CrossThreadData *>(p_user);
+    Transform xform(Basis(Vector3(1, 0, 0), 0.25f), Vector3(4, 5, 6));
+    for (int i = 0; i < VARIANT_COUNT; ++i) {
+        data->variants.emplace_back(i % 2 ? Variant(xform) : Variant(AABB(Vector3(i, 0, 0), Vector3(1, 1, 1))));
+    }
+}
+
+bool test_cross_thread_release() {
+    // payloads created on one thread and released on another must stay valid and reusable.
+    CrossThreadData data;
+    Thread thread;
+    thread.start(create_on_thread, &data);
+    thread.wait_to_finish();
+
+    bool ok = int(data.variants.size()) == VARIANT_COUNT;
+    for (int i = 0; ok && i < VARIANT_COUNT; i += 2) {
+        ok = AABB(data.variants[i]).position.x == i;
+    }
+    data.variants.clear();
+
+    Vector<Variant> reused;
+    for (int i = 0; i < VARIANT_COUNT; ++i) {
+        reused.emplace_back(Basis(Vector3(0, 0, 1), i * 0.001f));
+    }
+    for (int i = 0; ok && i < VARIANT_COUNT; ++i) {
+        ok = Basis(reused[i]) == Basis(Vector3(0, 0, 1), i * 0.001f);
+    }
+    return ok;
+}
+
+using TestFunc = bool (*)();
+
+TestFunc test_funcs[] = {
+    test_throughput,
+    test_cross_thread_release,
+    nullptr
+};
+
+MainLoop *test() {
+    int count = 0;
+    int passed = 0;
+
+    while (true) {
+        if (!test_funcs[count])
+            break;
+        bool pass = test_funcs[count]();
+        if (pass)
+            passed++;
+        OS::get_singleton()->print(FormatVE("\t%s\n", pass ? "PASS" : "FAILED"));
+
+        count++;
+    }
+    OS::get_singleton()->print("\n");
+    OS::get_singleton()->print(FormatVE("Passed %i of %i tests\n", passed, count));
+    return nullptr;
+}
+
+} // namespace TestVariant
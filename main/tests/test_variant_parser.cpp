@@ -0,0 +1,201 @@
+/*************************************************************************/
+/*  test_variant_parser.cpp                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2019 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2019 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "test_variant_parser.h"
+
+#include "core/dictionary.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/pool_vector.h"
+#include "core/resource/resource_manager.h"
+#include "core/string_formatter.h"
+#include "core/string_utils.h"
+#include "core/variant_parser.h"
+#include "scene/resources/packed_scene.h"
+
+namespace TestVariantParser {
+
+enum {
+    NODE_COUNT = 2000,
+    POINT_COUNT = 256, // points in the PoolVector3Array stored on every node
+};
+
+String scene_path() {
+    return PathUtils::plus_file(OS::get_singleton()->get_user_data_dir(), "test_variant_parser.tscn");
+}
+
+Vector3 make_point(int p_node, int p_point) {
+    // all components are exact in short decimal form, so parsed values can be compared directly.
+    return Vector3(p_node * 0.5f, p_point * 0.25f, -p_point - 0.125f);
+}
+
+bool write_scene() {
+    FileAccessRef f = FileAccess::open(scene_path(), FileAccess::WRITE);
+    ERR_FAIL_COND_V(!f, false);
+
+    f->store_line("[gd_scene format=2]");
+    f->store_line("");
+    f->store_line("[node name=\"Root\" type=\"Node2D\"]");
+    for (int i = 0; i < NODE_COUNT; ++i) {
+        f->store_line("");
+        f->store_line(FormatVE("[node name=\"Child%d\" type=\"Node2D\" parent=\".\"]", i));
+        f->store_line(FormatVE("position = Vector2( %d, %d )", i, i * 2));
+        String points("__meta__ = {\n\"points\": PoolVector3Array( ");
+        for (int j = 0; j < POINT_COUNT; ++j) {
+            Vector3 p = make_point(i, j);
+            if (j > 0)
+                points += ", ";
+            points += FormatVE("%g, %g, %g", p.x, p.y, p.z);
+        }
+        points += " )\n}";
+        f->store_line(points);
+    }
+    return f->get_error() == OK;
+}
+
+bool validate_points(const Variant &p_meta, int p_node) {
+    if (p_meta.get_type() != VariantType::DICTIONARY)
+        return false;
+    Dictionary meta = p_meta.as<Dictionary>();
+    PoolVector<Vector3> points = meta.get(Variant("points"), Variant()).as<PoolVector<Vector3>>();
+    if (points.size() != POINT_COUNT)
+        return false;
+    PoolVector<Vector3>::Read r = points.read();
+    for (int j = 0; j < POINT_COUNT; ++j) {
+        if (r[j] != make_point(p_node, j))
+            return false;
+    }
+    return true;
+}
+
+// Parses every tag and assignment of the test scene, checking the point arrays as they come.
+bool parse_stream(VariantParserStream *p_stream) {
+    VariantParser::Tag tag;
+    String assign;
+    String err_str;
+    Variant value;
+    int line = 1;
+    int node = 0;
+
+    while (true) {
+        assign.clear();
+        tag.fields.clear();
+        tag.name.clear();
+
+        Error err = VariantParser::parse_tag_assign_eof(p_stream, line, err_str, tag, assign, value);
+        if (err == ERR_FILE_EOF)
+            break;
+        if (err != OK) {
+            OS::get_singleton()->print(FormatVE("Parse error at line %d: %s\n", line, err_str.c_str()));
+            return false;
+        }
+        if (assign == "__meta__") {
+            if (!validate_points(value, node))
+                return false;
+            node++;
+        }
+    }
+    return node == NODE_COUNT;
+}
+
+bool test_parse_file() {
+    if (!write_scene())
+        return false;
+
+    FileAccess *f = FileAccess::open(scene_path(), FileAccess::READ);
+    ERR_FAIL_COND_V(!f, false);
+    uint64_t len = f->get_len();
+
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    VariantParserStream *stream = VariantParser::get_file_stream(f);
+    bool ok = parse_stream(stream);
+    VariantParser::release_stream(stream);
+    uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+    memdelete(f);
+
+    OS::get_singleton()->print(FormatVE("file stream: parsed %d KiB in %d usec\n", int(len / 1024), int(elapsed)));
+    return ok;
+}
+
+bool test_parse_string() {
+    String text = FileAccess::get_file_as_string(scene_path());
+    if (text.empty())
+        return false;
+
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    VariantParserStream *stream = VariantParser::get_string_stream(eastl::move(text));
+    bool ok = parse_stream(stream);
+    VariantParser::release_stream(stream);
+    uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+
+    OS::get_singleton()->print(FormatVE("string stream: parsed in %d usec\n", int(elapsed)));
+    return ok;
+}
+
+bool test_load_scene() {
+    uint64_t start = OS::get_singleton()->get_ticks_usec();
+    Ref<PackedScene> scene = dynamic_ref_cast<PackedScene>(gResourceManager().load(scene_path(), "", true));
+    uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - start;
+    if (!scene)
+        return false;
+
+    OS::get_singleton()->print(FormatVE("load(): %d nodes in %d usec\n", NODE_COUNT + 1, int(elapsed)));
+    return scene->get_state()->get_node_count() == NODE_COUNT + 1;
+}
+
+using TestFunc = bool (*)();
+
+TestFunc test_funcs[] = {
+    test_parse_file,
+    test_parse_string,
+    test_load_scene,
+    nullptr
+};
+
+MainLoop *test() {
+    int count = 0;
+    int passed = 0;
+
+    while (true) {
+        if (!test_funcs[count])
+            break;
+        bool pass = test_funcs[count]();
+        if (pass)
+            passed++;
+        OS::get_singleton()->print(FormatVE("\t%s\n", pass ? "PASS" : "FAILED"));
+
+        count++;
+    }
+    OS::get_singleton()->print("\n");
+    OS::get_singleton()->print(FormatVE("Passed %i of %i tests\n", passed, count));
+    return nullptr;
+}
+
+} // namespace TestVariantParser
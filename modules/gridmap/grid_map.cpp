@@ -34,6 +34,7 @@
 #include "core/pair.h"
 #include "core/object_tooling.h"
 #include "core/message_queue.h"
+#include "core/os/thread_work_pool.h"
 #include "core/method_bind.h"
 #include "scene/3d/light_3d.h"
 #include "scene/resources/mesh_library.h"
@@ -43,6 +44,9 @@
 #include "scene/main/scene_tree.h"
 #include "servers/rendering_server.h"
 #include "core/string.h"
+
+#include "EASTL/sort.h"
+
 IMPL_GDCLASS(GridMap)
 
 using namespace eastl;
@@ -302,48 +306,34 @@ void GridMap::set_cell_item(int p_x, int p_y, int p_z, int p_item, int p_rot) {
             ERR_FAIL_COND(!octant_map.contains(octantkey));
             Octant &g = *octant_map[octantkey];
             g.cells.erase(key);
-            g.dirty = true;
+            g.dirty_cells.insert(key);
             cell_map.erase(key);
-            _queue_octants_dirty();
+            _octant_mark_dirty(octantkey, g);
         }
         return;
     }
 
-    OctantKey octantkey = ok;
-
-    if (!octant_map.contains(octantkey)) {
-        //create octant because it does not exist
-        Octant *g = memnew(Octant);
-        g->dirty = true;
-        g->static_body = PhysicsServer3D::get_singleton()->body_create(PhysicsServer3D::BODY_MODE_STATIC);
-        PhysicsServer3D::get_singleton()->body_attach_object_instance_id(g->static_body, get_instance_id());
-        PhysicsServer3D::get_singleton()->body_set_collision_layer(g->static_body, collision_layer);
-        PhysicsServer3D::get_singleton()->body_set_collision_mask(g->static_body, collision_mask);
-        SceneTree *st = SceneTree::get_singleton();
-
-        if (st && st->is_debugging_collisions_hint()) {
+    Cell c;
+    c.item = p_item;
+    c.rot = p_rot;
 
-            g->collision_debug = RenderingServer::get_singleton()->mesh_create();
-            g->collision_debug_instance = RenderingServer::get_singleton()->instance_create();
-            RenderingServer::get_singleton()->instance_set_base(g->collision_debug_instance, g->collision_debug);
-        }
+    auto existing = cell_map.find(key);
+    if (existing != cell_map.end() && existing->second.cell == c.cell) {
+        return; // nothing changes
+    }
 
-        octant_map[octantkey] = g;
+    OctantKey octantkey = ok;
 
-        if (is_inside_world()) {
-            _octant_enter_world(octantkey);
-            _octant_transform(octantkey);
-        }
+    auto octant = octant_map.find(octantkey);
+    if (octant == octant_map.end()) {
+        //create octant because it does not exist, server side objects are created on its first update
+        octant = octant_map.emplace(octantkey, memnew(Octant)).first;
     }
 
-    Octant &g = *octant_map[octantkey];
+    Octant &g = *octant->second;
     g.cells.insert(key);
-    g.dirty = true;
-    _queue_octants_dirty();
-
-    Cell c;
-    c.item = p_item;
-    c.rot = p_rot;
+    g.dirty_cells.insert(key);
+    _octant_mark_dirty(octantkey, g);
 
     cell_map[key] = c;
 }
@@ -401,153 +391,245 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 
     ERR_FAIL_COND(!octant_map.contains(p_key));
     Octant &g = *octant_map[p_key];
+    if (!g.static_body.is_valid()) {
+        return; // not updated yet, picks the transform up when its bodies are created
+    }
     PhysicsServer3D::get_singleton()->body_set_state(g.static_body, PhysicsServer3D::BODY_STATE_TRANSFORM, get_global_transform());
 
     if (g.collision_debug_instance.is_valid()) {
         RenderingServer::get_singleton()->instance_set_transform(g.collision_debug_instance, get_global_transform());
     }
 
-    for (int i = 0; i < g.multimesh_instances.size(); i++) {
-        RenderingServer::get_singleton()->instance_set_transform(g.multimesh_instances[i].instance, get_global_transform());
+    for (eastl::pair<const int, Octant::MultimeshInstance> &E : g.multimesh_instances) {
+        RenderingServer::get_singleton()->instance_set_transform(E.second.instance, get_global_transform());
     }
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-    ERR_FAIL_COND_V(!octant_map.contains(p_key), false);
-    Octant &g = *octant_map[p_key];
-    if (!g.dirty)
-        return false;
+void GridMap::_octant_mark_dirty(const OctantKey &p_key, Octant &g) {
 
-    //erase body shapes
-    PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
+    if (!g.dirty) {
+        g.dirty = true;
+        dirty_octants.push_back(p_key);
+    }
+    _queue_octants_dirty();
+}
 
-    //erase body shapes debug
-    if (g.collision_debug.is_valid()) {
+void GridMap::_octant_create_bodies(const OctantKey &p_key, Octant &g) {
 
-        RenderingServer::get_singleton()->mesh_clear(g.collision_debug);
+    g.static_body = PhysicsServer3D::get_singleton()->body_create(PhysicsServer3D::BODY_MODE_STATIC);
+    PhysicsServer3D::get_singleton()->body_attach_object_instance_id(g.static_body, get_instance_id());
+    PhysicsServer3D::get_singleton()->body_set_collision_layer(g.static_body, collision_layer);
+    PhysicsServer3D::get_singleton()->body_set_collision_mask(g.static_body, collision_mask);
+    SceneTree *st = SceneTree::get_singleton();
+
+    if (st && st->is_debugging_collisions_hint()) {
+
+        g.collision_debug = RenderingServer::get_singleton()->mesh_create();
+        g.collision_debug_instance = RenderingServer::get_singleton()->instance_create();
+        RenderingServer::get_singleton()->instance_set_base(g.collision_debug_instance, g.collision_debug);
+    }
+
+    if (is_inside_world()) {
+        _octant_enter_world(p_key);
     }
+}
+
+void GridMap::_octant_clear_cells(Octant &g) {
+
+    //erase body shapes
+    PhysicsServer3D::get_singleton()->body_clear_shapes(g.static_body);
+    g.free_shapes.clear();
+    g.shape_count = 0;
 
     //erase navigation
     for (eastl::pair<const IndexKey,Octant::NavMesh> &E : g.navmesh_ids) {
-        NavigationServer::get_singleton()->free(E.second.region);
-
+        if (E.second.region.is_valid()) {
+            NavigationServer::get_singleton()->free(E.second.region);
+        }
     }
     g.navmesh_ids.clear();
 
     //erase multimeshes
+    for (eastl::pair<const int, Octant::MultimeshInstance> &E : g.multimesh_instances) {
 
-    for (int i = 0; i < g.multimesh_instances.size(); i++) {
-
-        RenderingServer::get_singleton()->free_rid(g.multimesh_instances[i].instance);
-        RenderingServer::get_singleton()->free_rid(g.multimesh_instances[i].multimesh);
+        RenderingServer::get_singleton()->free_rid(E.second.instance);
+        RenderingServer::get_singleton()->free_rid(E.second.multimesh);
     }
     g.multimesh_instances.clear();
+    g.cell_states.clear();
+}
 
-    if (g.cells.empty()) {
-        //octant no longer needed
-        _octant_clean_up(p_key);
-        return true;
+void GridMap::_octant_remove_cell(Octant &g, IndexKey p_key) {
+
+    auto state_iter = g.cell_states.find(p_key);
+    if (state_iter == g.cell_states.end()) {
+        return;
     }
+    Octant::CellState &state = state_iter->second;
 
-    Vector<Vector3> col_debug;
+    for (int shape : state.shapes) {
+        PhysicsServer3D::get_singleton()->body_set_shape_disabled(g.static_body, shape, true);
+        g.free_shapes.push_back(shape);
+    }
 
-    /*
-     * foreach item in this octant,
-     * set item's multimesh's instance count to number of cells which have this item
-     * and set said multimesh bounding box to one containing all cells which have this item
-     */
+    auto nav = g.navmesh_ids.find(p_key);
+    if (nav != g.navmesh_ids.end()) {
+        if (nav->second.region.is_valid()) {
+            NavigationServer::get_singleton()->free(nav->second.region);
+        }
+        g.navmesh_ids.erase(nav);
+    }
 
-    Map<int, Vector<Pair<Transform, IndexKey> > > multimesh_items;
+    auto mm_iter = g.multimesh_instances.find(state.item);
+    if (mm_iter != g.multimesh_instances.end()) {
+        Octant::MultimeshInstance &mmi = mm_iter->second;
+        const int last = mmi.slot_cells.size() - 1;
+        if (last == 0) {
+            // the last cell using this item is gone
+            RenderingServer::get_singleton()->free_rid(mmi.instance);
+            RenderingServer::get_singleton()->free_rid(mmi.multimesh);
+            g.multimesh_instances.erase(mm_iter);
+        } else {
+            if (state.slot != last) {
+                // keep the used instances packed by moving the last one into the freed slot
+                mmi.slot_cells[state.slot] = mmi.slot_cells[last];
+                mmi.slot_xforms[state.slot] = mmi.slot_xforms[last];
+                RenderingServer::get_singleton()->multimesh_instance_set_transform(mmi.multimesh, state.slot, mmi.slot_xforms[state.slot]);
+                g.cell_states[mmi.slot_cells[state.slot]].slot = state.slot;
+            }
+            // unused instances still count for the multimesh AABB, park them on a used one
+            RenderingServer::get_singleton()->multimesh_instance_set_transform(mmi.multimesh, last, mmi.slot_xforms[0]);
+            mmi.slot_cells.pop_back();
+            mmi.slot_xforms.pop_back();
+            RenderingServer::get_singleton()->multimesh_set_visible_instances(mmi.multimesh, last);
+        }
+    }
 
-    for (IndexKey E : g.cells) {
+    g.cell_states.erase(state_iter);
+}
 
-        ERR_CONTINUE(!cell_map.contains(E));
-        const Cell &c = cell_map[E];
+void GridMap::_octant_add_cell(Octant &g, IndexKey p_key) {
 
-        if (not mesh_library || !mesh_library->has_item(c.item))
-            continue;
+    ERR_FAIL_COND(!cell_map.contains(p_key));
+    const Cell &c = cell_map[p_key];
 
-        Vector3 cellpos = Vector3(E.x, E.y, E.z);
-        Vector3 ofs = _get_offset();
+    if (not mesh_library || !mesh_library->has_item(c.item))
+        return;
 
-        Transform xform;
+    Octant::CellState &state = g.cell_states[p_key];
 
-        xform.basis.set_orthogonal_index(c.rot);
-        xform.set_origin(cellpos * cell_size + ofs);
-        xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-        if (baked_meshes.empty()) {
-            if (mesh_library->get_item_mesh(c.item)) {
-                multimesh_items[c.item].emplace_back(xform,E);
-            }
-        }
+    Vector3 cellpos = Vector3(p_key.x, p_key.y, p_key.z);
+    Vector3 ofs = _get_offset();
 
-        PoolVector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-        auto wr(shapes.write());
-        // add the item's shape at given xform to octant's static_body
-        for (int i = 0; i < shapes.size(); i++) {
-            // add the item's shape
-            if (not wr[i].shape)
-                continue;
-            PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, wr[i].shape->get_rid(), xform * wr[i].local_transform);
-            if (g.collision_debug.is_valid()) {
-                wr[i].shape->add_vertices_to_array(col_debug, xform * wr[i].local_transform);
+    Transform xform;
+
+    xform.basis.set_orthogonal_index(c.rot);
+    xform.set_origin(cellpos * cell_size + ofs);
+    xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+
+    //add to the item's multimesh, only if not baked
+    Ref<Mesh> mesh = mesh_library->get_item_mesh(c.item);
+    if (baked_meshes.empty() && mesh) {
+        RenderingServer *rs = RenderingServer::get_singleton();
+        Octant::MultimeshInstance &mmi = g.multimesh_instances[c.item];
+        const int used = mmi.slot_cells.size();
+
+        if (!mmi.multimesh.is_valid()) {
+            mmi.multimesh = rs->multimesh_create();
+            mmi.instance = rs->instance_create();
+            rs->instance_set_base(mmi.instance, mmi.multimesh);
+            if (is_inside_tree()) {
+                rs->instance_set_scenario(mmi.instance, get_world()->get_scenario());
+                rs->instance_set_transform(mmi.instance, get_global_transform());
             }
+            rs->instance_set_visible(mmi.instance, is_visible_in_tree());
         }
-
-        // add the item's navmesh at given xform to GridMap's Navigation3D ancestor
-        Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
-        if (navmesh) {
-            Octant::NavMesh nm;
-            nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
-
-            if (navigation) {
-                RID region = NavigationServer::get_singleton()->region_create();
-                NavigationServer::get_singleton()->region_set_navmesh(region, navmesh);
-                NavigationServer::get_singleton()->region_set_transform(region, navigation->get_global_transform() * nm.xform);
-                NavigationServer::get_singleton()->region_set_map(region, navigation->get_rid());
-                nm.region = region;
+        mmi.slot_cells.push_back(p_key);
+        mmi.slot_xforms.push_back(xform);
+
+        if (used == mmi.capacity) {
+            // reallocating drops the instance data, grow geometrically to keep that rare
+            mmi.capacity = M_MAX(8, mmi.capacity * 2);
+            rs->multimesh_allocate(mmi.multimesh, mmi.capacity, RS::MULTIMESH_TRANSFORM_3D, RS::MULTIMESH_COLOR_NONE);
+            rs->multimesh_set_mesh(mmi.multimesh, mesh->get_rid());
+            for (int i = 0; i < mmi.capacity; i++) {
+                rs->multimesh_instance_set_transform(mmi.multimesh, i, mmi.slot_xforms[MIN(i, used)]);
             }
-            g.navmesh_ids[E] = nm;
+        } else {
+            rs->multimesh_instance_set_transform(mmi.multimesh, used, xform);
         }
+        rs->multimesh_set_visible_instances(mmi.multimesh, used + 1);
+
+        state.item = c.item;
+        state.slot = used;
     }
 
-    //update multimeshes, only if not baked
-    if (baked_meshes.empty()) {
+    PoolVector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
+    auto rd(shapes.read());
+    // add the item's shape at given xform to octant's static_body, reusing shapes freed by removed cells
+    for (int i = 0; i < shapes.size(); i++) {
+        // add the item's shape
+        if (not rd[i].shape)
+            continue;
+        const Transform shape_xform = xform * rd[i].local_transform;
+        int shape;
+        if (!g.free_shapes.empty()) {
+            shape = g.free_shapes.back();
+            g.free_shapes.pop_back();
+            PhysicsServer3D::get_singleton()->body_set_shape(g.static_body, shape, rd[i].shape->get_rid());
+            PhysicsServer3D::get_singleton()->body_set_shape_transform(g.static_body, shape, shape_xform);
+            PhysicsServer3D::get_singleton()->body_set_shape_disabled(g.static_body, shape, false);
+        } else {
+            shape = g.shape_count++;
+            PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, rd[i].shape->get_rid(), shape_xform);
+        }
+        state.shapes.push_back(shape);
+    }
 
-        for (auto &E : multimesh_items) {
-            Octant::MultimeshInstance mmi;
+    // add the item's navmesh at given xform to GridMap's Navigation3D ancestor
+    Ref<NavigationMesh> navmesh = mesh_library->get_item_navmesh(c.item);
+    if (navmesh) {
+        Octant::NavMesh nm;
+        nm.xform = xform * mesh_library->get_item_navmesh_transform(c.item);
+
+        if (navigation) {
+            RID region = NavigationServer::get_singleton()->region_create();
+            NavigationServer::get_singleton()->region_set_navmesh(region, navmesh);
+            NavigationServer::get_singleton()->region_set_transform(region, navigation->get_global_transform() * nm.xform);
+            NavigationServer::get_singleton()->region_set_map(region, navigation->get_rid());
+            nm.region = region;
+        }
+        g.navmesh_ids[p_key] = nm;
+    }
+}
 
-            RID mm = RenderingServer::get_singleton()->multimesh_create();
-            RenderingServer::get_singleton()->multimesh_allocate(mm, E.second.size(), RS::MULTIMESH_TRANSFORM_3D, RS::MULTIMESH_COLOR_NONE);
-            RenderingServer::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.first)->get_rid());
+void GridMap::_octant_update_collision_debug(Octant &g) {
 
-            int idx = 0;
-            for (const Pair<Transform, IndexKey> &F : E.second) {
-                RenderingServer::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
-#ifdef TOOLS_ENABLED
+    RenderingServer::get_singleton()->mesh_clear(g.collision_debug);
 
-                Octant::MultimeshInstance::Item it;
-                it.index = idx;
-                it.transform = F.first;
-                it.key = F.second;
-                mmi.items.emplace_back(eastl::move(it));
-#endif
+    if (not mesh_library)
+        return;
 
-                idx++;
-            }
+    Vector<Vector3> col_debug;
+    Vector3 ofs = _get_offset();
 
-            RID instance = RenderingServer::get_singleton()->instance_create();
-            RenderingServer::get_singleton()->instance_set_base(instance, mm);
+    for (IndexKey E : g.cells) {
 
-            if (is_inside_tree()) {
-                RenderingServer::get_singleton()->instance_set_scenario(instance, get_world()->get_scenario());
-                RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
-            }
+        const Cell &c = cell_map[E];
+        if (!mesh_library->has_item(c.item))
+            continue;
 
-            mmi.multimesh = mm;
-            mmi.instance = instance;
+        Transform xform;
+        xform.basis.set_orthogonal_index(c.rot);
+        xform.set_origin(Vector3(E.x, E.y, E.z) * cell_size + ofs);
+        xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
 
-            g.multimesh_instances.push_back(mmi);
+        PoolVector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
+        auto wr(shapes.write());
+        for (int i = 0; i < shapes.size(); i++) {
+            if (wr[i].shape) {
+                wr[i].shape->add_vertices_to_array(col_debug, xform * wr[i].local_transform);
+            }
         }
     }
 
@@ -562,14 +644,51 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
             RenderingServer::get_singleton()->mesh_surface_set_material(g.collision_debug, 0, st->get_debug_collision_material()->get_rid());
         }
     }
+}
 
+bool GridMap::_octant_update(const OctantKey &p_key) {
+    ERR_FAIL_COND_V(!octant_map.contains(p_key), false);
+    Octant &g = *octant_map[p_key];
+    if (!g.dirty)
+        return false;
     g.dirty = false;
 
+    if (g.cells.empty()) {
+        //octant no longer needed
+        _octant_clean_up(p_key);
+        return true;
+    }
+
+    if (!g.static_body.is_valid()) {
+        _octant_create_bodies(p_key, g);
+    }
+
+    if (g.rebuild) {
+        _octant_clear_cells(g);
+        g.dirty_cells = g.cells;
+        g.rebuild = false;
+    }
+
+    // patch only the changed cells: drop what they added to the servers, then add their current content
+    for (IndexKey E : g.dirty_cells) {
+        _octant_remove_cell(g, E);
+        if (g.cells.contains(E)) {
+            _octant_add_cell(g, E);
+        }
+    }
+    g.dirty_cells.clear();
+
+    if (g.collision_debug.is_valid()) {
+        _octant_update_collision_debug(g);
+    }
+
     return false;
 }
 
 void GridMap::_reset_physic_bodies_collision_filters() {
     for (eastl::pair<const OctantKey,Octant *> &E : octant_map) {
+        if (!E.second->static_body.is_valid())
+            continue;
         PhysicsServer3D::get_singleton()->body_set_collision_layer(E.second->static_body, collision_layer);
         PhysicsServer3D::get_singleton()->body_set_collision_mask(E.second->static_body, collision_mask);
     }
@@ -579,6 +698,9 @@ void GridMap::_octant_enter_world(const OctantKey &p_key) {
 
     ERR_FAIL_COND(!octant_map.contains(p_key));
     Octant &g = *octant_map[p_key];
+    if (!g.static_body.is_valid()) {
+        return;
+    }
     PhysicsServer3D::get_singleton()->body_set_state(g.static_body, PhysicsServer3D::BODY_STATE_TRANSFORM, get_global_transform());
     PhysicsServer3D::get_singleton()->body_set_space(g.static_body, get_world()->get_space());
 
@@ -587,9 +709,11 @@ void GridMap::_octant_enter_world(const OctantKey &p_key) {
         RenderingServer::get_singleton()->instance_set_transform(g.collision_debug_instance, get_global_transform());
     }
 
-    for (int i = 0; i < g.multimesh_instances.size(); i++) {
-        RenderingServer::get_singleton()->instance_set_scenario(g.multimesh_instances[i].instance, get_world()->get_scenario());
-        RenderingServer::get_singleton()->instance_set_transform(g.multimesh_instances[i].instance, get_global_transform());
+    for (eastl::pair<const int, Octant::MultimeshInstance> &E : g.multimesh_instances) {
+        RenderingServer::get_singleton()->instance_set_scenario(E.second.instance, get_world()->get_scenario());
+        RenderingServer::get_singleton()->instance_set_transform(E.second.instance, get_global_transform());
+        // instances created outside the tree were hidden, is_visible_in_tree() is only meaningful from now on.
+        RenderingServer::get_singleton()->instance_set_visible(E.second.instance, is_visible_in_tree());
     }
 
     if (navigation && mesh_library) {
@@ -613,6 +737,9 @@ void GridMap::_octant_exit_world(const OctantKey &p_key) {
 
     ERR_FAIL_COND(!octant_map.contains(p_key));
     Octant &g = *octant_map[p_key];
+    if (!g.static_body.is_valid()) {
+        return;
+    }
     PhysicsServer3D::get_singleton()->body_set_state(g.static_body, PhysicsServer3D::BODY_STATE_TRANSFORM, get_global_transform());
     PhysicsServer3D::get_singleton()->body_set_space(g.static_body, RID());
 
@@ -621,8 +748,8 @@ void GridMap::_octant_exit_world(const OctantKey &p_key) {
         RenderingServer::get_singleton()->instance_set_scenario(g.collision_debug_instance, RID());
     }
 
-    for (int i = 0; i < g.multimesh_instances.size(); i++) {
-        RenderingServer::get_singleton()->instance_set_scenario(g.multimesh_instances[i].instance, RID());
+    for (eastl::pair<const int, Octant::MultimeshInstance> &E : g.multimesh_instances) {
+        RenderingServer::get_singleton()->instance_set_scenario(E.second.instance, RID());
     }
 
     if (navigation) {
@@ -640,28 +767,22 @@ void GridMap::_octant_clean_up(const OctantKey &p_key) {
 
     ERR_FAIL_COND(!octant_map.contains(p_key));
     Octant &g = *octant_map[p_key];
+    if (!g.static_body.is_valid()) {
+        return; // never reached the servers
+    }
 
     if (g.collision_debug.is_valid())
         RenderingServer::get_singleton()->free_rid(g.collision_debug);
     if (g.collision_debug_instance.is_valid())
         RenderingServer::get_singleton()->free_rid(g.collision_debug_instance);
+    g.collision_debug = RID();
+    g.collision_debug_instance = RID();
 
-    PhysicsServer3D::get_singleton()->free_rid(g.static_body);
-
-    //erase navigation
-    for (eastl::pair<const IndexKey,Octant::NavMesh> &E : g.navmesh_ids) {
-        NavigationServer::get_singleton()->free(E.second.region);
-    }
-    g.navmesh_ids.clear();
-
-    //erase multimeshes
-
-    for (int i = 0; i < g.multimesh_instances.size(); i++) {
+    _octant_clear_cells(g);
 
-        RenderingServer::get_singleton()->free_rid(g.multimesh_instances[i].instance);
-        RenderingServer::get_singleton()->free_rid(g.multimesh_instances[i].multimesh);
-    }
-    g.multimesh_instances.clear();
+    PhysicsServer3D::get_singleton()->free_rid(g.static_body);
+    g.static_body = RID();
+    g.rebuild = true;
 }
 
 void GridMap::_notification(int p_what) {
@@ -739,9 +860,8 @@ void GridMap::_update_visibility() {
 
     for (eastl::pair<const OctantKey,Octant *> &e : octant_map) {
         Octant *octant = e.second;
-        for (int i = 0; i < octant->multimesh_instances.size(); i++) {
-            const Octant::MultimeshInstance &mi = octant->multimesh_instances[i];
-            RenderingServer::get_singleton()->instance_set_visible(mi.instance, is_visible_in_tree());
+        for (const eastl::pair<const int, Octant::MultimeshInstance> &mi : octant->multimesh_instances) {
+            RenderingServer::get_singleton()->instance_set_visible(mi.second.instance, is_visible_in_tree());
         }
     }
 }
@@ -780,6 +900,7 @@ void GridMap::_clear_internal() {
 
     octant_map.clear();
     cell_map.clear();
+    dirty_octants.clear();
 }
 
 void GridMap::clear() {
@@ -798,21 +919,21 @@ void GridMap::_update_octants_callback() {
     if (!awaiting_update)
         return;
 
-    Vector<OctantKey> to_delete;
-    //TODO: consider if we can use iter=octant_map.erase(iter) here?
-    for (eastl::pair<const OctantKey,Octant *> &E : octant_map) {
+    // all cells changed during the frame are applied to the servers here, in one pass over the touched octants
+    for (const OctantKey &E : dirty_octants) {
 
-        if (_octant_update(E.first)) {
-            to_delete.emplace_back(E.first);
+        auto octant = octant_map.find(E);
+        if (octant == octant_map.end())
+            continue;
+        if (_octant_update(E)) {
+            memdelete(octant->second);
+            octant_map.erase(octant);
         }
     }
+    dirty_octants.clear();
 
-    while (!to_delete.empty()) {
-        octant_map.erase(to_delete.front());
-        to_delete.pop_back();
-    }
-
-    _update_visibility();
+    // new multimesh instances get their visibility when _octant_add_cell creates them, existing ones keep it until
+    // NOTIFICATION_VISIBILITY_CHANGED, so the flush stays proportional to the dirty octants.
     awaiting_update = false;
 }
 
@@ -903,10 +1024,9 @@ void GridMap::set_clip(bool p_enabled, bool p_clip_above, int p_floor, Vector3::
     for (eastl::pair<const OctantKey,Octant *> &E : octant_map) {
 
         Octant *g = E.second;
-        g->dirty = true;
+        g->rebuild = true;
+        _octant_mark_dirty(E.first, *g);
     }
-    awaiting_update = true;
-    _update_octants_callback();
 }
 
 void GridMap::set_cell_scale(float p_scale) {
@@ -1018,68 +1138,135 @@ void GridMap::clear_baked_meshes() {
     _recreate_octant_data();
 }
 
-void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texel_size) {
+namespace {
+struct BakeSurface {
+    SurfaceArrays arrays;
+    Ref<Material> material;
+};
 
-    if (not mesh_library)
-        return;
+struct BakeCell {
+    int item;
+    Transform xform;
+};
 
-    //generate
-    Map<OctantKey, Map<Ref<Material>, Ref<SurfaceTool> > > surface_map;
+//! Merges the cells of each octant into one surface per material. Source arrays are fetched from the
+//! RenderingServer beforehand, workers only transform and concatenate them.
+struct OctantBakeJob {
+    HashMap<int, Vector<BakeSurface>> item_surfaces;
+    Vector<Vector<BakeCell>> octant_cells;
+    Vector<Vector<Ref<Material>>> result_materials;
+    Vector<Vector<SurfaceArrays>> result_arrays;
 
-    for (eastl::pair<const IndexKey,Cell> &E : cell_map) {
+    void bake_octant(uint32_t p_index, void *) {
 
-        IndexKey key = E.first;
+        Vector<Ref<Material>> &materials = result_materials[p_index];
+        Vector<Ref<SurfaceTool>> tools;
 
-        int item = E.second.item;
-        if (!mesh_library->has_item(item))
-            continue;
+        for (const BakeCell &c : octant_cells[p_index]) {
 
-        Ref<Mesh> mesh = mesh_library->get_item_mesh(item);
-        if (not mesh)
-            continue;
+            auto surfaces = item_surfaces.find(c.item);
+            if (surfaces == item_surfaces.end())
+                continue;
 
-        Vector3 cellpos = Vector3(key.x, key.y, key.z);
-        Vector3 ofs = _get_offset();
+            for (const BakeSurface &surf : surfaces->second) {
 
-        Transform xform;
+                auto mat_iter = eastl::find(materials.begin(), materials.end(), surf.material);
+                size_t idx = mat_iter - materials.begin();
+                if (mat_iter == materials.end()) {
+                    Ref<SurfaceTool> st(make_ref_counted<SurfaceTool>());
+                    st->begin(Mesh::PRIMITIVE_TRIANGLES);
+                    st->set_material(surf.material);
+                    materials.push_back(surf.material);
+                    tools.emplace_back(eastl::move(st));
+                }
+                tools[idx]->append_from_arrays(surf.arrays, Mesh::PRIMITIVE_TRIANGLES, c.xform);
+            }
+        }
 
-        xform.basis.set_orthogonal_index(E.second.rot);
-        xform.set_origin(cellpos * cell_size + ofs);
-        xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+        Vector<SurfaceArrays> &arrays = result_arrays[p_index];
+        arrays.reserve(tools.size());
+        for (const Ref<SurfaceTool> &st : tools) {
+            arrays.emplace_back(st->commit_to_arrays());
+        }
+    }
+};
+} // end of anonymous namespace
 
-        OctantKey ok;
-        ok.x = key.x / octant_size;
-        ok.y = key.y / octant_size;
-        ok.z = key.z / octant_size;
+void GridMap::make_baked_meshes(bool p_gen_lightmap_uv, float p_lightmap_uv_texel_size) {
 
-        if (!surface_map.contains(ok)) {
-            surface_map[ok] = Map<Ref<Material>, Ref<SurfaceTool> >();
-        }
+    if (not mesh_library)
+        return;
+
+    OctantBakeJob job;
+
+    Vector<OctantKey> octants;
+    octants.reserve(octant_map.size());
+    for (const eastl::pair<const OctantKey, Octant *> &E : octant_map) {
+        octants.push_back(E.first);
+    }
+    eastl::sort(octants.begin(), octants.end());
+
+    Vector3 ofs = _get_offset();
+
+    job.octant_cells.resize(octants.size());
+    for (size_t o = 0; o < octants.size(); o++) {
 
-        Map<Ref<Material>, Ref<SurfaceTool> > &mat_map = surface_map[ok];
+        const Octant &g = *octant_map[octants[o]];
+        Vector<BakeCell> &cells = job.octant_cells[o];
+        cells.reserve(g.cells.size());
 
-        for (int i = 0; i < mesh->get_surface_count(); i++) {
+        for (IndexKey key : g.cells) {
 
-            if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES)
+            const Cell &c = cell_map[key];
+            int item = c.item;
+            if (!mesh_library->has_item(item))
                 continue;
 
-            Ref<Material> surf_mat = mesh->surface_get_material(i);
-            if (!mat_map.contains(surf_mat)) {
-                Ref<SurfaceTool> st(make_ref_counted<SurfaceTool>());
-                st->begin(Mesh::PRIMITIVE_TRIANGLES);
-                st->set_material(surf_mat);
-                mat_map[surf_mat] = st;
+            if (!job.item_surfaces.contains(item)) {
+                // fetch every mesh once, the workers must not talk to the RenderingServer
+                Vector<BakeSurface> &surfaces = job.item_surfaces[item];
+                Ref<Mesh> mesh = mesh_library->get_item_mesh(item);
+                if (mesh) {
+                    for (int i = 0; i < mesh->get_surface_count(); i++) {
+
+                        if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES)
+                            continue;
+
+                        surfaces.push_back({ mesh->surface_get_arrays(i), mesh->surface_get_material(i) });
+                    }
+                }
             }
+            if (job.item_surfaces[item].empty())
+                continue;
+
+            Vector3 cellpos = Vector3(key.x, key.y, key.z);
+
+            Transform xform;
 
-            mat_map[surf_mat]->append_from(mesh, i, xform);
+            xform.basis.set_orthogonal_index(c.rot);
+            xform.set_origin(cellpos * cell_size + ofs);
+            xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+
+            cells.push_back({ item, xform });
         }
     }
 
-    for (const eastl::pair<const OctantKey, Map<Ref<Material>, Ref<SurfaceTool> > > &E : surface_map) {
+    job.result_materials.resize(octants.size());
+    job.result_arrays.resize(octants.size());
+    ThreadWorkPool::get_singleton()->do_work(uint32_t(octants.size()), &job, &OctantBakeJob::bake_octant, nullptr);
+
+    for (size_t o = 0; o < octants.size(); o++) {
+
+        Vector<SurfaceArrays> &arrays = job.result_arrays[o];
+        if (arrays.empty())
+            continue;
 
         Ref<ArrayMesh> mesh(make_ref_counted<ArrayMesh>());
-        for (eastl::pair<const Ref<Material>,Ref<SurfaceTool> > F : E.second) {
-            F.second->commit(mesh);
+        for (size_t i = 0; i < arrays.size(); i++) {
+            mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, eastl::move(arrays[i]));
+            if (job.result_materials[o][i]) {
+                mesh->surface_set_material(mesh->get_surface_count() - 1, job.result_materials[o][i]);
+            }
         }
 
         BakedMesh bm;
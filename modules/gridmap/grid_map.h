@@ -58,7 +58,7 @@ class GODOT_EXPORT GridMap : public Node3D {
 
         bool operator==(IndexKey p_key) const {
 
-            return key < p_key.key;
+            return key == p_key.key;
         }
         constexpr IndexKey() : key(0) { }
     private:
@@ -90,6 +90,8 @@ class GODOT_EXPORT GridMap : public Node3D {
     /**
      * @brief An Octant is a prism containing Cells, and possibly belonging to an Area.
      * A GridMap can have multiple Octants.
+     * Server side data is patched per cell: only cells listed in dirty_cells are removed from and re-added to
+     * the multimeshes, body shapes and navigation regions when the octant is updated.
      */
     struct Octant {
 
@@ -98,24 +100,34 @@ class GODOT_EXPORT GridMap : public Node3D {
             Transform xform;
         };
 
+        /// One multimesh per mesh library item. Used instances are packed at the front, removing a cell moves
+        /// the last instance into its slot.
         struct MultimeshInstance {
             RID instance;
             RID multimesh;
-            struct Item {
-                int index;
-                Transform transform;
-                IndexKey key;
-            };
+            int capacity = 0;
+            Vector<IndexKey> slot_cells;
+            Vector<Transform> slot_xforms;
+        };
 
-            Vector<Item> items; //tools only, for changing visibility
+        /// What a cell currently contributes to the servers.
+        struct CellState {
+            int item = INVALID_CELL_ITEM; // multimesh the cell is drawn by, if any
+            int slot = -1;
+            FixedVector<int, 4, true> shapes; // static_body shape indices
         };
 
-        Vector<MultimeshInstance> multimesh_instances;
+        HashMap<int, MultimeshInstance> multimesh_instances;
         HashSet<IndexKey> cells;
+        HashSet<IndexKey> dirty_cells;
+        HashMap<IndexKey, CellState> cell_states;
+        Vector<int> free_shapes; // disabled body shapes that can be reused
+        int shape_count = 0;
         RID collision_debug;
         RID collision_debug_instance;
 
-        bool dirty;
+        bool dirty = false;
+        bool rebuild = true; // drop all server data and re-add every cell
         RID static_body;
         HashMap<IndexKey, NavMesh> navmesh_ids;
     };
@@ -135,9 +147,18 @@ class GODOT_EXPORT GridMap : public Node3D {
 
             return key < p_key.key;
         }
+        _FORCE_INLINE_ bool operator==(const OctantKey &p_key) const {
+
+            return key == p_key.key;
+        }
 
         //OctantKey(const IndexKey& p_k, int p_item) { indexkey=p_k.key; item=p_item; }
         OctantKey() { key = 0; }
+    private:
+        friend eastl::hash<OctantKey>;
+        explicit operator size_t() const {
+            return size_t(key);
+        }
     };
 
     uint32_t collision_layer;
@@ -161,8 +182,9 @@ class GODOT_EXPORT GridMap : public Node3D {
 
     Ref<MeshLibrary> mesh_library;
 
-    Map<OctantKey, Octant *> octant_map;
+    HashMap<OctantKey, Octant *> octant_map;
     HashMap<IndexKey, Cell> cell_map;
+    Vector<OctantKey> dirty_octants; // flushed together at the end of the frame
 
     void _recreate_octant_data();
 
@@ -186,6 +208,12 @@ class GODOT_EXPORT GridMap : public Node3D {
     }
 
     void _reset_physic_bodies_collision_filters();
+    void _octant_mark_dirty(const OctantKey &p_key, Octant &g);
+    void _octant_create_bodies(const OctantKey &p_key, Octant &g);
+    void _octant_clear_cells(Octant &g);
+    void _octant_remove_cell(Octant &g, IndexKey p_key);
+    void _octant_add_cell(Octant &g, IndexKey p_key);
+    void _octant_update_collision_debug(Octant &g);
     void _octant_enter_world(const OctantKey &p_key);
     void _octant_exit_world(const OctantKey &p_key);
     bool _octant_update(const OctantKey &p_key);
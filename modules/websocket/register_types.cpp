@@ -59,6 +59,9 @@ void register_websocket_types() {
     _SET_HINT(WSS_IN_PKT, 1024, 16384);
     _SET_HINT(WSS_OUT_BUF, 64, 4096);
     _SET_HINT(WSS_OUT_PKT, 1024, 16384);
+    // Only service sockets reported as ready by the platform's NetReactor, optionally waiting on a network thread.
+    GLOBAL_DEF(WSS_USE_EVENT_LOOP, true);
+    GLOBAL_DEF(WSS_EVENT_LOOP_THREAD, false);
 
     WSLPeer::make_default();
     WSLClient::make_default();
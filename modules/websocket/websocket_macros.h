@@ -40,6 +40,8 @@
 #define WSS_IN_PKT "network/limits/websocket_server/max_in_packets"
 #define WSS_OUT_BUF "network/limits/websocket_server/max_out_buffer_kb"
 #define WSS_OUT_PKT "network/limits/websocket_server/max_out_packets"
+#define WSS_USE_EVENT_LOOP "network/limits/websocket_server/use_event_loop"
+#define WSS_EVENT_LOOP_THREAD "network/limits/websocket_server/event_loop_thread"
 
 /* clang-format off */
 #define GDCICLASS(CNAME) \
@@ -82,6 +82,8 @@ bool WSLPeer::_wsl_poll(struct PeerData *p_data) {
         p_data->destroy = true;
     }
     p_data->polling = false;
+    if (!p_data->destroy)
+        _wsl_update_reactor(p_data);
 
     if (p_data->destroy || (wslay_event_get_close_sent(p_data->ctx) && wslay_event_get_close_received(p_data->ctx))) {
         bool valid = p_data->valid;
@@ -91,6 +93,18 @@ bool WSLPeer::_wsl_poll(struct PeerData *p_data) {
     return false;
 }
 
+// Only ask for write readiness while wslay has queued output, level-triggered EPOLLOUT would fire every poll otherwise.
+void WSLPeer::_wsl_update_reactor(struct PeerData *p_data) {
+    if (!p_data->reactor || !p_data->tcp)
+        return;
+    bool want_write = wslay_event_want_write(p_data->ctx);
+    if (want_write == p_data->reactor_write)
+        return;
+    p_data->reactor_write = want_write;
+    uint32_t events = NetReactor::EVENT_READ | (want_write ? NetReactor::EVENT_WRITE : 0);
+    p_data->reactor->modify(p_data->tcp->get_net_socket(), events, p_data->reactor_token);
+}
+
 ssize_t wsl_recv_callback(wslay_event_context_ptr ctx, uint8_t *data, size_t len, int flags, void *user_data) {
     struct WSLPeer::PeerData *peer_data = (struct WSLPeer::PeerData *)user_data;
     if (!peer_data->valid) {
@@ -249,6 +263,7 @@ Error WSLPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
         close_now();
         return FAILED;
     }
+    _wsl_update_reactor(_data);
     return OK;
 }
 
@@ -299,6 +314,7 @@ void WSLPeer::close(int p_code, StringView p_reason) {
         wslay_event_queue_close(_data->ctx, p_code, (const uint8_t *)p_reason.data(), p_reason.size());
         wslay_event_send(_data->ctx);
         _data->closing = true;
+        _wsl_update_reactor(_data);
     }
 
     _in_buffer.clear();
@@ -330,6 +346,24 @@ void WSLPeer::invalidate() {
         _data->valid = false;
 }
 
+void WSLPeer::set_reactor(NetReactor *p_reactor, uint64_t p_token) {
+    if (!_data || !_data->tcp)
+        return;
+    if (_data->reactor)
+        _data->reactor->remove(_data->tcp->get_net_socket());
+
+    _data->reactor = p_reactor;
+    _data->reactor_token = p_token;
+    _data->reactor_write = false;
+    if (!p_reactor)
+        return;
+    if (p_reactor->add(_data->tcp->get_net_socket(), NetReactor::EVENT_READ, p_token) != OK) {
+        _data->reactor = nullptr;
+        return;
+    }
+    _wsl_update_reactor(_data);
+}
+
 WSLPeer::WSLPeer() {
     _data = nullptr;
     _is_string = 0;
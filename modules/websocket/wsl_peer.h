@@ -34,6 +34,7 @@
 #ifndef JAVASCRIPT_ENABLED
 
 #include "core/error_list.h"
+#include "core/io/net_reactor.h"
 #include "core/io/packet_peer.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/ring_buffer.h"
@@ -60,6 +61,10 @@ public:
         Ref<StreamPeerTCP> tcp;
         int id;
         wslay_event_context_ptr ctx;
+        // Set by WSLServer when the connection is registered with its reactor.
+        NetReactor *reactor;
+        uint64_t reactor_token;
+        bool reactor_write;
 
         PeerData() {
             polling = false;
@@ -71,6 +76,9 @@ public:
             ctx = nullptr;
             obj = nullptr;
             peer = nullptr;
+            reactor = nullptr;
+            reactor_token = 0;
+            reactor_write = false;
         }
     };
 
@@ -80,6 +88,7 @@ public:
 private:
     static bool _wsl_poll(struct PeerData *p_data);
     static void _wsl_destroy(struct PeerData **p_data);
+    static void _wsl_update_reactor(struct PeerData *p_data);
 
     struct PeerData *_data;
     uint8_t _is_string;
@@ -114,6 +123,8 @@ public:
     void make_context(PeerData *p_data, unsigned int p_in_buf_size, unsigned int p_in_pkt_size, unsigned int p_out_buf_size, unsigned int p_out_pkt_size);
     Error parse_message(const wslay_event_on_msg_recv_arg *arg);
     void invalidate();
+    //! Registers the connection socket with p_reactor, or unregisters it when p_reactor is null. Used by WSLServer.
+    void set_reactor(NetReactor *p_reactor, uint64_t p_token);
 
     WSLPeer();
     ~WSLPeer() override;
@@ -37,6 +37,10 @@
 
 using namespace eastl;
 
+// Reactor tokens, connected peers use their id.
+#define WSL_TOKEN_PENDING (uint64_t(1) << 32)
+#define WSL_TOKEN_LISTEN (uint64_t(2) << 32)
+
 WSLServer::PendingPeer::PendingPeer() {
     use_ssl = false;
     time = 0;
@@ -172,54 +176,62 @@ Error WSLServer::listen(int p_port, const PoolVector<String> &p_protocols, bool
 
     _protocols.append_array(p_protocols);
 
-    return _server->listen(p_port, bind_ip);
-}
+    Error err = _server->listen(p_port, bind_ip);
+    if (err != OK)
+        return err;
 
-void WSLServer::poll() {
-
-    for (auto iter=_peer_map.begin(); iter!=_peer_map.end(); ) {
-        Ref<WSLPeer> peer((WSLPeer *)iter->second.get());
-        peer->poll();
-        if (!peer->is_connected_to_host()) {
-            _on_disconnect(iter->first, peer->close_code != -1);
-            iter=_peer_map.erase(iter);
-        }
-        else
-            ++iter;
-    }
-    
-    for (auto iter = _pending.begin(); iter!= _pending.end(); ) {
-        Ref<PendingPeer> ppeer = *iter;
-        Error err = ppeer->do_handshake(_protocols);
-        if (err == ERR_BUSY) {
-            continue;
-        }
-        if (err != OK) {
-            iter=_pending.erase(iter);
-            continue;
+    if (GLOBAL_GET(WSS_USE_EVENT_LOOP).as<bool>()) {
+        _reactor = NetReactor::create();
+        if (_reactor && _reactor->add(_server->get_net_socket(), NetReactor::EVENT_READ, WSL_TOKEN_LISTEN) != OK) {
+            memdelete(_reactor);
+            _reactor = nullptr;
         }
-        // Creating new peer
-        int32_t id = _gen_unique_id();
-
-        WSLPeer::PeerData *data = memnew(struct WSLPeer::PeerData);
-        data->obj = this;
-        data->conn = ppeer->connection;
-        data->tcp = ppeer->tcp;
-        data->is_server = true;
-        data->id = id;
-
-        Ref<WSLPeer> ws_peer(make_ref_counted<WSLPeer>());
-        ws_peer->make_context(data, _in_buf_size, _in_pkt_size, _out_buf_size, _out_pkt_size);
-        ws_peer->set_no_delay(true);
-
-        _peer_map[id] = ws_peer;
-        iter = _pending.erase(iter);
-        _on_connect(id, ppeer->protocol);
+        if (_reactor && GLOBAL_GET(WSS_EVENT_LOOP_THREAD).as<bool>() && OS::get_singleton()->can_use_threads())
+            _reactor_thread.start(_reactor);
     }
+    return OK;
+}
 
-    if (!_server->is_listening())
+void WSLServer::_handshake(uint32_t p_key) {
+    auto iter = _pending.find(p_key);
+    if (iter == _pending.end())
         return;
+    Ref<PendingPeer> ppeer = iter->second;
+    Error err = ppeer->do_handshake(_protocols);
+    if (err == ERR_BUSY)
+        return;
+
+    _pending.erase(iter);
+    if (_reactor && !ppeer->use_ssl)
+        _reactor->remove(ppeer->tcp->get_net_socket());
+    if (err != OK)
+        return;
+
+    // Creating new peer
+    int32_t id = _gen_unique_id();
+
+    WSLPeer::PeerData *data = memnew(struct WSLPeer::PeerData);
+    data->obj = this;
+    data->conn = ppeer->connection;
+    data->tcp = ppeer->tcp;
+    data->is_server = true;
+    data->id = id;
+
+    Ref<WSLPeer> ws_peer(make_ref_counted<WSLPeer>());
+    ws_peer->make_context(data, _in_buf_size, _in_pkt_size, _out_buf_size, _out_pkt_size);
+    ws_peer->set_no_delay(true);
 
+    _peer_map[id] = ws_peer;
+    if (_reactor) {
+        if (ppeer->use_ssl)
+            _ssl_peers.insert(id);
+        else
+            ws_peer->set_reactor(_reactor, uint32_t(id));
+    }
+    _on_connect(id, ppeer->protocol);
+}
+
+void WSLServer::_accept_connections() {
     while (_server->is_connection_available()) {
         Ref<StreamPeerTCP> conn = _server->take_connection();
         if (is_refusing_new_connections())
@@ -233,12 +245,108 @@ void WSLServer::poll() {
             peer->connection = ssl;
             peer->use_ssl = true;
         } else {
-        peer->connection = conn;
+            peer->connection = conn;
         }
         peer->tcp = conn;
         peer->time = OS::get_singleton()->get_ticks_msec();
-        _pending.push_back(peer);
+
+        uint32_t key = ++_pending_serial;
+        if (_reactor && !peer->use_ssl)
+            _reactor->add(conn->get_net_socket(), NetReactor::EVENT_READ, WSL_TOKEN_PENDING | key);
+        _pending[key] = peer;
+    }
+}
+
+void WSLServer::_poll_all() {
+
+    for (auto iter=_peer_map.begin(); iter!=_peer_map.end(); ) {
+        Ref<WSLPeer> peer((WSLPeer *)iter->second.get());
+        peer->poll();
+        if (!peer->is_connected_to_host()) {
+            _on_disconnect(iter->first, peer->close_code != -1);
+            iter=_peer_map.erase(iter);
+        }
+        else
+            ++iter;
+    }
+
+    for (auto iter = _pending.begin(); iter != _pending.end();) {
+        uint32_t key = iter->first;
+        ++iter;
+        _handshake(key);
+        if (_pending.empty())
+            break; // stopped from a signal callback.
+    }
+
+    if (!_server->is_listening())
+        return;
+
+    _accept_connections();
+}
+
+void WSLServer::_poll_ready() {
+
+    bool acquired = false;
+    _reactor_events.clear();
+    if (_reactor_thread.is_running())
+        acquired = _reactor_thread.acquire_events(_reactor_events);
+    else
+        _reactor->wait(0, _reactor_events);
+
+    bool accept = false;
+    for (const NetReactor::Event &ev : _reactor_events) {
+        if (ev.token == WSL_TOKEN_LISTEN) {
+            accept = true;
+        } else if (ev.token & WSL_TOKEN_PENDING) {
+            _ready_pending.insert(uint32_t(ev.token));
+        } else {
+            auto E = _peer_map.find(int(ev.token));
+            if (E != _peer_map.end())
+                static_cast<WSLPeer *>(E->second.get())->poll();
+        }
+    }
+    for (int id : _ssl_peers) {
+        static_cast<WSLPeer *>(_peer_map[id].get())->poll();
+    }
+
+    // Peers closed by the events above or directly by the user, this only checks state and does not touch sockets.
+    for (auto iter = _peer_map.begin(); iter != _peer_map.end();) {
+        WSLPeer *peer = static_cast<WSLPeer *>(iter->second.get());
+        if (peer->is_connected_to_host()) {
+            ++iter;
+            continue;
+        }
+        _ssl_peers.erase(iter->first);
+        _on_disconnect(iter->first, peer->close_code != -1);
+        iter = _peer_map.erase(iter);
+    }
+
+    // Handshakes only advance when data arrived, the response is still being sent, or they expired.
+    uint64_t now = OS::get_singleton()->get_ticks_msec();
+    for (auto iter = _pending.begin(); iter != _pending.end();) {
+        uint32_t key = iter->first;
+        const PendingPeer *ppeer = iter->second.get();
+        ++iter;
+        if (ppeer->use_ssl || ppeer->has_request || now - ppeer->time > WSL_SERVER_TIMEOUT || _ready_pending.contains(key)) {
+            _handshake(key);
+            if (_pending.empty())
+                break;
+        }
     }
+    _ready_pending.clear();
+
+    if (acquired)
+        _reactor_thread.release_events();
+
+    if (accept && _server->is_listening())
+        _accept_connections();
+}
+
+void WSLServer::poll() {
+    if (_reactor)
+        _poll_ready();
+    else
+        _poll_all();
 }
 
 bool WSLServer::is_listening() const {
@@ -250,14 +358,23 @@ int WSLServer::get_max_packet_size() const {
 }
 
 void WSLServer::stop() {
+    _reactor_thread.stop();
     _server->stop();
     for (eastl::pair<const int,Ref<WebSocketPeer> > &E : _peer_map) {
         Ref<WSLPeer> peer((WSLPeer *)E.second.get());
+        if (_reactor)
+            peer->set_reactor(nullptr, 0);
         peer->close_now();
     }
     _pending.clear();
+    _ready_pending.clear();
+    _ssl_peers.clear();
     _peer_map.clear();
     _protocols = {};
+    if (_reactor) {
+        memdelete(_reactor);
+        _reactor = nullptr;
+    }
 }
 
 bool WSLServer::has_peer(int p_id) const {
@@ -303,6 +420,8 @@ WSLServer::WSLServer() {
     _out_buf_size = nearest_shift(GLOBAL_GET(WSS_OUT_BUF).as<int>() - 1) + 10;
     _out_pkt_size = nearest_shift(GLOBAL_GET(WSS_OUT_PKT).as<int>() - 1);
     _server = make_ref_counted<TCP_Server>();
+    _pending_serial = 0;
+    _reactor = nullptr;
 }
 
 WSLServer::~WSLServer() {
@@ -35,6 +35,9 @@
 #include "websocket_server.h"
 #include "wsl_peer.h"
 
+#include "core/hash_map.h"
+#include "core/hash_set.h"
+#include "core/io/net_reactor.h"
 #include "core/io/stream_peer_ssl.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/io/tcp_server.h"
@@ -75,10 +78,24 @@ private:
     int _out_buf_size;
     int _out_pkt_size;
 
-    Vector<Ref<PendingPeer> > _pending;
+    HashMap<uint32_t, Ref<PendingPeer> > _pending;
+    uint32_t _pending_serial;
     Ref<TCP_Server> _server;
     PoolVector<String> _protocols;
 
+    // Event loop, only sockets reported as ready are serviced. Null when disabled or not supported.
+    NetReactor *_reactor;
+    NetReactorThread _reactor_thread;
+    Vector<NetReactor::Event> _reactor_events;
+    HashSet<uint32_t> _ready_pending;
+    // SSL peers buffer decrypted records, so socket readiness says nothing about them, they are polled every frame.
+    HashSet<int> _ssl_peers;
+
+    void _handshake(uint32_t p_key);
+    void _accept_connections();
+    void _poll_all();
+    void _poll_ready();
+
 public:
     Error set_buffers(int p_in_buffer, int p_in_packets, int p_out_buffer, int p_out_packets) override;
     Error listen(int p_port, const PoolVector<String> &p_protocols = PoolVector<String>(), bool gd_mp_api = false) override;
@@ -53,8 +53,6 @@ SVGRasterizer::~SVGRasterizer() {
     nsvgDeleteRasterizer(rasterizer);
 }
 
-SVGRasterizer ImageLoaderSVG::rasterizer;
-
 inline void change_nsvg_paint_color(NSVGpaint *p_paint, const uint32_t p_old, const uint32_t p_new) {
 
     if (p_paint->type == NSVG_PAINT_COLOR) {
@@ -125,6 +123,8 @@ Error ImageLoaderSVG::_create_image(ImageData &p_image, const PoolVector<uint8_t
 
     PoolVector<uint8_t>::Write dw = p_image.data.write();
 
+    // nsvgRasterize keeps its scratch buffers in the rasterizer, textures importing side by side need their own.
+    SVGRasterizer rasterizer;
     rasterizer.rasterize(svg_image, 0, 0, params.p_scale * upscale, (uint8_t *)dw.ptr(), w, h, w * 4);
 
     dw.release();
@@ -62,7 +62,6 @@ class ImageLoaderSVG : public QObject, public ImageFormatLoader {
         Vector<uint32_t> old_colors;
         Vector<uint32_t> new_colors;
     } replace_colors;
-    static SVGRasterizer rasterizer;
     static void _convert_colors(NSVGimage *p_svg_image);
     static Error _create_image(ImageData &p_image, const PoolVector<uint8_t> *p_data, const LoadParams &params);
 
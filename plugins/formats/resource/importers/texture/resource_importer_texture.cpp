@@ -34,7 +34,10 @@
 #include "core/io/config_file.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_importer.h"
+#include "core/os/dir_access.h"
 #include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/project_settings.h"
 #include "editor/service_interfaces/EditorServiceInterface.h"
 #include "scene/resources/texture.h"
@@ -82,6 +85,12 @@ void ResourceImporterTexture::build_reconfigured_list(Vector<String> &to_reimpor
 
     mutex->lock();
 
+    for (const String &path : missing_pc_vram_warnings) {
+        m_editor_interface->reportError(StringName("Warning, no suitable PC VRAM compression enabled in Project Settings. This texture "
+                                                     "will not display correctly on PC: " + path));
+    }
+    missing_pc_vram_warnings.clear();
+
     if (make_flags.empty()) {
         mutex->unlock();
         return;
@@ -212,7 +221,50 @@ void ResourceImporterTexture::get_import_options(Vector<ResourceImporterInterfac
     r_options->push_back(ImportOption(PropertyInfo(VariantType::FLOAT, "svg/scale", PropertyHint::Range, "0.001,100,0.001"), 1.0));
 }
 
-void ResourceImporterTexture::_save_stex(const Ref<Image> &p_image, StringView p_to_path, int p_compress_mode,
+namespace {
+struct CompressCall {
+    Image *image;
+    CompressParams params;
+    Error err;
+    std::atomic<bool> done { false };
+
+    static void run(void *p_ud) {
+        CompressCall *call = static_cast<CompressCall *>(p_ud);
+        call->err = Image::compress_image(call->image, call->params);
+        call->done.store(true, std::memory_order_release);
+    }
+};
+} // end of anonymous namespace
+
+Error ResourceImporterTexture::_compress_vram(const Ref<Image> &p_image, ImageCompressMode p_mode, ImageCompressSource p_source, float p_lossy_quality) {
+
+    CompressProgress progress;
+    CompressCall call;
+    call.image = p_image.get();
+    call.params = { p_lossy_quality, p_mode, p_image->detect_used_channels(p_source), &progress };
+
+    if (!m_editor_interface || Thread::get_caller_id() != Thread::get_main_id()) {
+        // the progress dialog is main thread only, threaded imports compress without one.
+        CompressCall::run(&call);
+        return call.err;
+    }
+
+    // compress on a helper thread, so the main thread can keep the dialog (and its cancel button) alive.
+    Thread thread;
+    thread.start(&CompressCall::run, &call);
+    m_editor_interface->progressAddTask("compress_texture", "Compressing texture", 100, true);
+    while (!call.done.load(std::memory_order_acquire)) {
+        if (m_editor_interface->progressTaskStep("compress_texture", "Compressing", int(progress.get_ratio() * 100))) {
+            progress.cancel();
+        }
+        OS::get_singleton()->delay_usec(10000);
+    }
+    thread.wait_to_finish();
+    m_editor_interface->progressEndTask("compress_texture");
+    return call.err;
+}
+
+Error ResourceImporterTexture::_save_stex(const Ref<Image> &p_image, StringView p_to_path, int p_compress_mode,
         float p_lossy_quality, ImageCompressMode p_vram_compression, bool p_mipmaps, int p_texture_flags,
         bool p_streamable, bool p_detect_3d, bool p_detect_srgb, bool p_force_rgbe, bool p_detect_normal,
         bool p_force_normal, bool p_force_po2_for_compressed) {
@@ -333,7 +385,13 @@ void ResourceImporterTexture::_save_stex(const Ref<Image> &p_image, StringView p
                     csource = ImageCompressSource::COMPRESS_SOURCE_SRGB;
                 }
 
-                image->compress(p_vram_compression, csource, p_lossy_quality);
+                Error err = _compress_vram(image, p_vram_compression, csource, p_lossy_quality);
+                if (err == ERR_SKIP) {
+                    // cancelled, don't leave a truncated texture behind.
+                    memdelete(f);
+                    DirAccess::remove_file_or_error(p_to_path);
+                    return err;
+                }
             }
 
             format |= image->get_format();
@@ -367,6 +425,7 @@ void ResourceImporterTexture::_save_stex(const Ref<Image> &p_image, StringView p
     }
 
     memdelete(f);
+    return OK;
 }
 
 Error ResourceImporterTexture::import(StringView p_source_file, StringView p_save_path, const HashMap<StringName, Variant> &p_options, Vector<String> &r_missing_deps,
@@ -492,7 +551,9 @@ Error ResourceImporterTexture::import(StringView p_source_file, StringView p_sav
         }
 
         if (can_bptc || can_s3tc) {
-            _save_stex(image, String(p_save_path) + ".s3tc.stex", compress_mode, lossy, can_bptc ? ImageCompressMode::COMPRESS_BPTC : ImageCompressMode::COMPRESS_S3TC, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, false);
+            err = _save_stex(image, String(p_save_path) + ".s3tc.stex", compress_mode, lossy, can_bptc ? ImageCompressMode::COMPRESS_BPTC : ImageCompressMode::COMPRESS_S3TC, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, false);
+            if (err != OK)
+                return err;
             r_platform_variants->push_back("s3tc");
             formats_imported.push_back("s3tc");
             ok_on_pc = true;
@@ -500,31 +561,41 @@ Error ResourceImporterTexture::import(StringView p_source_file, StringView p_sav
 
         if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_etc2").as<bool>()) {
 
-            _save_stex(image, String(p_save_path) + ".etc2.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_ETC2, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            err = _save_stex(image, String(p_save_path) + ".etc2.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_ETC2, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            if (err != OK)
+                return err;
             r_platform_variants->push_back("etc2");
             formats_imported.push_back("etc2");
         }
 
         if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_etc").as<bool>()) {
-            _save_stex(image, String(p_save_path) + ".etc.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_ETC, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            err = _save_stex(image, String(p_save_path) + ".etc.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_ETC, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            if (err != OK)
+                return err;
             r_platform_variants->push_back("etc");
             formats_imported.push_back("etc");
         }
 
         if (ProjectSettings::get_singleton()->get("rendering/vram_compression/import_pvrtc").as<bool>()) {
 
-            _save_stex(image, String(p_save_path) + ".pvrtc.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_PVRTC4, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            err = _save_stex(image, String(p_save_path) + ".pvrtc.stex", compress_mode, lossy, ImageCompressMode::COMPRESS_PVRTC4, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, true);
+            if (err != OK)
+                return err;
             r_platform_variants->push_back("pvrtc");
             formats_imported.push_back("pvrtc");
         }
 
         if (!ok_on_pc) {
-            m_editor_interface->reportError("Warning, no suitable PC VRAM compression enabled in Project Settings. This texture "
-                                              "will not display correctly on PC.");
+            // UI calls have to wait for the main thread, build_reconfigured_list reports these.
+            mutex->lock();
+            missing_pc_vram_warnings.push_back(String(p_source_file));
+            mutex->unlock();
         }
     } else {
         //import normally
-        _save_stex(image, String(p_save_path) + ".stex", compress_mode, lossy, ImageCompressMode::COMPRESS_S3TC /*this is ignored */, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, false);
+        err = _save_stex(image, String(p_save_path) + ".stex", compress_mode, lossy, ImageCompressMode::COMPRESS_S3TC /*this is ignored */, mipmaps, tex_flags, stream, detect_3d, detect_srgb, force_rgbe, detect_normal, force_normal, false);
+        if (err != OK)
+            return err;
     }
 
     if (r_metadata) {
@@ -50,6 +50,8 @@ protected:
 
     Mutex *mutex;
     Map<StringName, int> make_flags;
+    //! Sources imported without a PC VRAM format, import() may run on a worker so the warning is reported later.
+    Vector<String> missing_pc_vram_warnings;
 
     static void _texture_reimport_srgb(StringName p_tex);
     static void _texture_reimport_3d(StringName p_tex_path);
@@ -81,7 +83,8 @@ public:
     void get_import_options(Vector<ImportOption> *r_options, int p_preset = 0) const override;
     bool get_option_visibility(const StringName &p_option, const HashMap<StringName, Variant> &p_options) const override;
 
-    void _save_stex(const Ref<Image> &p_image, StringView p_to_path, int p_compress_mode, float p_lossy_quality,
+    Error _compress_vram(const Ref<Image> &p_image, ImageCompressMode p_mode, ImageCompressSource p_source, float p_lossy_quality);
+    Error _save_stex(const Ref<Image> &p_image, StringView p_to_path, int p_compress_mode, float p_lossy_quality,
             ImageCompressMode p_vram_compression, bool p_mipmaps, int p_texture_flags, bool p_streamable,
             bool p_detect_3d, bool p_detect_srgb, bool p_force_rgbe, bool p_detect_normal, bool p_force_normal,
             bool p_force_po2_for_compressed);
@@ -92,6 +95,7 @@ public:
 
     void build_reconfigured_list(Vector<String> &editor_is_scanning_or_importing) override;
 
+    bool can_import_threaded() const override { return true; }
     bool are_import_settings_valid(StringView p_path) const override;
     String get_import_settings_string() const override;
 
@@ -30,11 +30,10 @@
 
 #include "image_compress_cvtt.h"
 
-#include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/print_string.h"
 
 #include <ConvectionKernels.h>
-#include <thread>
 
 struct CVTTCompressionJobParams {
     bool is_hdr;
@@ -55,8 +54,9 @@ struct CVTTCompressionRowTask {
 struct CVTTCompressionJobQueue {
     CVTTCompressionJobParams job_params;
     const CVTTCompressionRowTask *job_tasks;
-    uint32_t num_tasks;
-    uint32_t current_task;
+    CompressProgress *progress;
+
+    void digest_row(uint32_t p_index, void *) const;
 };
 
 static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const CVTTCompressionRowTask &p_row_task) {
@@ -128,18 +128,21 @@ static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const
     }
 }
 
-static void _digest_job_queue(void *p_job_queue) {
-    CVTTCompressionJobQueue *job_queue = static_cast<CVTTCompressionJobQueue *>(p_job_queue);
-
-    for (uint32_t next_task = atomic_increment(&job_queue->current_task); next_task <= job_queue->num_tasks; next_task = atomic_increment(&job_queue->current_task)) {
-        _digest_row_task(job_queue->job_params, job_queue->job_tasks[next_task - 1]);
+void CVTTCompressionJobQueue::digest_row(uint32_t p_index, void *) const {
+    if (progress && progress->is_cancelled()) {
+        return;
+    }
+    const CVTTCompressionRowTask &task = job_tasks[p_index];
+    _digest_row_task(job_params, task);
+    if (progress) {
+        progress->add_done((task.width + 3) / 4);
     }
 }
 
-void image_compress_cvtt(Image *p_image, float p_lossy_quality, ImageUsedChannels p_source) {
+static Error image_compress_cvtt(Image *p_image, float p_lossy_quality, ImageUsedChannels p_source, CompressProgress *p_progress) {
 
     if (p_image->get_format() >= Image::FORMAT_BPTC_RGBA)
-        return; //do not compress, already compressed
+        return OK; //do not compress, already compressed
 
     int w = p_image->get_width();
     int h = p_image->get_height();
@@ -148,7 +151,7 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, ImageUsedChannel
     bool is_hdr = (p_image->get_format() >= Image::FORMAT_RH) && (p_image->get_format() <= Image::FORMAT_RGBE9995);
 
     if (!is_ldr && !is_hdr) {
-        return; // Not a usable source format
+        return OK; // Not a usable source format
     }
 
     cvtt::Options options;
@@ -213,10 +216,10 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, ImageUsedChannel
     job_queue.job_params.is_signed = is_signed;
     job_queue.job_params.options = options;
     job_queue.job_params.bytes_per_pixel = is_hdr ? 6 : 4;
+    job_queue.progress = p_progress;
 
-    int num_job_threads = OS::get_singleton()->can_use_threads() ? (OS::get_singleton()->get_processor_count() - 1) : 0;
-
-    PoolVector<CVTTCompressionRowTask> tasks;
+    Vector<CVTTCompressionRowTask> tasks;
+    uint32_t total_blocks = 0;
 
     for (int i = 0; i <= mm_count; i++) {
 
@@ -235,43 +238,31 @@ void image_compress_cvtt(Image *p_image, float p_lossy_quality, ImageUsedChannel
             row_task.y_start = y_start;
             row_task.in_mm_bytes = in_bytes;
             row_task.out_mm_bytes = out_bytes;
-
-            if (num_job_threads > 0) {
-                tasks.push_back(row_task);
-            } else {
-                _digest_row_task(job_queue.job_params, row_task);
-            }
+            tasks.push_back(row_task);
 
             out_bytes += 16 * (bw / 4);
         }
 
+        total_blocks += (bw / 4) * (bh / 4);
         dst_ofs += (M_MAX(4, bw) * M_MAX(4, bh)) >> shift;
         w = M_MAX(w / 2, 1);
         h = M_MAX(h / 2, 1);
     }
 
-    if (num_job_threads > 0) {
-        Vector<std::thread *> threads;
-        threads.resize(num_job_threads);
-
-        PoolVector<CVTTCompressionRowTask>::Read tasks_rb = tasks.read();
-
-        job_queue.job_tasks = &tasks_rb[0];
-        job_queue.current_task = 0;
-        job_queue.num_tasks = static_cast<uint32_t>(tasks.size());
+    if (p_progress) {
+        p_progress->blocks_total.store(total_blocks, std::memory_order_relaxed);
+    }
+    job_queue.job_tasks = tasks.data();
+    ThreadWorkPool::get_singleton()->do_work(tasks.size(), &job_queue, &CVTTCompressionJobQueue::digest_row, nullptr);
 
-        for (int i = 0; i < num_job_threads; i++) {
-            threads[i] = memnew(std::thread(_digest_job_queue, &job_queue));
-        }
-        _digest_job_queue(&job_queue);
+    rb.release();
+    wb.release();
 
-        for (int i = 0; i < num_job_threads; i++) {
-            threads[i]->join();
-            memdelete(threads[i]);
-        }
+    if (p_progress && p_progress->is_cancelled()) {
+        return ERR_SKIP;
     }
-
     p_image->create(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
+    return OK;
 }
 
 void image_decompress_cvtt(Image *p_image) {
@@ -393,8 +384,7 @@ Error ResourceFormatBPTC::compress_image(Image *p_image, CompressParams params)
 {
     if(params.mode!=ImageCompressMode::COMPRESS_BPTC)
         return ERR_UNAVAILABLE;
-    image_compress_cvtt(p_image, params.p_quality, params.used_channels);
-    return OK;
+    return image_compress_cvtt(p_image, params.p_quality, params.used_channels, params.progress);
 }
 
 Error ResourceFormatBPTC::decompress_image(Image *img)
@@ -32,6 +32,7 @@
 
 #include "core/image.h"
 #include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/print_string.h"
 #include "core/string_utils.h"
 
@@ -91,16 +92,60 @@ static Etc::Image::Format _image_format_to_etc2comp_format(Image::Format format)
     }
 }
 
-static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_format, ImageUsedChannels p_channels) {
+// One mip level, etc2comp spends its effort on the blocks with the worst error over the whole mip, so mips are
+// encoded whole (tiles would change the output), concurrently with each other.
+struct EtcMipTask {
+    const uint8_t *src;
+    int width;
+    int height;
+    uint32_t blocks;
+    unsigned int jobs; // etc2comp threads used inside this mip, its output doesn't depend on this count
+    unsigned char *etc_data = nullptr;
+    unsigned int etc_data_len = 0;
+};
+
+struct EtcCompressJob {
+    EtcMipTask *tasks;
+    Etc::Image::Format format;
+    Etc::ErrorMetric error_metric;
+    float effort;
+    CompressProgress *progress;
+
+    void encode_mip(uint32_t p_index, void *) const {
+        if (progress && progress->is_cancelled()) {
+            return;
+        }
+        EtcMipTask &task = tasks[p_index];
+        // convert source image to internal etc2comp format (which is equivalent to Image::FORMAT_RGBAF)
+        // NOTE: We can alternatively add a case to Image::convert to handle Image::FORMAT_RGBAF conversion.
+        const int pixel_count = task.width * task.height;
+        Etc::ColorFloatRGBA *src_rgba_f = new Etc::ColorFloatRGBA[pixel_count];
+        for (int j = 0; j < pixel_count; j++) {
+            int si = j * 4; // RGBA8
+            src_rgba_f[j] = Etc::ColorFloatRGBA::ConvertFromRGBA8(task.src[si], task.src[si + 1], task.src[si + 2], task.src[si + 3]);
+        }
+
+        unsigned int extended_width = 0, extended_height = 0;
+        int encoding_time = 0;
+        Etc::Encode((float *)src_rgba_f, task.width, task.height, format, error_metric, effort, task.jobs, task.jobs, &task.etc_data, &task.etc_data_len, &extended_width, &extended_height, &encoding_time);
+        delete[] src_rgba_f;
+
+        if (progress) {
+            progress->add_done(task.blocks);
+        }
+    }
+};
+
+static Error _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_format, ImageUsedChannels p_channels, CompressProgress *p_progress) {
     Image::Format img_format = p_img->get_format();
 
     if (img_format >= Image::FORMAT_DXT1) {
-        return; //do not compress, already compressed
+        return OK; //do not compress, already compressed
     }
 
     if (img_format > Image::FORMAT_RGBA8) {
         // TODO: we should be able to handle FORMAT_RGBA4444 and FORMAT_RGBA5551 eventually
-        return;
+        return OK;
     }
     // FIXME: Commented out during Vulkan rebase.
     /*
@@ -145,7 +190,7 @@ static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_f
     }
 
     PoolVector<uint8_t>::Read r = img->get_data().read();
-    ERR_FAIL_COND(!r.ptr());
+    ERR_FAIL_COND_V(!r.ptr(), ERR_INVALID_DATA);
 
     unsigned int target_size = Image::get_image_data_size(imgw, imgh, etc_format, p_img->has_mipmaps());
     int mmc = 1 + (p_img->has_mipmaps() ? Image::get_image_required_mipmaps(imgw, imgh, etc_format) : 0);
@@ -156,8 +201,6 @@ static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_f
     PoolVector<uint8_t>::Write w = dst_data.write();
 
     // prepare parameters to be passed to etc2comp
-    int num_cpus = OS::get_singleton()->get_processor_count();
-    int encoding_time = 0;
     float effort = 0.0; //default, reasonable time
 
     if (p_lossy_quality > 0.75f)
@@ -167,50 +210,67 @@ static void _compress_etc(Image *p_img, float p_lossy_quality, bool force_etc1_f
     else if (p_lossy_quality > 0.95f)
         effort = 0.8f;
 
-    Etc::ErrorMetric error_metric = Etc::ErrorMetric::RGBX; // NOTE: we can experiment with other error metrics
-    Etc::Image::Format etc2comp_etc_format = _image_format_to_etc2comp_format(etc_format);
-
-    int wofs = 0;
-
-    print_verbose("ETC: Begin encoding, format: " + Image::get_format_name(etc_format));
-    uint64_t t = OS::get_singleton()->get_ticks_msec();
+    Vector<EtcMipTask> tasks;
+    uint32_t total_blocks = 0;
     for (int i = 0; i < mmc; i++) {
-        // convert source image to internal etc2comp format (which is equivalent to Image::FORMAT_RGBAF)
-        // NOTE: We can alternatively add a case to Image::convert to handle Image::FORMAT_RGBAF conversion.
         int mipmap_ofs = 0, mipmap_size = 0, mipmap_w = 0, mipmap_h = 0;
         img->get_mipmap_offset_size_and_dimensions(i, mipmap_ofs, mipmap_size, mipmap_w, mipmap_h);
-        const uint8_t *src = &r[mipmap_ofs];
-
-        Etc::ColorFloatRGBA *src_rgba_f = new Etc::ColorFloatRGBA[mipmap_w * mipmap_h];
-        for (int j = 0; j < mipmap_w * mipmap_h; j++) {
-            int si = j * 4; // RGBA8
-            src_rgba_f[j] = Etc::ColorFloatRGBA::ConvertFromRGBA8(src[si], src[si + 1], src[si + 2], src[si + 3]);
-        }
-
-        unsigned char *etc_data = nullptr;
-        unsigned int etc_data_len = 0;
-        unsigned int extended_width = 0, extended_height = 0;
-        Etc::Encode((float *)src_rgba_f, mipmap_w, mipmap_h, etc2comp_etc_format, error_metric, effort, num_cpus, num_cpus, &etc_data, &etc_data_len, &extended_width, &extended_height, &encoding_time);
+        EtcMipTask task;
+        task.src = &r[mipmap_ofs];
+        task.width = mipmap_w;
+        task.height = mipmap_h;
+        task.blocks = uint32_t((mipmap_w + 3) / 4) * uint32_t((mipmap_h + 3) / 4);
+        total_blocks += task.blocks;
+        tasks.push_back(task);
+    }
 
-        CRASH_COND(wofs + etc_data_len > target_size);
-                memcpy(&w[wofs], etc_data, etc_data_len);
-        wofs += etc_data_len;
+    // The pool runs the mips side by side, etc2comp threads inside each mip share the cpus by block count.
+    const uint32_t num_cpus = M_MAX(1, OS::get_singleton()->get_processor_count());
+    for (EtcMipTask &task : tasks) {
+        task.jobs = M_MAX(1u, uint32_t(uint64_t(num_cpus) * task.blocks / M_MAX(1u, total_blocks)));
+    }
 
-        delete[] etc_data;
-        delete[] src_rgba_f;
+    EtcCompressJob job;
+    job.tasks = tasks.data();
+    job.format = _image_format_to_etc2comp_format(etc_format);
+    job.error_metric = Etc::ErrorMetric::RGBX; // NOTE: we can experiment with other error metrics
+    job.effort = effort;
+    job.progress = p_progress;
+    if (p_progress) {
+        p_progress->blocks_total.store(total_blocks, std::memory_order_relaxed);
     }
 
+    print_verbose("ETC: Begin encoding, format: " + Image::get_format_name(etc_format));
+    uint64_t t = OS::get_singleton()->get_ticks_msec();
+    ThreadWorkPool::get_singleton()->do_work(tasks.size(), &job, &EtcCompressJob::encode_mip, nullptr);
     print_verbose("ETC: Time encoding: " + rtos(OS::get_singleton()->get_ticks_msec() - t));
 
+    // mips are written in order once all of them are done, so the result is the same as a serial encode.
+    Error err = (p_progress && p_progress->is_cancelled()) ? ERR_SKIP : OK;
+    unsigned int wofs = 0;
+    for (EtcMipTask &task : tasks) {
+        if (err == OK) {
+            CRASH_COND(wofs + task.etc_data_len > target_size);
+            memcpy(&w[wofs], task.etc_data, task.etc_data_len);
+            wofs += task.etc_data_len;
+        }
+        delete[] task.etc_data;
+    }
+    if (err != OK) {
+        return err;
+    }
+
+    w.release();
     p_img->create(imgw, imgh, p_img->has_mipmaps(), etc_format, dst_data);
+    return OK;
 }
 
-static void _compress_etc1(Image *p_img, float p_lossy_quality) {
-    _compress_etc(p_img, p_lossy_quality, true, ImageUsedChannels::USED_CHANNELS_RGB);
+static Error _compress_etc1(Image *p_img, float p_lossy_quality, CompressProgress *p_progress) {
+    return _compress_etc(p_img, p_lossy_quality, true, ImageUsedChannels::USED_CHANNELS_RGB, p_progress);
 }
 
-static void _compress_etc2(Image *p_img, float p_lossy_quality, ImageUsedChannels p_channels) {
-    _compress_etc(p_img, p_lossy_quality, false, p_channels);
+static Error _compress_etc2(Image *p_img, float p_lossy_quality, ImageUsedChannels p_channels, CompressProgress *p_progress) {
+    return _compress_etc(p_img, p_lossy_quality, false, p_channels, p_progress);
 }
 } // end of anonymous namespace
 
@@ -218,14 +278,12 @@ Error ResourceFormatPKM::compress_image(Image *p_image, CompressParams params)
 {
     if(params.mode==ImageCompressMode::COMPRESS_ETC)
     {
-        _compress_etc1(p_image,params.p_quality);
+        return _compress_etc1(p_image,params.p_quality,params.progress);
     }
     else if(params.mode==ImageCompressMode::COMPRESS_ETC2) {
-        _compress_etc2(p_image,params.p_quality,params.used_channels);
+        return _compress_etc2(p_image,params.p_quality,params.used_channels,params.progress);
     }
-    else
-        return ERR_UNAVAILABLE;
-    return OK;
+    return ERR_UNAVAILABLE;
 }
 
 Error ResourceFormatPKM::decompress_image(Image * /*p_image*/)
@@ -34,6 +34,7 @@
 
 #include "core/class_db.h"
 #include "core/os/file_access.h"
+#include "core/os/thread_work_pool.h"
 #include "core/string_utils.h"
 
 #include <cstring>
@@ -472,7 +473,42 @@ static Error _pvrtc_decompress(Image *p_img) {
     return OK;
 }
 
-static void _compress_pvrtc4(Image *p_img) {
+// PVRTC interpolates between neighbouring blocks, so a mip can't be split into tiles without changing the output,
+// the mips are independent though and get encoded side by side.
+struct PvrtcMipTask {
+    const uint8_t *src;
+    uint8_t *dst;
+    int width;
+    int height;
+    int size;
+    uint32_t blocks;
+};
+
+struct PvrtcCompressJob {
+    const PvrtcMipTask *tasks;
+    CompressProgress *progress;
+
+    void encode_mip(uint32_t p_index, void *) const {
+        if (progress && progress->is_cancelled()) {
+            return;
+        }
+        const PvrtcMipTask &task = tasks[p_index];
+        Javelin::RgbaBitmap bm(task.width, task.height);
+        void *dst = (void *)bm.GetData();
+        memcpy(dst, task.src, task.size);
+        Javelin::ColorRgba<unsigned char> *dp = bm.GetData();
+        for (int j = 0; j < task.size / 4; j++) {
+            /* red and blue colors are swapped.  */
+            SWAP(dp[j].r, dp[j].b);
+        }
+        Javelin::PvrTcEncoder::EncodeRgba4Bpp(task.dst, bm);
+        if (progress) {
+            progress->add_done(task.blocks);
+        }
+    }
+};
+
+static Error _compress_pvrtc4(Image *p_img, CompressProgress *p_progress) {
 
     Ref<Image> img = dynamic_ref_cast<Image>(p_img->duplicate());
 
@@ -495,27 +531,38 @@ static void _compress_pvrtc4(Image *p_img) {
         PoolVector<uint8_t>::Write wr = data.write();
         PoolVector<uint8_t>::Read r = img->get_data().read();
 
+        Vector<PvrtcMipTask> tasks;
+        uint32_t total_blocks = 0;
         for (int i = 0; i <= new_img->get_mipmap_count(); i++) {
 
             int ofs, size, w, h;
             img->get_mipmap_offset_size_and_dimensions(i, ofs, size, w, h);
-            Javelin::RgbaBitmap bm(w, h);
-            void *dst = (void *)bm.GetData();
-            memcpy(dst, &r[ofs], size);
-            Javelin::ColorRgba<unsigned char> *dp = bm.GetData();
-            for (int j = 0; j < size / 4; j++) {
-                /* red and blue colors are swapped.  */
-                SWAP(dp[j].r, dp[j].b);
-            }
+            PvrtcMipTask task;
+            task.src = &r[ofs];
+            task.width = w;
+            task.height = h;
+            task.size = size;
+            task.blocks = (M_MAX(w, 4) / 4) * (M_MAX(h, 4) / 4);
+            total_blocks += task.blocks;
             new_img->get_mipmap_offset_size_and_dimensions(i, ofs, size, w, h);
-            Javelin::PvrTcEncoder::EncodeRgba4Bpp(&wr[ofs], bm);
+            task.dst = &wr[ofs];
+            tasks.push_back(task);
+        }
+
+        if (p_progress) {
+            p_progress->blocks_total.store(total_blocks, std::memory_order_relaxed);
         }
+        const PvrtcCompressJob job { tasks.data(), p_progress };
+        ThreadWorkPool::get_singleton()->do_work(tasks.size(), &job, &PvrtcCompressJob::encode_mip, nullptr);
     }
 
+    if (p_progress && p_progress->is_cancelled()) {
+        return ERR_SKIP;
+    }
     p_img->create(new_img->get_width(), new_img->get_height(), new_img->has_mipmaps(), new_img->get_format(), data);
+    return OK;
 }
 
-
 } //end of anonymous namespace
 enum PVRFLags {
 
@@ -676,12 +723,10 @@ Error ResourceFormatPVR::compress_image(Image *p_image, CompressParams params)
     {
         case ImageCompressMode::COMPRESS_PVRTC2:
         case ImageCompressMode::COMPRESS_PVRTC4:
-            _compress_pvrtc4(p_image);
-        break;
+            return _compress_pvrtc4(p_image, params.progress);
     default:
         return ERR_INVALID_PARAMETER;
     }
-    return OK;
 }
 
 Error ResourceFormatPVR::decompress_image(Image *p_image)
@@ -29,9 +29,38 @@
 /*************************************************************************/
 
 #include "image_compress_squish.h"
+#include "core/os/thread_work_pool.h"
 #include "core/ustring.h"
 #include <squish.h>
 
+namespace {
+// One row of 4x4 blocks of one mip level, squish encodes every block independently, so compressing the rows
+// separately produces exactly the same bytes as compressing the whole mip at once.
+struct SquishRowTask {
+    const uint8_t *src;
+    uint8_t *dst;
+    int width;
+    int height; // pixel rows covered by this block row, 4 except for the last row of a mip
+};
+
+struct SquishCompressJob {
+    const SquishRowTask *tasks;
+    int flags;
+    CompressProgress *progress;
+
+    void compress_row(uint32_t p_index, void *) const {
+        if (progress && progress->is_cancelled()) {
+            return;
+        }
+        const SquishRowTask &task = tasks[p_index];
+        squish::CompressImage(task.src, task.width, task.height, task.dst, flags);
+        if (progress) {
+            progress->add_done((task.width + 3) / 4);
+        }
+    }
+};
+} // end of anonymous namespace
+
 Error image_decompress_squish(Image *p_image) {
     int w = p_image->get_width();
     int h = p_image->get_height();
@@ -77,10 +106,10 @@ Error image_decompress_squish(Image *p_image) {
     return OK;
 }
 
-void image_compress_squish(Image *p_image, float p_lossy_quality, ImageUsedChannels p_channels) {
+static Error image_compress_squish(Image *p_image, float p_lossy_quality, ImageUsedChannels p_channels, CompressProgress *p_progress) {
 
     if (p_image->get_format() >= Image::FORMAT_DXT1)
-        return; //do not compress, already compressed
+        return OK; //do not compress, already compressed
 
     int w = p_image->get_width();
     int h = p_image->get_height();
@@ -147,6 +176,8 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, ImageUsedChann
         PoolVector<uint8_t>::Write wb = data.write();
 
         int dst_ofs = 0;
+        uint32_t total_blocks = 0;
+        Vector<SquishRowTask> tasks;
 
         for (int i = 0; i <= mm_count; i++) {
 
@@ -154,25 +185,38 @@ void image_compress_squish(Image *p_image, float p_lossy_quality, ImageUsedChann
             int bh = h % 4 != 0 ? h + (4 - h % 4) : h;
 
             int src_ofs = p_image->get_mipmap_offset(i);
-            squish::CompressImage(&rb[src_ofs], w, h, &wb[dst_ofs], squish_comp);
+            int row_size = (M_MAX(4, bw) * 4) >> shift;
+            for (int y = 0; y < h; y += 4) {
+                tasks.push_back({ &rb[src_ofs + y * w * 4], &wb[dst_ofs + (y / 4) * row_size], w, MIN(4, h - y) });
+            }
+            total_blocks += (bw / 4) * (bh / 4);
             dst_ofs += (M_MAX(4, bw) * M_MAX(4, bh)) >> shift;
             w = M_MAX(w / 2, 1);
             h = M_MAX(h / 2, 1);
         }
 
+        if (p_progress) {
+            p_progress->blocks_total.store(total_blocks, std::memory_order_relaxed);
+        }
+        const SquishCompressJob job { tasks.data(), squish_comp, p_progress };
+        ThreadWorkPool::get_singleton()->do_work(tasks.size(), &job, &SquishCompressJob::compress_row, nullptr);
+
         rb.release();
         wb.release();
 
+        if (p_progress && p_progress->is_cancelled()) {
+            return ERR_SKIP;
+        }
         p_image->create(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
     }
+    return OK;
 }
 
 Error ResourceFormatS3TC::compress_image(Image *p_image, CompressParams params)
 {
     if(params.mode!=ImageCompressMode::COMPRESS_S3TC)
         return ERR_UNAVAILABLE;
-    image_compress_squish(p_image, params.p_quality, params.used_channels);
-    return OK;
+    return image_compress_squish(p_image, params.p_quality, params.used_channels, params.progress);
 }
 
 Error ResourceFormatS3TC::decompress_image(Image *image)
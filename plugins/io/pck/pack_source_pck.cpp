@@ -2,11 +2,16 @@
 
 #include "core/os/file_access.h"
 #include "core/string_formatter.h"
+#include "core/io/file_access_chunked.h"
 #include "core/io/file_access_pack.h"
+#include "core/io/marshalls.h"
 #include "core/version.h"
 
 #include <core/project_settings.h>
 
+#include <cstring>
+#include <zstd.h>
+
 class FileAccessPack : public FileAccess {
 
     PackedDataFile pf;
@@ -14,7 +19,9 @@ class FileAccessPack : public FileAccess {
     mutable size_t pos;
     mutable bool eof;
 
-    FileAccess *f;
+    FileAccess *f = nullptr;
+    // start of this file inside the mapped pack, reads bypass f entirely when set.
+    const uint8_t *mapped = nullptr;
     Error _open(StringView p_path, int p_mode_flags) override;
     uint64_t _get_modified_time(StringView p_file) override { return 0; }
     uint32_t _get_unix_permissions(StringView p_file) override { return 0; }
@@ -34,6 +41,7 @@ public:
     uint8_t get_8() const override;
 
     int get_buffer(uint8_t *p_dst, int p_length) const override;
+    const uint8_t *get_mapped_range(size_t p_offset, size_t p_length) const override;
 
     void set_endian_swap(bool p_swap) override;
 
@@ -46,7 +54,7 @@ public:
 
     bool file_exists(StringView p_name) override;
 
-    FileAccessPack(StringView p_path, const PackedDataFile &p_file);
+    FileAccessPack(StringView p_path, const PackedDataFile &p_file, const uint8_t *p_mapped_pack);
     ~FileAccessPack() override;
 };
 //////////////////////////////////////////////////////////////////
@@ -59,12 +67,16 @@ Error FileAccessPack::_open(StringView p_path, int p_mode_flags) {
 
 void FileAccessPack::close() {
 
-    f->close();
+    if (f)
+        f->close();
+    mapped = nullptr;
 }
 
 bool FileAccessPack::is_open() const {
 
-    return f->is_open();
+    if (mapped)
+        return true;
+    return f && f->is_open();
 }
 
 void FileAccessPack::seek(size_t p_position) {
@@ -75,7 +87,8 @@ void FileAccessPack::seek(size_t p_position) {
         eof = false;
     }
 
-    f->seek(pf.offset + p_position);
+    if (!mapped)
+        f->seek(pf.offset + p_position);
     pos = p_position;
 }
 void FileAccessPack::seek_end(int64_t p_position) {
@@ -102,6 +115,8 @@ uint8_t FileAccessPack::get_8() const {
         return 0;
     }
 
+    if (mapped)
+        return mapped[pos++];
     pos++;
     return f->get_8();
 }
@@ -117,18 +132,32 @@ int FileAccessPack::get_buffer(uint8_t *p_dst, int p_length) const {
         to_read = int64_t(pf.size) - int64_t(pos);
     }
 
-    pos += p_length;
-
-    if (to_read <= 0)
+    if (to_read <= 0) {
+        pos += p_length;
         return 0;
-    f->get_buffer(p_dst, to_read);
+    }
+    if (mapped)
+        memcpy(p_dst, mapped + pos, to_read);
+    else
+        f->get_buffer(p_dst, to_read);
+    pos += p_length;
 
     return to_read;
 }
 
+const uint8_t *FileAccessPack::get_mapped_range(size_t p_offset, size_t p_length) const {
+
+    if (p_offset > pf.size || p_length > pf.size - p_offset)
+        return nullptr;
+    if (mapped)
+        return mapped + p_offset;
+    return f ? f->get_mapped_range(pf.offset + p_offset, p_length) : nullptr;
+}
+
 void FileAccessPack::set_endian_swap(bool p_swap) {
     FileAccess::set_endian_swap(p_swap);
-    f->set_endian_swap(p_swap);
+    if (f)
+        f->set_endian_swap(p_swap);
 }
 
 Error FileAccessPack::get_error() const {
@@ -158,19 +187,24 @@ bool FileAccessPack::file_exists(StringView p_name) {
     return false;
 }
 
-FileAccessPack::FileAccessPack(StringView p_path, const PackedDataFile &p_file) :
-        pf(p_file),
-        f(FileAccess::open(pf.pack, FileAccess::READ)) {
+FileAccessPack::FileAccessPack(StringView p_path, const PackedDataFile &p_file, const uint8_t *p_mapped_pack) :
+        pf(p_file) {
 
+    pos = 0;
+    eof = false;
+    if (p_mapped_pack) {
+        mapped = p_mapped_pack + pf.offset;
+        return;
+    }
+    f = FileAccess::open(pf.pack, FileAccess::READ);
     ERR_FAIL_COND_MSG(!f, "Can't open pack-referenced file '" + pf.pack + "'.");
 
     f->seek(pf.offset);
-    pos = 0;
-    eof = false;
 }
 
 FileAccessPack::~FileAccessPack() {
-    memdelete(f);
+    if (f)
+        memdelete(f);
 }
 
 
@@ -228,22 +262,42 @@ bool PackedSourcePCK::try_open_pack(StringView p_path, bool p_replace_files, Str
         memdelete(f);
         ERR_FAIL_V_MSG(false, "Pack created with a newer version of the engine: " + itos(ver_major) + "." + itos(ver_minor) + ".");
     }
-    for (int i = 0; i < 16; i++) {
-        //reserved
-        f->get_32();
+    uint32_t reserved[16];
+    for (uint32_t &field : reserved) {
+        field = f->get_32();
     }
 
     int file_count = f->get_32();
 
-    for (int i = 0; i < file_count; i++) {
+    if (reserved[0] & PACK_FLAG_CHUNKED_FILES) {
+        const uint64_t entries_pos = f->get_position();
+        if (!_load_dictionary(f, p_path, uint64_t(reserved[3]) | (uint64_t(reserved[4]) << 32), reserved[5])) {
+            f->close();
+            memdelete(f);
+            ERR_FAIL_V_MSG(false, "Can't read the compression dictionary of pack '" + String(p_path) + "'.");
+        }
+        f->seek(entries_pos);
+    }
 
-        uint32_t sl = f->get_32();
-        CharString cs;
-        cs.resize(sl + 1);
-        f->get_buffer((uint8_t *)cs.data(), sl);
-        cs[sl] = 0;
+    // Mounting from the hash index skips parsing every entry, the index hashes are computed from the stored paths
+    // though, so packs remapped to another destination still take the slow path.
+    if ((reserved[0] & PACK_FLAG_HASH_INDEX) && p_destination.empty()) {
+        const uint64_t entries_pos = f->get_position();
+        const uint64_t index_pos = uint64_t(reserved[1]) | (uint64_t(reserved[2]) << 32);
+        f->seek(index_pos);
+        if (int(f->get_32()) == file_count && _add_indexed_files(f, p_path, file_count, entries_pos, p_replace_files)) {
+            f->close();
+            memdelete(f);
+            _map_pack(p_path);
+            return true;
+        }
+        WARN_PRINT("Pack hash index of '" + String(p_path) + "' is inconsistent, reading the full file table.");
+        f->seek(entries_pos);
+    }
+
+    for (int i = 0; i < file_count; i++) {
 
-        String path(cs.data());
+        String path = _read_entry_path(f);
         if ( !p_destination.empty()) {
             String destination = ProjectSettings::get_singleton()->localize_path(p_destination);
             ERR_FAIL_COND_V_MSG(!destination.starts_with("res://"), false, "The destination path must be within the resource filesystem (res://).");
@@ -271,11 +325,122 @@ bool PackedSourcePCK::try_open_pack(StringView p_path, bool p_replace_files, Str
 
     f->close();
     memdelete(f);
+
+    _map_pack(p_path);
+    return true;
+}
+
+String PackedSourcePCK::_read_entry_path(FileAccess *f) {
+
+    uint32_t sl = f->get_32();
+    CharString cs;
+    cs.resize(sl + 1);
+    f->get_buffer((uint8_t *)cs.data(), sl);
+    cs[sl] = 0;
+    return String(cs.data());
+}
+
+bool PackedSourcePCK::_add_indexed_files(FileAccess *f, StringView p_path, int p_file_count, uint64_t p_entries_pos, bool p_replace_files) {
+
+    PackedData *pd = PackedData::get_singleton();
+    Vector<uint8_t> index;
+    index.resize(size_t(p_file_count) * PACK_HASH_INDEX_ENTRY_SIZE);
+    if (f->get_buffer(index.data(), index.size()) != int(index.size()))
+        return false;
+
+    pd->reserve_files(p_file_count);
+    const uint8_t *entry = index.data();
+    for (int i = 0; i < p_file_count; i++, entry += PACK_HASH_INDEX_ENTRY_SIZE) {
+        pd->add_indexed_path(p_path, decode_uint64(entry), decode_uint64(entry + 8), decode_uint64(entry + 16), entry + 24, this, p_replace_files);
+    }
+
+    // Directory listings still need the paths, they are read only once something lists the packed filesystem.
+    String pack_path(p_path);
+    pd->add_deferred_paths([pack_path, p_entries_pos, p_file_count]() {
+        FileAccess *pf = FileAccess::open(pack_path, FileAccess::READ);
+        ERR_FAIL_COND_MSG(!pf, "Can't reopen pack '" + pack_path + "' to read its paths.");
+        pf->seek(p_entries_pos);
+        for (int i = 0; i < p_file_count; i++) {
+            String path = _read_entry_path(pf);
+            pf->seek(pf->get_position() + 32); // offset, size and md5
+            PackedData::get_singleton()->add_directory_path(path);
+        }
+        pf->close();
+        memdelete(pf);
+    });
     return true;
 }
 
+void PackedSourcePCK::_map_pack(StringView p_path) {
+
+    // Map the pack once, files opened from it then read straight from the mapping instead of each opening
+    // and seeking their own handle.
+    String pack_path(p_path);
+    if (!mapped_packs.contains(pack_path)) {
+        FileAccess *mf = FileAccess::open_mapped(pack_path);
+        if (mf && mf->get_mapped_range(0, mf->get_len())) {
+            mapped_packs[pack_path] = mf;
+        } else if (mf) {
+            memdelete(mf);
+        }
+    }
+}
+
+bool PackedSourcePCK::_load_dictionary(FileAccess *f, StringView p_path, uint64_t p_dictionary_pos, uint32_t p_dictionary_size) {
+
+    ZSTD_DDict *ddict = nullptr;
+    if (p_dictionary_size > 0) {
+        Vector<uint8_t> dictionary;
+        dictionary.resize(p_dictionary_size);
+        f->seek(p_dictionary_pos);
+        if (f->get_buffer(dictionary.data(), p_dictionary_size) != int(p_dictionary_size))
+            return false;
+        ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (!ddict)
+            return false;
+    }
+    String pack_path(p_path);
+    auto iter = chunked_packs.find(pack_path);
+    if (iter != chunked_packs.end() && iter->second) {
+        ZSTD_freeDDict(iter->second);
+    }
+    chunked_packs[pack_path] = ddict;
+    return true;
+}
 
 FileAccess *PackedSourcePCK::get_file(StringView p_path, PackedDataFile *p_file) {
 
-    return memnew_basic(FileAccessPack(p_path, *p_file));
+    const uint8_t *mapped_pack = nullptr;
+    auto iter = mapped_packs.find(p_file->pack);
+    if (iter != mapped_packs.end()) {
+        mapped_pack = iter->second->get_mapped_range(0, iter->second->get_len());
+    }
+
+    auto chunked = chunked_packs.find(p_file->pack);
+    if (chunked == chunked_packs.end()) {
+        return memnew_basic(FileAccessPack(p_path, *p_file, mapped_pack));
+    }
+
+    FileAccess *container = nullptr;
+    if (!mapped_pack) {
+        container = FileAccess::open(p_file->pack, FileAccess::READ);
+        ERR_FAIL_COND_V_MSG(!container, nullptr, "Can't open pack-referenced file '" + p_file->pack + "'.");
+    }
+    FileAccessChunked *fa = memnew(FileAccessChunked);
+    Error err = fa->open_blob(mapped_pack ? mapped_pack + p_file->offset : nullptr, container, p_file->offset, p_file->size, chunked->second);
+    if (err != OK) {
+        memdelete(fa);
+        ERR_FAIL_V_MSG(nullptr, "Corrupt compressed file '" + String(p_path) + "' in pack '" + p_file->pack + "'.");
+    }
+    return fa;
+}
+
+PackedSourcePCK::~PackedSourcePCK() {
+    for (auto &entry : mapped_packs) {
+        memdelete(entry.second);
+    }
+    for (auto &entry : chunked_packs) {
+        if (entry.second)
+            ZSTD_freeDDict(entry.second);
+    }
 }
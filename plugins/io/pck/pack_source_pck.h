@@ -1,12 +1,27 @@
 #pragma once
 
 #include "core/plugin_interfaces/PluginDeclarations.h"
+#include "core/hash_map.h"
+#include "core/string.h"
+
+struct ZSTD_DDict_s;
 
 class PackedSourcePCK : public QObject, public PackSourceInterface {
     Q_PLUGIN_METADATA(IID "org.segs_engine.PackSourcePCK")
     Q_INTERFACES(PackSourceInterface)
     Q_OBJECT
+    // whole-pack mappings shared by every file opened from that pack, keyed by pack path.
+    HashMap<String, FileAccess *> mapped_packs;
+    // packs storing chunked compressed files, with their shared dictionary (nullptr when they have none).
+    HashMap<String, ZSTD_DDict_s *> chunked_packs;
+
+    static String _read_entry_path(FileAccess *f);
+    bool _add_indexed_files(FileAccess *f, StringView p_path, int p_file_count, uint64_t p_entries_pos, bool p_replace_files);
+    void _map_pack(StringView p_path);
+    bool _load_dictionary(FileAccess *f, StringView p_path, uint64_t p_dictionary_pos, uint32_t p_dictionary_size);
+
 public:
     bool try_open_pack(StringView p_path, bool p_replace_files, StringView p_destination="") override;
     FileAccess *get_file(StringView p_path, PackedDataFile *p_file) override;
+    ~PackedSourcePCK() override;
 };
@@ -37,14 +37,19 @@
 #include "core/io/marshalls.h"
 #include "core/object_tooling.h"
 #include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/print_string.h"
 #include "core/translation_helpers.h"
 #include "scene/2d/area_2d.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/rectangle_shape_2d.h"
+#include "scene/resources/texture.h"
 #include "scene/resources/world_2d.h"
 #include "servers/navigation_2d_server.h"
 #include "servers/physics_server_2d.h"
 
+#include "EASTL/sort.h"
+
 IMPL_GDCLASS(TileMap)
 VARIANT_ENUM_CAST(TileMap::Mode);
 VARIANT_ENUM_CAST(TileMap::HalfOffset);
@@ -242,7 +247,7 @@ int TileMap::get_quadrant_size() const {
     return quadrant_size;
 }
 
-void TileMap::_fix_cell_transform(Transform2D &xform, const Cell &p_cell, const Vector2 &p_offset, const Size2 &p_sc) {
+void TileMap::_fix_cell_transform(Transform2D &xform, const Cell &p_cell, const Vector2 &p_offset, const Size2 &p_sc) const {
 
     Size2 s = p_sc;
     Vector2 offset = p_offset;
@@ -309,13 +314,13 @@ void TileMap::_fix_cell_transform(Transform2D &xform, const Cell &p_cell, const
     xform.elements[2] += offset;
 }
 
-void TileMap::_add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, const Vector2 &p_metadata) {
+void TileMap::_add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, bool p_one_way, float p_one_way_margin, const Transform2D &p_xform, const Vector2 &p_metadata) {
     PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
 
     if (!use_parent) {
         ps->body_add_shape(p_q.body, p_shape->get_rid(), p_xform);
         ps->body_set_shape_metadata(p_q.body, shape_idx, p_metadata);
-        ps->body_set_shape_as_one_way_collision(p_q.body, shape_idx, p_shape_data.one_way_collision, p_shape_data.one_way_collision_margin);
+        ps->body_set_shape_as_one_way_collision(p_q.body, shape_idx, p_one_way, p_one_way_margin);
 
     } else if (collision_parent) {
         Transform2D xform = p_xform;
@@ -331,375 +336,668 @@ void TileMap::_add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D>
         } else {
             ps->body_set_shape_transform(rid, real_index, get_transform() * xform);
             ps->body_set_shape_metadata(rid, real_index, p_metadata);
-            ps->body_set_shape_as_one_way_collision(rid, real_index, p_shape_data.one_way_collision, p_shape_data.one_way_collision_margin);
+            ps->body_set_shape_as_one_way_collision(rid, real_index, p_one_way, p_one_way_margin);
         }
     }
     shape_idx++;
 }
 
-void TileMap::update_dirty_quadrants() {
+//! Everything a quadrant update sends to the servers. It is computed without calling them, so several
+//! quadrants can be baked on the worker pool before the results are submitted from the main thread.
+struct TileMap::QuadrantBake {
+
+    //! One draw command: all tiles sharing a texture merged into a single triangle array, or one rect for tiles
+    //! that need UV clipping.
+    struct Batch {
+        RID texture;
+        RID normal_map;
+        Rect2 bounds;
+        Vector<Point2> points;
+        Vector<Point2> uvs;
+        Vector<Color> colors;
+        Vector<int> indices;
+
+        Ref<Texture> rect_texture;
+        Ref<Texture> rect_normal_map;
+        Rect2 rect;
+        Rect2 src_rect;
+        Color modulate;
+        bool transpose = false;
+    };
+
+    //! Tiles sharing material and z index, drawn by one canvas item.
+    struct Item {
+        // batches further back than this are not searched for a matching texture
+        static constexpr int MAX_BATCH_LOOKBACK = 8;
+
+        Ref<ShaderMaterial> material;
+        int z_index = 0;
+        Vector<Batch> batches;
+
+        //! Appends a tile to the last batch drawing the same textures. A tile still has to be drawn after every
+        //! tile it overlaps, so a later batch overlapping it forces a new batch.
+        void add_tile(const Ref<Texture> &p_texture, const Ref<Texture> &p_normal_map, const Rect2 &p_rect, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose) {
+
+            Rect2 dr;
+            Rect2 src;
+            if (!p_texture->get_rect_region(p_rect, p_src_rect, dr, src))
+                return;
+
+            Ref<AtlasTexture> atlas = dynamic_ref_cast<AtlasTexture>(p_texture);
+            const Size2 tex_size = atlas ? atlas->get_atlas()->get_size() : p_texture->get_size();
+            if (tex_size.x <= 0 || tex_size.y <= 0)
+                return;
+
+            const RID texture = p_texture->get_rid();
+            const RID normal_map = p_normal_map ? p_normal_map->get_rid() : RID();
+
+            // same conventions as canvas_item_add_texture_rect_region: negative sizes flip, transposing swaps the size
+            Size2 size = dr.size.abs();
+            if (p_transpose)
+                SWAP(size.x, size.y);
+            const Rect2 bounds(dr.position, size);
+
+            int target = -1;
+            const int search_end = M_MAX(0, int(batches.size()) - MAX_BATCH_LOOKBACK);
+            for (int i = int(batches.size()) - 1; i >= search_end; i--) {
+                const Batch &b = batches[i];
+                if (!b.rect_texture && b.texture == texture && b.normal_map == normal_map) {
+                    target = i;
+                    break;
+                }
+                if (b.bounds.intersects(bounds))
+                    break;
+            }
 
-    if (!pending_update)
-        return;
-    if (!is_inside_tree() || not tile_set) {
-        pending_update = false;
-        return;
-    }
+            if (target < 0) {
+                target = batches.size();
+                batches.emplace_back();
+                batches[target].texture = texture;
+                batches[target].normal_map = normal_map;
+                batches[target].bounds = bounds;
+            }
+            Batch &b = batches[target];
+            b.bounds = b.bounds.merge(bounds);
+
+            const Point2 end = bounds.position + bounds.size;
+            const Point2 uv_begin = src.position / tex_size;
+            const Point2 uv_end = (src.position + src.size) / tex_size;
+            Point2 uvs[4] = { uv_begin, Point2(uv_end.x, uv_begin.y), uv_end, Point2(uv_begin.x, uv_end.y) };
+            if (p_transpose) {
+                SWAP(uvs[1], uvs[3]);
+            }
+            if (dr.size.x < 0) {
+                SWAP(uvs[0], uvs[1]);
+                SWAP(uvs[2], uvs[3]);
+            }
+            if (dr.size.y < 0) {
+                SWAP(uvs[0], uvs[3]);
+                SWAP(uvs[1], uvs[2]);
+            }
 
-    RenderingServer *vs = RenderingServer::get_singleton();
-    PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
-    Vector2 tofs = get_cell_draw_offset();
-    Transform2D nav_rel;
-    if (navigation)
-        nav_rel = get_relative_transform_to_parent(navigation);
+            const int base = b.points.size();
+            b.points.push_back(bounds.position);
+            b.points.push_back(Point2(end.x, bounds.position.y));
+            b.points.push_back(end);
+            b.points.push_back(Point2(bounds.position.x, end.y));
+            for (int i = 0; i < 4; i++) {
+                b.uvs.push_back(uvs[i]);
+                b.colors.push_back(p_modulate);
+            }
+            const int quad[6] = { 0, 1, 2, 0, 2, 3 };
+            for (int i : quad) {
+                b.indices.push_back(base + i);
+            }
+        }
+    };
 
-    SceneTree *st = SceneTree::get_singleton();
-    Color debug_collision_color;
-    Color debug_navigation_color;
+    struct Shape {
+        Ref<Shape2D> shape;
+        Transform2D xform;
+        Vector2 metadata;
+        bool one_way_collision;
+        float one_way_collision_margin;
+    };
 
-    bool debug_shapes = st && st->is_debugging_collisions_hint();
-    if (debug_shapes) {
-        debug_collision_color = st->get_debug_collisions_color();
-    }
+    struct DebugShape {
+        Ref<Shape2D> shape;
+        Transform2D xform;
+        int item;
+    };
 
-    bool debug_navigation = st && st->is_debugging_navigation_hint();
-    if (debug_navigation) {
-        debug_navigation_color = st->get_debug_navigation_color();
+    struct NavPoly {
+        PosKey cell;
+        Ref<NavigationPolygon> navpoly;
+        Transform2D xform;
+        Transform2D local_xform;
+        int item;
+    };
+
+    struct Occluder {
+        PosKey cell;
+        Ref<OccluderPolygon2D> occluder;
+        Transform2D xform;
+    };
+
+    Vector<Item> items;
+    Vector<Shape> shapes;
+    Vector<DebugShape> debug_shapes;
+    // axis aligned rectangle shapes, coalesced before they are added
+    Vector<Rect2> rects;
+    Vector<Vector2> rect_metadata;
+    Vector<NavPoly> navpolys;
+    Vector<Occluder> occluders;
+};
+
+struct TileMap::QuadrantBakeBatch {
+    Vector<Quadrant *> quadrants;
+    Vector<QuadrantBake> bakes;
+    Vector2 tofs;
+    Color self_modulate;
+    bool debug_shapes;
+};
+
+namespace {
+//! Merges touching rectangles of equal height along x, then touching rectangles of equal width along y.
+//! Merged rectangles keep the metadata of their first rectangle.
+void coalesce_rects(Vector<Rect2> &r_rects, Vector<Vector2> &r_metadata) {
+
+    for (int axis = 0; axis < 2; axis++) {
+        const int other = 1 - axis;
+
+        Vector<int> order;
+        order.resize(r_rects.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        eastl::sort(order.begin(), order.end(), [&](int a, int b) {
+            const Rect2 &ra = r_rects[a];
+            const Rect2 &rb = r_rects[b];
+            if (ra.position[other] != rb.position[other])
+                return ra.position[other] < rb.position[other];
+            if (ra.size[other] != rb.size[other])
+                return ra.size[other] < rb.size[other];
+            return ra.position[axis] < rb.position[axis];
+        });
+
+        Vector<Rect2> rects;
+        Vector<Vector2> metadata;
+        rects.reserve(r_rects.size());
+        metadata.reserve(r_rects.size());
+        for (int idx : order) {
+            const Rect2 &r = r_rects[idx];
+            if (!rects.empty()) {
+                Rect2 &last = rects.back();
+                if (last.position[other] == r.position[other] && last.size[other] == r.size[other] && last.position[axis] + last.size[axis] == r.position[axis]) {
+                    last.size[axis] += r.size[axis];
+                    continue;
+                }
+            }
+            rects.push_back(r);
+            metadata.push_back(r_metadata[idx]);
+        }
+        r_rects = eastl::move(rects);
+        r_metadata = eastl::move(metadata);
     }
+}
+} // end of anonymous namespace
 
-    while (dirty_quadrant_list.first()) {
+void TileMap::_bake_quadrant(const Quadrant &q, QuadrantBake &r_bake, const Vector2 &p_tofs, const Color &p_self_modulate, bool p_debug_shapes) const {
 
-        Quadrant &q = *dirty_quadrant_list.first()->self();
+    Ref<ShaderMaterial> prev_material;
+    int prev_z_index = 0;
+    int item = -1;
 
-        for (RID E : q.canvas_items) {
+    for (const PosKey &pk : q.cells) {
 
-            vs->free_rid(E);
+        auto E = tile_map.find(pk);
+        const Cell &c = E->second;
+        //moment of truth
+        if (!tile_set->has_tile(c.id))
+            continue;
+        Ref<Texture> tex = tile_set->tile_get_texture(c.id);
+        Vector2 tile_ofs = tile_set->tile_get_texture_offset(c.id);
+
+        Vector2 wofs = _map_to_world(E->first.x, E->first.y);
+        Vector2 offset = wofs - q.pos + p_tofs;
+
+        if (not tex)
+            continue;
+
+        Ref<ShaderMaterial> mat = tile_set->tile_get_material(c.id);
+        int z_index = tile_set->tile_get_z_index(c.id);
+
+        if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE ||
+                tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
+            z_index += tile_set->autotile_get_z_index(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
         }
 
-        q.canvas_items.clear();
+        if (item < 0 || prev_material != mat || prev_z_index != z_index) {
 
-        if (!use_parent) {
-            ps->body_clear_shapes(q.body);
-        } else if (collision_parent) {
-            collision_parent->shape_owner_clear_shapes(q.shape_owner_id);
+            item = r_bake.items.size();
+            r_bake.items.emplace_back();
+            r_bake.items[item].material = mat;
+            r_bake.items[item].z_index = z_index;
+
+            prev_material = mat;
+            prev_z_index = z_index;
         }
-        int shape_idx = 0;
 
-        if (navigation) {
-            for (eastl::pair<const PosKey,Quadrant::NavPoly> &E : q.navpoly_ids) {
+        Rect2 r = tile_set->tile_get_region(c.id);
+        if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
+            int spacing = tile_set->autotile_get_spacing(c.id);
+            r.size = tile_set->autotile_get_size(c.id);
+            r.position += (r.size + Vector2(spacing, spacing)) * Vector2(c.autotile_coord_x, c.autotile_coord_y);
+        }
+
+        Size2 s;
+        if (r == Rect2())
+            s = tex->get_size();
+        else
+            s = r.size;
+
+        Rect2 rect;
+        rect.position = offset.floor();
+        rect.size = s;
+        rect.size.x += fp_adjust;
+        rect.size.y += fp_adjust;
 
-                Navigation2DServer::get_singleton()->region_set_map(E.second.region, RID());
+        if (compatibility_mode && !centered_textures) {
+            if (rect.size.y > rect.size.x) {
+                if ((c.flip_h && (c.flip_v || c.transpose)) || (c.flip_v && !c.transpose))
+                    tile_ofs.y += rect.size.y - rect.size.x;
+            } else if (rect.size.y < rect.size.x) {
+                if ((c.flip_v && (c.flip_h || c.transpose)) || (c.flip_h && !c.transpose))
+                    tile_ofs.x += rect.size.x - rect.size.y;
             }
-            q.navpoly_ids.clear();
         }
 
-        for (eastl::pair<const PosKey,Quadrant::Occluder> &E : q.occluder_instances) {
-            RenderingServer::get_singleton()->free_rid(E.second.id);
-        }
-        q.occluder_instances.clear();
-        Ref<ShaderMaterial> prev_material;
-        int prev_z_index = 0;
-        RID prev_canvas_item;
-        RID prev_debug_canvas_item;
-
-        for (const PosKey &pk : q.cells) {
-
-            HashMap<PosKey, Cell>::iterator E = tile_map.find(pk);
-            Cell &c = E->second;
-            //moment of truth
-            if (!tile_set->has_tile(c.id))
-                continue;
-            Ref<Texture> tex = tile_set->tile_get_texture(c.id);
-            Vector2 tile_ofs = tile_set->tile_get_texture_offset(c.id);
-
-            Vector2 wofs = _map_to_world(E->first.x, E->first.y);
-            Vector2 offset = wofs - q.pos + tofs;
-
-            if (not tex)
-                continue;
-
-            Ref<ShaderMaterial> mat = tile_set->tile_get_material(c.id);
-            int z_index = tile_set->tile_get_z_index(c.id);
-
-            if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE ||
-                    tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
-                z_index += tile_set->autotile_get_z_index(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
+        if (c.transpose) {
+            SWAP(tile_ofs.x, tile_ofs.y);
+            if (centered_textures) {
+                rect.position.x += cell_size.x / 2 - rect.size.y / 2;
+                rect.position.y += cell_size.y / 2 - rect.size.x / 2;
             }
+        } else if (centered_textures) {
+            rect.position += cell_size / 2 - rect.size / 2;
+        }
 
-            RID canvas_item;
-            RID debug_canvas_item;
+        if (c.flip_h) {
+            rect.size.x = -rect.size.x;
+            tile_ofs.x = -tile_ofs.x;
+        }
 
-            if (prev_canvas_item == RID() || prev_material != mat || prev_z_index != z_index) {
+        if (c.flip_v) {
+            rect.size.y = -rect.size.y;
+            tile_ofs.y = -tile_ofs.y;
+        }
 
-                canvas_item = vs->canvas_item_create();
-                if (mat)
-                    vs->canvas_item_set_material(canvas_item, mat->get_rid());
-                vs->canvas_item_set_parent(canvas_item, get_canvas_item());
-                _update_item_material_state(canvas_item);
-                Transform2D xform;
-                xform.set_origin(q.pos);
-                vs->canvas_item_set_transform(canvas_item, xform);
-                vs->canvas_item_set_light_mask(canvas_item, get_light_mask());
-                vs->canvas_item_set_z_index(canvas_item, z_index);
+        if (compatibility_mode && !centered_textures) {
+            if (tile_origin == TILE_ORIGIN_TOP_LEFT) {
+                rect.position += tile_ofs;
 
-                q.canvas_items.push_back(canvas_item);
+            } else if (tile_origin == TILE_ORIGIN_BOTTOM_LEFT) {
 
-                if (debug_shapes) {
+                rect.position += tile_ofs;
 
-                    debug_canvas_item = vs->canvas_item_create();
-                    vs->canvas_item_set_parent(debug_canvas_item, canvas_item);
-                    vs->canvas_item_set_z_as_relative_to_parent(debug_canvas_item, false);
-                    vs->canvas_item_set_z_index(debug_canvas_item, RS::CANVAS_ITEM_Z_MAX - 1);
-                    q.canvas_items.push_back(debug_canvas_item);
-                    prev_debug_canvas_item = debug_canvas_item;
+                if (c.transpose) {
+                    if (c.flip_h)
+                        rect.position.x -= cell_size.x;
+                    else
+                        rect.position.x += cell_size.x;
+                } else {
+                    if (c.flip_v)
+                        rect.position.y -= cell_size.y;
+                    else
+                        rect.position.y += cell_size.y;
                 }
 
-                prev_canvas_item = canvas_item;
-                prev_material = mat;
-                prev_z_index = z_index;
+            } else if (tile_origin == TILE_ORIGIN_CENTER) {
 
-            } else {
-                canvas_item = prev_canvas_item;
-                if (debug_shapes) {
-                    debug_canvas_item = prev_debug_canvas_item;
-                }
-            }
+                rect.position += tile_ofs;
 
-            Rect2 r = tile_set->tile_get_region(c.id);
-            if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
-                int spacing = tile_set->autotile_get_spacing(c.id);
-                r.size = tile_set->autotile_get_size(c.id);
-                r.position += (r.size + Vector2(spacing, spacing)) * Vector2(c.autotile_coord_x, c.autotile_coord_y);
-            }
+                if (c.flip_h)
+                    rect.position.x -= cell_size.x / 2;
+                else
+                    rect.position.x += cell_size.x / 2;
 
-            Size2 s;
-            if (r == Rect2())
-                s = tex->get_size();
-            else
-                s = r.size;
-
-            Rect2 rect;
-            rect.position = offset.floor();
-            rect.size = s;
-            rect.size.x += fp_adjust;
-            rect.size.y += fp_adjust;
-
-            if (compatibility_mode && !centered_textures) {
-                if (rect.size.y > rect.size.x) {
-                    if ((c.flip_h && (c.flip_v || c.transpose)) || (c.flip_v && !c.transpose))
-                        tile_ofs.y += rect.size.y - rect.size.x;
-                } else if (rect.size.y < rect.size.x) {
-                    if ((c.flip_v && (c.flip_h || c.transpose)) || (c.flip_h && !c.transpose))
-                        tile_ofs.x += rect.size.x - rect.size.y;
-                }
+                if (c.flip_v)
+                    rect.position.y -= cell_size.y / 2;
+                else
+                    rect.position.y += cell_size.y / 2;
             }
+        } else {
+            rect.position += tile_ofs;
+        }
+
+        Ref<Texture> normal_map = tile_set->tile_get_normal_map(c.id);
+        Color modulate = tile_set->tile_get_modulate(c.id);
+        modulate = Color(modulate.r * p_self_modulate.r, modulate.g * p_self_modulate.g,
+                modulate.b * p_self_modulate.b, modulate.a * p_self_modulate.a);
+
+        QuadrantBake::Item &bake_item = r_bake.items[item];
+        if (clip_uv && r != Rect2()) {
+            // UV clipping is done by the rect shader, these tiles are drawn one by one
+            QuadrantBake::Batch b;
+            b.rect_texture = tex;
+            b.rect_normal_map = normal_map;
+            b.rect = rect;
+            b.src_rect = r;
+            b.modulate = modulate;
+            b.transpose = c.transpose;
+            b.bounds = rect.abs();
+            if (c.transpose)
+                SWAP(b.bounds.size.x, b.bounds.size.y);
+            bake_item.batches.emplace_back(eastl::move(b));
+        } else {
+            bake_item.add_tile(tex, normal_map, rect, r == Rect2() ? Rect2(Vector2(), tex->get_size()) : r, modulate, c.transpose);
+        }
+
+        const Vector<TileSet::ShapeData> &shapes = tile_set->tile_get_shapes(c.id);
+
+        for (int j = 0; j < shapes.size(); j++) {
+            Ref<Shape2D> shape = shapes[j].shape;
+            if (shape) {
+                if (tile_set->tile_get_tile_mode(c.id) == TileSet::SINGLE_TILE || (shapes[j].autotile_coord.x == c.autotile_coord_x && shapes[j].autotile_coord.y == c.autotile_coord_y)) {
+                    Transform2D xform;
+                    xform.set_origin(offset.floor());
+
+                    Vector2 shape_ofs = shapes[j].shape_transform.get_origin();
 
-            if (c.transpose) {
-                SWAP(tile_ofs.x, tile_ofs.y);
-                if (centered_textures) {
-                    rect.position.x += cell_size.x / 2 - rect.size.y / 2;
-                    rect.position.y += cell_size.y / 2 - rect.size.x / 2;
+                    _fix_cell_transform(xform, c, shape_ofs, s);
+
+                    xform *= shapes[j].shape_transform.untranslated();
+
+                    if (p_debug_shapes) {
+                        r_bake.debug_shapes.push_back({ shape, xform, item });
+                    }
+
+                    if (shape->has_meta("decomposed")) {
+                        Array _shapes = shape->get_meta("decomposed").as<Array>();
+                        for (int k = 0; k < _shapes.size(); k++) {
+                            Ref<ConvexPolygonShape2D> convex = refFromVariant<ConvexPolygonShape2D>(_shapes[k]);
+                            if (convex) {
+                                r_bake.shapes.push_back({ convex, xform, Vector2(E->first.x, E->first.y), shapes[j].one_way_collision, shapes[j].one_way_collision_margin });
+#ifdef DEBUG_ENABLED
+                            } else {
+                                print_error(String("The TileSet assigned to the TileMap ") + get_name() + " has an invalid convex shape.");
+#endif
+                            }
+                        }
+                        continue;
+                    }
+
+                    Ref<RectangleShape2D> rect_shape = dynamic_ref_cast<RectangleShape2D>(shape);
+                    if (merge_rectangles && rect_shape && !shapes[j].one_way_collision &&
+                            Math::is_zero_approx(xform.elements[0].y) && Math::is_zero_approx(xform.elements[1].x)) {
+                        const Vector2 extents = rect_shape->get_extents();
+                        r_bake.rects.push_back(xform.xform(Rect2(-extents, extents * 2)));
+                        r_bake.rect_metadata.push_back(Vector2(E->first.x, E->first.y));
+                    } else {
+                        r_bake.shapes.push_back({ shape, xform, Vector2(E->first.x, E->first.y), shapes[j].one_way_collision, shapes[j].one_way_collision_margin });
+                    }
                 }
-            } else if (centered_textures) {
-                rect.position += cell_size / 2 - rect.size / 2;
             }
+        }
 
-            if (c.flip_h) {
-                rect.size.x = -rect.size.x;
-                tile_ofs.x = -tile_ofs.x;
+        if (navigation) {
+            Ref<NavigationPolygon> navpoly;
+            Vector2 npoly_ofs;
+            if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
+                navpoly = tile_set->autotile_get_navigation_polygon(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
+                npoly_ofs = Vector2();
+            } else {
+                navpoly = tile_set->tile_get_navigation_polygon(c.id);
+                npoly_ofs = tile_set->tile_get_navigation_polygon_offset(c.id);
             }
 
-            if (c.flip_v) {
-                rect.size.y = -rect.size.y;
-                tile_ofs.y = -tile_ofs.y;
+            if (navpoly) {
+                QuadrantBake::NavPoly np;
+                np.cell = E->first;
+                np.navpoly = navpoly;
+                np.xform.set_origin(offset.floor() + q.pos);
+                _fix_cell_transform(np.xform, c, npoly_ofs, s);
+                np.local_xform.set_origin(offset.floor());
+                _fix_cell_transform(np.local_xform, c, npoly_ofs, s);
+                np.item = item;
+                r_bake.navpolys.emplace_back(eastl::move(np));
             }
+        }
 
-            if (compatibility_mode && !centered_textures) {
-                if (tile_origin == TILE_ORIGIN_TOP_LEFT) {
-                    rect.position += tile_ofs;
+        Ref<OccluderPolygon2D> occluder;
+        if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
+            occluder = tile_set->autotile_get_light_occluder(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
+        } else {
+            occluder = tile_set->tile_get_light_occluder(c.id);
+        }
+        if (occluder) {
+            Vector2 occluder_ofs = tile_set->tile_get_occluder_offset(c.id);
+            QuadrantBake::Occluder oc;
+            oc.cell = E->first;
+            oc.occluder = occluder;
+            oc.xform.set_origin(offset.floor() + q.pos);
+            _fix_cell_transform(oc.xform, c, occluder_ofs, s);
+            r_bake.occluders.emplace_back(eastl::move(oc));
+        }
+    }
 
-                } else if (tile_origin == TILE_ORIGIN_BOTTOM_LEFT) {
+    if (r_bake.rects.size() > 1) {
+        coalesce_rects(r_bake.rects, r_bake.rect_metadata);
+    }
+}
 
-                    rect.position += tile_ofs;
+void TileMap::_bake_quadrant_threaded(uint32_t p_index, QuadrantBakeBatch *p_batch) {
 
-                    if (c.transpose) {
-                        if (c.flip_h)
-                            rect.position.x -= cell_size.x;
-                        else
-                            rect.position.x += cell_size.x;
-                    } else {
-                        if (c.flip_v)
-                            rect.position.y -= cell_size.y;
-                        else
-                            rect.position.y += cell_size.y;
-                    }
+    _bake_quadrant(*p_batch->quadrants[p_index], p_batch->bakes[p_index], p_batch->tofs, p_batch->self_modulate, p_batch->debug_shapes);
+}
 
-                } else if (tile_origin == TILE_ORIGIN_CENTER) {
+void TileMap::_commit_quadrant(Quadrant &q, QuadrantBake &p_bake) {
 
-                    rect.position += tile_ofs;
+    RenderingServer *vs = RenderingServer::get_singleton();
+    PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+    Transform2D nav_rel;
+    if (navigation)
+        nav_rel = get_relative_transform_to_parent(navigation);
 
-                    if (c.flip_h)
-                        rect.position.x -= cell_size.x / 2;
-                    else
-                        rect.position.x += cell_size.x / 2;
+    SceneTree *st = SceneTree::get_singleton();
+    Color debug_collision_color;
+    Color debug_navigation_color;
 
-                    if (c.flip_v)
-                        rect.position.y -= cell_size.y / 2;
-                    else
-                        rect.position.y += cell_size.y / 2;
-                }
-            } else {
-                rect.position += tile_ofs;
-            }
+    bool debug_shapes = st && st->is_debugging_collisions_hint();
+    if (debug_shapes) {
+        debug_collision_color = st->get_debug_collisions_color();
+    }
+
+    bool debug_navigation = st && st->is_debugging_navigation_hint();
+    if (debug_navigation) {
+        debug_navigation_color = st->get_debug_navigation_color();
+    }
+
+    for (RID E : q.canvas_items) {
+
+        vs->free_rid(E);
+    }
+
+    q.canvas_items.clear();
+
+    if (!use_parent) {
+        ps->body_clear_shapes(q.body);
+    } else if (collision_parent) {
+        collision_parent->shape_owner_clear_shapes(q.shape_owner_id);
+    }
+    q.merged_shapes.clear();
+    int shape_idx = 0;
+
+    if (navigation) {
+        for (eastl::pair<const PosKey,Quadrant::NavPoly> &E : q.navpoly_ids) {
 
-            Ref<Texture> normal_map = tile_set->tile_get_normal_map(c.id);
-            Color modulate = tile_set->tile_get_modulate(c.id);
-            Color self_modulate = get_self_modulate();
-            modulate = Color(modulate.r * self_modulate.r, modulate.g * self_modulate.g,
-                    modulate.b * self_modulate.b, modulate.a * self_modulate.a);
-            if (r == Rect2()) {
-                tex->draw_rect(canvas_item, rect, false, modulate, c.transpose, normal_map);
+            Navigation2DServer::get_singleton()->region_set_map(E.second.region, RID());
+        }
+        q.navpoly_ids.clear();
+    }
+
+    for (eastl::pair<const PosKey,Quadrant::Occluder> &E : q.occluder_instances) {
+        RenderingServer::get_singleton()->free_rid(E.second.id);
+    }
+    q.occluder_instances.clear();
+
+    Vector<RID> item_rids;
+    Vector<RID> debug_item_rids;
+    item_rids.reserve(p_bake.items.size());
+
+    for (QuadrantBake::Item &item : p_bake.items) {
+
+        RID canvas_item = vs->canvas_item_create();
+        if (item.material)
+            vs->canvas_item_set_material(canvas_item, item.material->get_rid());
+        vs->canvas_item_set_parent(canvas_item, get_canvas_item());
+        _update_item_material_state(canvas_item);
+        Transform2D xform;
+        xform.set_origin(q.pos);
+        vs->canvas_item_set_transform(canvas_item, xform);
+        vs->canvas_item_set_light_mask(canvas_item, get_light_mask());
+        vs->canvas_item_set_z_index(canvas_item, item.z_index);
+
+        q.canvas_items.push_back(canvas_item);
+        item_rids.push_back(canvas_item);
+
+        if (debug_shapes) {
+
+            RID debug_canvas_item = vs->canvas_item_create();
+            vs->canvas_item_set_parent(debug_canvas_item, canvas_item);
+            vs->canvas_item_set_z_as_relative_to_parent(debug_canvas_item, false);
+            vs->canvas_item_set_z_index(debug_canvas_item, RS::CANVAS_ITEM_Z_MAX - 1);
+            q.canvas_items.push_back(debug_canvas_item);
+            debug_item_rids.push_back(debug_canvas_item);
+        }
+
+        for (QuadrantBake::Batch &b : item.batches) {
+            if (b.rect_texture) {
+                b.rect_texture->draw_rect_region(canvas_item, b.rect, b.src_rect, b.modulate, b.transpose, b.rect_normal_map, clip_uv);
             } else {
-                tex->draw_rect_region(canvas_item, rect, r, modulate, c.transpose, normal_map, clip_uv);
+                vs->canvas_item_add_triangle_array(canvas_item, b.indices, b.points, PoolVector<Color>(b.colors), PoolVector<Point2>(b.uvs),
+                        PoolVector<int>(), PoolVector<float>(), b.texture, -1, b.normal_map);
             }
+        }
+    }
+
+    for (const QuadrantBake::DebugShape &E : p_bake.debug_shapes) {
+        if (E.item < int(debug_item_rids.size())) {
+            vs->canvas_item_add_set_transform(debug_item_rids[E.item], E.xform);
+            E.shape->draw(debug_item_rids[E.item], debug_collision_color);
+            vs->canvas_item_add_set_transform(debug_item_rids[E.item], Transform2D());
+        }
+    }
 
-            const Vector<TileSet::ShapeData> &shapes = tile_set->tile_get_shapes(c.id);
+    for (const QuadrantBake::Shape &E : p_bake.shapes) {
+        _add_shape(shape_idx, q, E.shape, E.one_way_collision, E.one_way_collision_margin, E.xform, E.metadata);
+    }
 
-            for (int j = 0; j < shapes.size(); j++) {
-                Ref<Shape2D> shape = shapes[j].shape;
-                if (shape) {
-                    if (tile_set->tile_get_tile_mode(c.id) == TileSet::SINGLE_TILE || (shapes[j].autotile_coord.x == c.autotile_coord_x && shapes[j].autotile_coord.y == c.autotile_coord_y)) {
-                        Transform2D xform;
-                        xform.set_origin(offset.floor());
+    for (size_t i = 0; i < p_bake.rects.size(); i++) {
+        const Rect2 &r = p_bake.rects[i];
+        Ref<RectangleShape2D> rect_shape(make_ref_counted<RectangleShape2D>());
+        rect_shape->set_extents(r.size / 2);
+        Transform2D xform;
+        xform.set_origin(r.position + r.size / 2);
+        _add_shape(shape_idx, q, rect_shape, false, 0, xform, p_bake.rect_metadata[i]);
+        q.merged_shapes.emplace_back(eastl::move(rect_shape));
+    }
 
-                        Vector2 shape_ofs = shapes[j].shape_transform.get_origin();
+    for (const QuadrantBake::NavPoly &E : p_bake.navpolys) {
 
-                        _fix_cell_transform(xform, c, shape_ofs, s);
+        RID region = Navigation2DServer::get_singleton()->region_create();
+        Navigation2DServer::get_singleton()->region_set_map(region, navigation->get_rid());
+        Navigation2DServer::get_singleton()->region_set_transform(region, nav_rel * E.xform);
+        Navigation2DServer::get_singleton()->region_set_navpoly(region, E.navpoly);
 
-                        xform *= shapes[j].shape_transform.untranslated();
+        Quadrant::NavPoly np;
+        np.region = region;
+        np.xform = E.xform;
+        q.navpoly_ids[E.cell] = np;
 
-                        if (debug_canvas_item.is_valid()) {
-                            vs->canvas_item_add_set_transform(debug_canvas_item, xform);
-                            shape->draw(debug_canvas_item, debug_collision_color);
-                        }
+        if (debug_navigation) {
+            RID debug_navigation_item = vs->canvas_item_create();
+            vs->canvas_item_set_parent(debug_navigation_item, item_rids[E.item]);
+            vs->canvas_item_set_z_as_relative_to_parent(debug_navigation_item, false);
+            vs->canvas_item_set_z_index(debug_navigation_item, RS::CANVAS_ITEM_Z_MAX - 2); // Display one below collision debug
 
-                        if (shape->has_meta("decomposed")) {
-                            Array _shapes = shape->get_meta("decomposed").as<Array>();
-                            for (int k = 0; k < _shapes.size(); k++) {
-                                Ref<ConvexPolygonShape2D> convex = refFromVariant<ConvexPolygonShape2D>(_shapes[k]);
-                                if (convex) {
-                                    _add_shape(shape_idx, q, convex, shapes[j], xform, Vector2(E->first.x, E->first.y));
-#ifdef DEBUG_ENABLED
-                                } else {
-                                    print_error(String("The TileSet assigned to the TileMap ") + get_name() + " has an invalid convex shape.");
-#endif
-                                }
-                            }
-                        } else {
-                            _add_shape(shape_idx, q, shape, shapes[j], xform, Vector2(E->first.x, E->first.y));
-                        }
-                    }
-                }
-            }
+            if (debug_navigation_item.is_valid()) {
+                const auto & navigation_polygon_vertices = E.navpoly->get_vertices();
+                int vsize = navigation_polygon_vertices.size();
 
-            if (debug_canvas_item.is_valid()) {
-                vs->canvas_item_add_set_transform(debug_canvas_item, Transform2D());
-            }
+                if (vsize > 2) {
+                    Vector<Color> colors;
+                    Vector<Vector2> vertices(navigation_polygon_vertices);
+                    colors.resize(vsize,debug_navigation_color);
 
-            if (navigation) {
-                Ref<NavigationPolygon> navpoly;
-                Vector2 npoly_ofs;
-                if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
-                    navpoly = tile_set->autotile_get_navigation_polygon(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
-                    npoly_ofs = Vector2();
-                } else {
-                    navpoly = tile_set->tile_get_navigation_polygon(c.id);
-                    npoly_ofs = tile_set->tile_get_navigation_polygon_offset(c.id);
-                }
+                    Vector<int> indices;
 
-                if (navpoly) {
-                    Transform2D xform;
-                    xform.set_origin(offset.floor() + q.pos);
-                    _fix_cell_transform(xform, c, npoly_ofs, s);
-
-                    RID region = Navigation2DServer::get_singleton()->region_create();
-                    Navigation2DServer::get_singleton()->region_set_map(region, navigation->get_rid());
-                    Navigation2DServer::get_singleton()->region_set_transform(region, nav_rel * xform);
-                    Navigation2DServer::get_singleton()->region_set_navpoly(region, navpoly);
-
-                    Quadrant::NavPoly np;
-                    np.region = region;
-                    np.xform = xform;
-                    q.navpoly_ids[E->first] = np;
-
-                    if (debug_navigation) {
-                        RID debug_navigation_item = vs->canvas_item_create();
-                        vs->canvas_item_set_parent(debug_navigation_item, canvas_item);
-                        vs->canvas_item_set_z_as_relative_to_parent(debug_navigation_item, false);
-                        vs->canvas_item_set_z_index(debug_navigation_item, RS::CANVAS_ITEM_Z_MAX - 2); // Display one below collision debug
-
-                        if (debug_navigation_item.is_valid()) {
-                            const auto & navigation_polygon_vertices = navpoly->get_vertices();
-                            int vsize = navigation_polygon_vertices.size();
-
-                            if (vsize > 2) {
-                                Vector<Color> colors;
-                                Vector<Vector2> vertices(navigation_polygon_vertices);
-                                colors.resize(vsize,debug_navigation_color);
-
-                                Vector<int> indices;
-
-                                for (int j = 0; j < navpoly->get_polygon_count(); j++) {
-                                    const auto &polygon = navpoly->get_polygon(j);
-                                    indices.reserve((polygon.size()-2)*3);
-                                    for (int k = 2; k < polygon.size(); k++) {
-
-                                        int kofs[3] = { 0, k - 1, k };
-                                        for (int l = 0; l < 3; l++) {
-
-                                            int idx = polygon[kofs[l]];
-                                            ERR_FAIL_INDEX(idx, vsize);
-                                            indices.push_back(idx);
-                                        }
-                                    }
-                                }
-                                Transform2D navxform;
-                                navxform.set_origin(offset.floor());
-                                _fix_cell_transform(navxform, c, npoly_ofs, s);
-
-                                vs->canvas_item_set_transform(debug_navigation_item, navxform);
-                                vs->canvas_item_add_triangle_array(debug_navigation_item, indices, vertices, PoolVector<Color>(colors));
+                    for (int j = 0; j < E.navpoly->get_polygon_count(); j++) {
+                        const auto &polygon = E.navpoly->get_polygon(j);
+                        indices.reserve((polygon.size()-2)*3);
+                        for (int k = 2; k < polygon.size(); k++) {
+
+                            int kofs[3] = { 0, k - 1, k };
+                            for (int l = 0; l < 3; l++) {
+
+                                int idx = polygon[kofs[l]];
+                                ERR_FAIL_INDEX(idx, vsize);
+                                indices.push_back(idx);
                             }
                         }
                     }
-                }
-            }
 
-            Ref<OccluderPolygon2D> occluder;
-            if (tile_set->tile_get_tile_mode(c.id) == TileSet::AUTO_TILE || tile_set->tile_get_tile_mode(c.id) == TileSet::ATLAS_TILE) {
-                occluder = tile_set->autotile_get_light_occluder(c.id, Vector2(c.autotile_coord_x, c.autotile_coord_y));
-            } else {
-                occluder = tile_set->tile_get_light_occluder(c.id);
-            }
-            if (occluder) {
-                Vector2 occluder_ofs = tile_set->tile_get_occluder_offset(c.id);
-                Transform2D xform;
-                xform.set_origin(offset.floor() + q.pos);
-                _fix_cell_transform(xform, c, occluder_ofs, s);
-
-                RID orid = RenderingServer::get_singleton()->canvas_light_occluder_create();
-                RenderingServer::get_singleton()->canvas_light_occluder_set_transform(orid, get_global_transform() * xform);
-                RenderingServer::get_singleton()->canvas_light_occluder_set_polygon(orid, occluder->get_rid());
-                RenderingServer::get_singleton()->canvas_light_occluder_attach_to_canvas(orid, get_canvas());
-                RenderingServer::get_singleton()->canvas_light_occluder_set_light_mask(orid, occluder_light_mask);
-                Quadrant::Occluder oc;
-                oc.xform = xform;
-                oc.id = orid;
-                q.occluder_instances[E->first] = oc;
+                    vs->canvas_item_set_transform(debug_navigation_item, E.local_xform);
+                    vs->canvas_item_add_triangle_array(debug_navigation_item, indices, vertices, PoolVector<Color>(colors));
+                }
             }
         }
+    }
+
+    for (const QuadrantBake::Occluder &E : p_bake.occluders) {
+
+        RID orid = RenderingServer::get_singleton()->canvas_light_occluder_create();
+        RenderingServer::get_singleton()->canvas_light_occluder_set_transform(orid, get_global_transform() * E.xform);
+        RenderingServer::get_singleton()->canvas_light_occluder_set_polygon(orid, E.occluder->get_rid());
+        RenderingServer::get_singleton()->canvas_light_occluder_attach_to_canvas(orid, get_canvas());
+        RenderingServer::get_singleton()->canvas_light_occluder_set_light_mask(orid, occluder_light_mask);
+        Quadrant::Occluder oc;
+        oc.xform = E.xform;
+        oc.id = orid;
+        q.occluder_instances[E.cell] = oc;
+    }
+}
 
+void TileMap::update_dirty_quadrants() {
+
+    if (!pending_update)
+        return;
+    if (!is_inside_tree() || not tile_set) {
+        pending_update = false;
+        return;
+    }
+
+    SceneTree *st = SceneTree::get_singleton();
+
+    QuadrantBakeBatch batch;
+    batch.tofs = get_cell_draw_offset();
+    batch.self_modulate = get_self_modulate();
+    batch.debug_shapes = st && st->is_debugging_collisions_hint();
+
+    while (dirty_quadrant_list.first()) {
+
+        batch.quadrants.push_back(dirty_quadrant_list.first()->self());
         dirty_quadrant_list.remove(dirty_quadrant_list.first());
+    }
+
+    // tiles are turned into draw batches and shapes on the worker pool, the servers are only fed from this thread
+    batch.bakes.resize(batch.quadrants.size());
+    ThreadWorkPool::get_singleton()->do_work(uint32_t(batch.quadrants.size()), this, &TileMap::_bake_quadrant_threaded, &batch);
+
+    for (size_t i = 0; i < batch.quadrants.size(); i++) {
+        _commit_quadrant(*batch.quadrants[i], batch.bakes[i]);
+    }
+    if (!batch.quadrants.empty()) {
         quadrant_order_dirty = true;
     }
 
@@ -1376,6 +1674,21 @@ void TileMap::set_collision_use_parent(bool p_use_parent) {
     update_configuration_warning();
 }
 
+void TileMap::set_collision_merge_rectangles(bool p_enable) {
+
+    if (merge_rectangles == p_enable)
+        return;
+
+    _clear_quadrants();
+    merge_rectangles = p_enable;
+    _recreate_quadrants();
+}
+
+bool TileMap::get_collision_merge_rectangles() const {
+
+    return merge_rectangles;
+}
+
 void TileMap::set_collision_friction(float p_friction) {
 
     friction = p_friction;
@@ -1602,7 +1915,7 @@ void TileMap::_get_property_list(Vector<PropertyInfo> *p_list) const {
 }
 
 void TileMap::_validate_property(PropertyInfo &property) const {
-    if (use_parent && property.name != StringName("collision_use_parent") && StringUtils::begins_with(property.name,"collision_")) {
+    if (use_parent && property.name != StringName("collision_use_parent") && property.name != StringName("collision_merge_rectangles") && StringUtils::begins_with(property.name,"collision_")) {
         property.usage = PROPERTY_USAGE_NOEDITOR;
     }
 }
@@ -1840,6 +2153,9 @@ void TileMap::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("set_collision_use_parent", {"use_parent"}), &TileMap::set_collision_use_parent);
     MethodBinder::bind_method(D_METHOD("get_collision_use_parent"), &TileMap::get_collision_use_parent);
 
+    MethodBinder::bind_method(D_METHOD("set_collision_merge_rectangles", {"enable"}), &TileMap::set_collision_merge_rectangles);
+    MethodBinder::bind_method(D_METHOD("get_collision_merge_rectangles"), &TileMap::get_collision_merge_rectangles);
+
     MethodBinder::bind_method(D_METHOD("set_collision_layer", {"layer"}), &TileMap::set_collision_layer);
     MethodBinder::bind_method(D_METHOD("get_collision_layer"), &TileMap::get_collision_layer);
 
@@ -1909,6 +2225,7 @@ void TileMap::_bind_methods() {
     ADD_GROUP("Collision", "collision_");
     ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "collision_use_parent", PropertyHint::None, ""), "set_collision_use_parent", "get_collision_use_parent");
     ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "collision_use_kinematic", PropertyHint::None, ""), "set_collision_use_kinematic", "get_collision_use_kinematic");
+    ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "collision_merge_rectangles"), "set_collision_merge_rectangles", "get_collision_merge_rectangles");
     ADD_PROPERTY(PropertyInfo(VariantType::FLOAT, "collision_friction", PropertyHint::Range, "0,1,0.01"), "set_collision_friction", "get_collision_friction");
     ADD_PROPERTY(PropertyInfo(VariantType::FLOAT, "collision_bounce", PropertyHint::Range, "0,1,0.01"), "set_collision_bounce", "get_collision_bounce");
     ADD_PROPERTY(PropertyInfo(VariantType::INT, "collision_layer", PropertyHint::Layers2DPhysics), "set_collision_layer", "get_collision_layer");
@@ -1960,6 +2277,7 @@ TileMap::TileMap() {
     mode = MODE_SQUARE;
     half_offset = HALF_OFFSET_DISABLED;
     use_parent = false;
+    merge_rectangles = false;
     collision_parent = nullptr;
     use_kinematic = false;
     navigation = nullptr;
@@ -79,6 +79,7 @@ private:
     HalfOffset half_offset;
     bool use_parent;
     bool use_kinematic;
+    bool merge_rectangles;
 
     union PosKey {
 
@@ -149,6 +150,7 @@ private:
 
         HashMap<PosKey, NavPoly> navpoly_ids;
         HashMap<PosKey, Occluder> occluder_instances;
+        Vector<Ref<Shape2D>> merged_shapes; // rectangles coalesced from several tiles
 
         VSet<PosKey> cells;
 
@@ -160,6 +162,7 @@ private:
             cells = q.cells;
             navpoly_ids = q.navpoly_ids;
             occluder_instances = q.occluder_instances;
+            merged_shapes = q.merged_shapes;
         }
         Quadrant(const Quadrant &q) :
                 dirty_list(this) {
@@ -170,6 +173,7 @@ private:
             cells = q.cells;
             occluder_instances = q.occluder_instances;
             navpoly_ids = q.navpoly_ids;
+            merged_shapes = q.merged_shapes;
         }
         Quadrant() :
                 dirty_list(this) {}
@@ -201,9 +205,15 @@ private:
 
     int occluder_light_mask;
 
-    void _fix_cell_transform(Transform2D &xform, const Cell &p_cell, const Vector2 &p_offset, const Size2 &p_sc);
+    void _fix_cell_transform(Transform2D &xform, const Cell &p_cell, const Vector2 &p_offset, const Size2 &p_sc) const;
 
-    void _add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, const TileSet::ShapeData &p_shape_data, const Transform2D &p_xform, const Vector2 &p_metadata);
+    void _add_shape(int &shape_idx, const Quadrant &p_q, const Ref<Shape2D> &p_shape, bool p_one_way, float p_one_way_margin, const Transform2D &p_xform, const Vector2 &p_metadata);
+
+    struct QuadrantBake;
+    struct QuadrantBakeBatch;
+    void _bake_quadrant(const Quadrant &p_q, QuadrantBake &r_bake, const Vector2 &p_tofs, const Color &p_self_modulate, bool p_debug_shapes) const;
+    void _bake_quadrant_threaded(uint32_t p_index, QuadrantBakeBatch *p_batch);
+    void _commit_quadrant(Quadrant &q, QuadrantBake &p_bake);
 
     HashMap<PosKey, Quadrant>::iterator _create_quadrant(const PosKey &p_qk);
     void _erase_quadrant(HashMap<PosKey, Quadrant>::iterator Q);
@@ -294,6 +304,9 @@ public:
     void set_collision_use_parent(bool p_use_parent);
     bool get_collision_use_parent() const;
 
+    void set_collision_merge_rectangles(bool p_enable);
+    bool get_collision_merge_rectangles() const;
+
     void set_collision_friction(float p_friction);
     float get_collision_friction() const;
 
@@ -402,7 +402,7 @@ BakedLightmap::BakeError BakedLightmap::bake(Node *p_from_node, bool p_create_vi
         }
     }
 
-    baker.begin_bake(bake_subdiv, bake_bounds);
+    baker.begin_bake(bake_subdiv, bake_bounds, bake_mode == BAKE_MODE_RAY_TRACE);
 
     Vector<PlotMesh> mesh_list;
     Vector<PlotLight> light_list;
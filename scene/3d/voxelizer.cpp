@@ -35,7 +35,9 @@
 #include "core/string_utils.h"
 #include "core/os/threaded_array_processor.h"
 #include "core/print_string.h"
+#include "core/hashfuncs.h"
 
+#include <algorithm>
 #include <cstdlib>
 
 #define FINDMINMAX(x0, x1, x2, min, max) \
@@ -629,6 +631,8 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
                 //test against original bounds
                 if (!fast_tri_box_overlap(original_bounds.position + original_bounds.size * 0.5, original_bounds.size * 0.5, vtxs))
                     continue;
+                if (collect_ray_geometry)
+                    _add_ray_triangle(vtxs);
                 //plot
                 _plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
             }
@@ -662,6 +666,8 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
                 //test against original bounds
                 if (!fast_tri_box_overlap(original_bounds.position + original_bounds.size * 0.5, original_bounds.size * 0.5, vtxs))
                     continue;
+                if (collect_ray_geometry)
+                    _add_ray_triangle(vtxs);
                 //plot face
                 _plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
             }
@@ -671,6 +677,285 @@ void VoxelLightBaker::plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, con
     max_original_cells = bake_cells.size();
 }
 
+//ray trace mode BVH build and traversal limits
+enum {
+    RAY_BVH_BINS = 12,
+    RAY_BVH_LEAF_SIZE = 4,
+    RAY_BVH_MAX_LEAF_SIZE = 16,
+    RAY_BVH_MAX_DEPTH = 64,
+    RAY_BVH_STACK_SIZE = RAY_BVH_MAX_DEPTH + 2
+};
+
+static const float ray_trace_bias = 0.05f; //in cells, offsets ray origins off the surface they start from
+
+static _FORCE_INLINE_ float _aabb_surface(const AABB &p_aabb) {
+    const Vector3 &s = p_aabb.size;
+    return 2.0f * (s.x * s.y + s.y * s.z + s.z * s.x);
+}
+
+void VoxelLightBaker::_add_ray_triangle(const Vector3 *p_vtx) {
+
+    RayTriangle tri;
+    for (int i = 0; i < 3; i++) {
+        tri.vertex[i] = to_cell_space.xform(p_vtx[i]);
+    }
+    ray_triangles.push_back(tri);
+    ray_bvh.clear(); //rebuilt on next use
+}
+
+int VoxelLightBaker::_build_ray_bvh(Vector<RayBuildRef> &r_refs, int p_from, int p_to, int p_depth) {
+
+    AABB bounds = r_refs[p_from].aabb;
+    AABB center_bounds(r_refs[p_from].center, Vector3());
+    for (int i = p_from + 1; i < p_to; i++) {
+        bounds.merge_with(r_refs[i].aabb);
+        center_bounds.expand_to(r_refs[i].center);
+    }
+
+    int count = p_to - p_from;
+    int node = ray_bvh.size();
+    ray_bvh.push_back(RayBVHNode());
+    ray_bvh[node].min = bounds.position;
+    ray_bvh[node].max = bounds.position + bounds.size;
+    ray_bvh[node].first = p_from;
+    ray_bvh[node].count = count;
+
+    if (count <= RAY_BVH_LEAF_SIZE || p_depth >= RAY_BVH_MAX_DEPTH)
+        return node;
+
+    int axis = center_bounds.get_longest_axis_index();
+    float axis_min = center_bounds.position[axis];
+    float axis_len = center_bounds.size[axis];
+    int mid = -1;
+
+    if (axis_len > CMP_EPSILON) {
+        //binned surface area heuristic along the longest centroid axis
+        AABB bin_aabb[RAY_BVH_BINS];
+        int bin_count[RAY_BVH_BINS] = {};
+        float bin_scale = RAY_BVH_BINS / axis_len;
+        auto bin_of = [&](const RayBuildRef &p_ref) {
+            return MIN(int((p_ref.center[axis] - axis_min) * bin_scale), RAY_BVH_BINS - 1);
+        };
+
+        for (int i = p_from; i < p_to; i++) {
+            int b = bin_of(r_refs[i]);
+            if (bin_count[b] == 0) {
+                bin_aabb[b] = r_refs[i].aabb;
+            } else {
+                bin_aabb[b].merge_with(r_refs[i].aabb);
+            }
+            bin_count[b]++;
+        }
+
+        float right_cost[RAY_BVH_BINS];
+        AABB accum;
+        int accum_count = 0;
+        for (int i = RAY_BVH_BINS - 1; i > 0; i--) {
+            if (bin_count[i]) {
+                if (accum_count == 0) {
+                    accum = bin_aabb[i];
+                } else {
+                    accum.merge_with(bin_aabb[i]);
+                }
+                accum_count += bin_count[i];
+            }
+            right_cost[i] = accum_count ? _aabb_surface(accum) * accum_count : 0.0f;
+        }
+
+        float best_cost = _aabb_surface(bounds) * count; //cost of keeping this node as a leaf
+        int best_bin = -1;
+        accum_count = 0;
+        for (int i = 0; i < RAY_BVH_BINS - 1; i++) {
+            if (bin_count[i]) {
+                if (accum_count == 0) {
+                    accum = bin_aabb[i];
+                } else {
+                    accum.merge_with(bin_aabb[i]);
+                }
+                accum_count += bin_count[i];
+            }
+            if (accum_count == 0 || accum_count == count)
+                continue;
+            float cost = _aabb_surface(accum) * accum_count + right_cost[i + 1];
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_bin = i;
+            }
+        }
+
+        if (best_bin >= 0) {
+            RayBuildRef *split = std::partition(r_refs.data() + p_from, r_refs.data() + p_to, [&](const RayBuildRef &p_ref) {
+                return bin_of(p_ref) <= best_bin;
+            });
+            mid = split - r_refs.data();
+        }
+    }
+
+    if (mid <= p_from || mid >= p_to) {
+        if (count <= RAY_BVH_MAX_LEAF_SIZE)
+            return node; //splitting does not pay off
+        //overlapping centroids, fall back to a median split
+        mid = (p_from + p_to) / 2;
+        std::nth_element(r_refs.data() + p_from, r_refs.data() + mid, r_refs.data() + p_to, [axis](const RayBuildRef &p_a, const RayBuildRef &p_b) {
+            return p_a.center[axis] < p_b.center[axis];
+        });
+    }
+
+    ray_bvh[node].count = 0;
+    _build_ray_bvh(r_refs, p_from, mid, p_depth + 1);
+    ray_bvh[node].first = _build_ray_bvh(r_refs, mid, p_to, p_depth + 1);
+    return node;
+}
+
+void VoxelLightBaker::_make_ray_bvh() {
+
+    ray_bvh.clear();
+    if (ray_triangles.empty())
+        return;
+
+    Vector<RayBuildRef> refs;
+    refs.resize(ray_triangles.size());
+    for (int i = 0; i < (int)ray_triangles.size(); i++) {
+        const RayTriangle &tri = ray_triangles[i];
+        RayBuildRef &ref = refs[i];
+        ref.aabb = AABB(tri.vertex[0], Vector3());
+        ref.aabb.expand_to(tri.vertex[1]);
+        ref.aabb.expand_to(tri.vertex[2]);
+        ref.center = ref.aabb.position + ref.aabb.size * 0.5;
+        ref.triangle = i;
+    }
+
+    ray_bvh.reserve(refs.size() * 2 / RAY_BVH_LEAF_SIZE + 1);
+    _build_ray_bvh(refs, 0, refs.size(), 0);
+
+    //store triangles in leaf order, so every leaf addresses a contiguous range
+    Vector<RayTriangle> sorted;
+    sorted.resize(refs.size());
+    for (int i = 0; i < (int)refs.size(); i++) {
+        sorted[i] = ray_triangles[refs[i].triangle];
+    }
+    ray_triangles = eastl::move(sorted);
+}
+
+static _FORCE_INLINE_ bool _ray_box_hit(const Vector3 &p_min, const Vector3 &p_max, const Vector3 &p_from, const Vector3 &p_inv_dir, float p_max_dist, float &r_near) {
+
+    float t_near = 0;
+    float t_far = p_max_dist;
+    for (int i = 0; i < 3; i++) {
+        float t0 = (p_min[i] - p_from[i]) * p_inv_dir[i];
+        float t1 = (p_max[i] - p_from[i]) * p_inv_dir[i];
+        if (t0 > t1)
+            SWAP(t0, t1);
+        t_near = M_MAX(t_near, t0);
+        t_far = MIN(t_far, t1);
+    }
+    r_near = t_near;
+    return t_near <= t_far;
+}
+
+static _FORCE_INLINE_ bool _ray_triangle_hit(const Vector3 *p_vtx, const Vector3 &p_from, const Vector3 &p_dir, float &r_dist) {
+
+    //Moller-Trumbore
+    Vector3 e1 = p_vtx[1] - p_vtx[0];
+    Vector3 e2 = p_vtx[2] - p_vtx[0];
+    Vector3 p = p_dir.cross(e2);
+    float det = e1.dot(p);
+    if (Math::abs(det) < 1e-8f)
+        return false;
+    float inv_det = 1.0f / det;
+    Vector3 s = p_from - p_vtx[0];
+    float u = s.dot(p) * inv_det;
+    if (u < 0.0f || u > 1.0f)
+        return false;
+    Vector3 q = s.cross(e1);
+    float v = p_dir.dot(q) * inv_det;
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+    float t = e2.dot(q) * inv_det;
+    if (t <= 0.0f)
+        return false;
+    r_dist = t;
+    return true;
+}
+
+bool VoxelLightBaker::_ray_bvh_intersect(const Vector3 &p_from, const Vector3 &p_dir, float p_max_dist, bool p_any_hit, float &r_dist, int *r_triangle) const {
+
+    if (ray_bvh.empty())
+        return false;
+
+    Vector3 inv_dir;
+    for (int i = 0; i < 3; i++) {
+        inv_dir[i] = Math::is_zero_approx(p_dir[i]) ? 1e30f : 1.0f / p_dir[i];
+    }
+
+    const RayBVHNode *nodes = ray_bvh.data();
+    const RayTriangle *triangles = ray_triangles.data();
+
+    struct StackEntry {
+        int node;
+        float dist;
+    };
+    StackEntry stack[RAY_BVH_STACK_SIZE];
+    int stack_size = 0;
+
+    float closest = p_max_dist;
+    bool hit = false;
+
+    float root_dist;
+    if (!_ray_box_hit(nodes[0].min, nodes[0].max, p_from, inv_dir, closest, root_dist))
+        return false;
+    stack[stack_size++] = { 0, root_dist };
+
+    while (stack_size) {
+
+        const StackEntry entry = stack[--stack_size];
+        if (entry.dist > closest)
+            continue; //a closer hit was found after this node was pushed
+
+        const RayBVHNode &node = nodes[entry.node];
+
+        if (node.count) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                float dist;
+                if (!_ray_triangle_hit(triangles[i].vertex, p_from, p_dir, dist) || dist >= closest)
+                    continue;
+                closest = dist;
+                hit = true;
+                if (r_triangle)
+                    *r_triangle = i;
+                if (p_any_hit) {
+                    r_dist = closest;
+                    return true;
+                }
+            }
+            continue;
+        }
+
+        int children[2] = { entry.node + 1, node.first };
+        float child_dist[2];
+        bool child_hit[2];
+        for (int i = 0; i < 2; i++) {
+            child_hit[i] = _ray_box_hit(nodes[children[i]].min, nodes[children[i]].max, p_from, inv_dir, closest, child_dist[i]);
+        }
+
+        if (child_hit[0] && child_hit[1]) {
+            //visit the nearer child first, so closest hit queries can discard the other one early
+            int first = child_dist[0] <= child_dist[1] ? 0 : 1;
+            stack[stack_size++] = { children[1 - first], child_dist[1 - first] };
+            stack[stack_size++] = { children[first], child_dist[first] };
+        } else if (child_hit[0]) {
+            stack[stack_size++] = { children[0], child_dist[0] };
+        } else if (child_hit[1]) {
+            stack[stack_size++] = { children[1], child_dist[1] };
+        }
+    }
+
+    if (hit) {
+        r_dist = closest;
+    }
+    return hit;
+}
+
 void VoxelLightBaker::_init_light_plot(int p_idx, int p_level, int p_x, int p_y, int p_z, uint32_t p_parent) {
 
     bake_light[p_idx].x = p_x;
@@ -844,6 +1129,20 @@ void VoxelLightBaker::plot_light_directional(const Vector3 &p_direction, const C
 
     Vector3 light_energy = Vector3(p_color.r, p_color.g, p_color.b) * p_energy * p_indirect_energy;
 
+    if (collect_ray_geometry) {
+        DirectLight dl;
+        dl.type = DIRECT_LIGHT_DIRECTIONAL;
+        dl.position = Vector3();
+        dl.direction = light_axis.normalized();
+        dl.energy = light_energy;
+        dl.radius = 0;
+        dl.attenuation = 0;
+        dl.spot_angle = 0;
+        dl.spot_attenuation = 0;
+        dl.direct = p_direct;
+        direct_lights.push_back(dl);
+    }
+
     int idx = first_leaf;
     while (idx >= 0) {
 
@@ -933,6 +1232,20 @@ void VoxelLightBaker::plot_light_omni(const Vector3 &p_pos, const Color &p_color
     const Cell *cells = bake_cells.data();
     Vector3 light_energy = Vector3(p_color.r, p_color.g, p_color.b) * p_energy * p_indirect_energy;
 
+    if (collect_ray_geometry) {
+        DirectLight dl;
+        dl.type = DIRECT_LIGHT_OMNI;
+        dl.position = to_cell_space.xform(p_pos);
+        dl.direction = Vector3();
+        dl.energy = light_energy;
+        dl.radius = local_radius;
+        dl.attenuation = p_attenutation;
+        dl.spot_angle = 0;
+        dl.spot_attenuation = 0;
+        dl.direct = p_direct;
+        direct_lights.push_back(dl);
+    }
+
     int idx = first_leaf;
     while (idx >= 0) {
 
@@ -1062,6 +1375,20 @@ void VoxelLightBaker::plot_light_spot(const Vector3 &p_pos, const Vector3 &p_axi
     const Cell *cells = bake_cells.data();
     Vector3 light_energy = Vector3(p_color.r, p_color.g, p_color.b) * p_energy * p_indirect_energy;
 
+    if (collect_ray_geometry) {
+        DirectLight dl;
+        dl.type = DIRECT_LIGHT_SPOT;
+        dl.position = to_cell_space.xform(p_pos);
+        dl.direction = -spot_axis;
+        dl.energy = light_energy;
+        dl.radius = local_radius;
+        dl.attenuation = p_attenutation;
+        dl.spot_angle = p_spot_angle;
+        dl.spot_attenuation = p_spot_attenuation;
+        dl.direct = p_direct;
+        direct_lights.push_back(dl);
+    }
+
     int idx = first_leaf;
     while (idx >= 0) {
 
@@ -1659,7 +1986,7 @@ _ALWAYS_INLINE_ uint32_t xorshift32(uint32_t *state) {
     return x;
 }
 
-Vector3 VoxelLightBaker::_compute_ray_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal) {
+Vector3 VoxelLightBaker::_compute_ray_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, uint32_t p_seed) {
 
     int samples_per_quality[3] = { 48, 128, 512 };
 
@@ -1681,7 +2008,7 @@ Vector3 VoxelLightBaker::_compute_ray_trace_at_pos(const Vector3 &p_pos, const V
     const Light3D *light = bake_light.data();
     const Cell *cells = bake_cells.data();
 
-    uint32_t local_rng_state = rand(); //needs to be fixed again
+    uint32_t local_rng_state = p_seed;
 
     for (int i = 0; i < samples; i++) {
 
@@ -1764,11 +2091,140 @@ Vector3 VoxelLightBaker::_compute_ray_trace_at_pos(const Vector3 &p_pos, const V
         }
     }
 
-    // Make sure we don't reset this thread's RNG state
+    return accum / samples;
+}
+
+uint32_t VoxelLightBaker::_find_lit_cell_at_pos(const Vector3 &p_pos, const Vector3 &p_direction) {
+
+    //hit points tend to land on voxel boundaries, so also probe just behind and just in front of the surface
+    static const float probe_offsets[3] = { 0.0f, 0.5f, -0.5f };
+    const Cell *cells = bake_cells.data();
+
+    for (int i = 0; i < 3; i++) {
+        Vector3 pos = p_pos + p_direction * probe_offsets[i];
+        uint32_t cell = _find_cell_at_pos(cells, int(Math::floor(pos.x)), int(Math::floor(pos.y)), int(Math::floor(pos.z)));
+        if (cell != CHILD_EMPTY)
+            return cell;
+    }
+    return CHILD_EMPTY;
+}
+
+Vector3 VoxelLightBaker::_compute_bvh_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, uint32_t p_seed) {
+
+    int samples_per_quality[3] = { 48, 128, 512 };
+    int bounces_per_quality[3] = { 1, 2, 3 };
+
+    int samples = samples_per_quality[bake_quality];
+    int bounces = bounces_per_quality[bake_quality];
+
+    const Cell *cells = bake_cells.data();
+    const RayTriangle *triangles = ray_triangles.data();
+
+    float max_dist = Vector3(axis_cell_size[0], axis_cell_size[1], axis_cell_size[2]).length();
+    Vector3 accum;
+    uint32_t local_rng_state = p_seed;
+
+    for (int i = 0; i < samples; i++) {
+
+        Vector3 pos = p_pos;
+        Vector3 normal = p_normal;
+        Vector3 throughput(1, 1, 1);
+
+        for (int b = 0; b < bounces; b++) {
+
+            Vector3 v0 = Math::abs(normal.z) < 0.999f ? Vector3(0, 0, 1) : Vector3(0, 1, 0);
+            Vector3 tangent = v0.cross(normal).normalized();
+            Vector3 bitangent = tangent.cross(normal).normalized();
+
+            //cosine weighted hemisphere, so the cosine term cancels out with the sample distribution
+            float r1 = (xorshift32(&local_rng_state) % 65535) / 65535.0f;
+            float r2 = (xorshift32(&local_rng_state) % 65535) / 65535.0f;
+            float r = Math::sqrt(r1);
+            float phi = r2 * float(Math_PI) * 2.0f;
+            Vector3 direction = tangent * (r * Math::cos(phi)) + bitangent * (r * Math::sin(phi)) + normal * Math::sqrt(M_MAX(0.0f, 1.0f - r1));
+
+            float dist;
+            int triangle;
+            if (!_ray_bvh_intersect(pos + normal * ray_trace_bias, direction, max_dist, false, dist, &triangle))
+                break;
+
+            Vector3 hit_pos = pos + normal * ray_trace_bias + direction * dist;
+            //albedo and emission still come from the voxels, they are not stored per triangle
+            uint32_t cell = _find_lit_cell_at_pos(hit_pos, direction);
+            if (cell == CHILD_EMPTY)
+                break;
+
+            const Vector3 *vtx = triangles[triangle].vertex;
+            Vector3 hit_normal = (vtx[1] - vtx[0]).cross(vtx[2] - vtx[0]).normalized();
+            if (hit_normal.dot(direction) > 0)
+                hit_normal = -hit_normal; //face the ray, geometry is treated as two sided
+
+            Vector3 albedo(cells[cell].albedo[0], cells[cell].albedo[1], cells[cell].albedo[2]);
+            Vector3 emission(cells[cell].emission[0], cells[cell].emission[1], cells[cell].emission[2]);
+
+            //light leaving a diffuse surface is albedo * irradiance / PI, and cosine sampling brings the PI back
+            accum += throughput * (emission + albedo * _compute_direct_light_at_pos(hit_pos, hit_normal, true));
+
+            throughput *= albedo;
+            if (throughput.x + throughput.y + throughput.z < CMP_EPSILON)
+                break;
+
+            pos = hit_pos;
+            normal = hit_normal;
+        }
+    }
 
     return accum / samples;
 }
 
+Vector3 VoxelLightBaker::_compute_direct_light_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, bool p_bounce) {
+
+    float max_dist = Vector3(axis_cell_size[0], axis_cell_size[1], axis_cell_size[2]).length();
+    Vector3 from = p_pos + p_normal * ray_trace_bias;
+    Vector3 accum;
+
+    for (const DirectLight &dl : direct_lights) {
+
+        if (!p_bounce && !dl.direct)
+            continue; // indirect only light, its direct part stays out of the lightmap
+
+        Vector3 to_light;
+        float dist;
+        float att = 1.0;
+
+        if (dl.type == DIRECT_LIGHT_DIRECTIONAL) {
+            to_light = -dl.direction;
+            dist = max_dist;
+        } else {
+            to_light = dl.position - p_pos;
+            dist = to_light.length();
+            if (dist >= dl.radius || dist < CMP_EPSILON)
+                continue; // too far away
+            to_light /= dist;
+            att = Math::pow(1.0f - dist / dl.radius, dl.attenuation);
+
+            if (dl.type == DIRECT_LIGHT_SPOT) {
+                float angle = Math::rad2deg(Math::acos(CLAMP(-to_light.dot(dl.direction), -1.0f, 1.0f)));
+                if (angle > dl.spot_angle)
+                    continue; // outside the cone
+                att *= Math::pow(1.0f - angle / dl.spot_angle, dl.spot_attenuation);
+            }
+        }
+
+        float n_dot_l = p_normal.dot(to_light);
+        if (n_dot_l <= 0)
+            continue;
+
+        float hit_dist;
+        if (_ray_bvh_intersect(from, to_light, dist, true, hit_dist))
+            continue; // shadowed
+
+        accum += dl.energy * (n_dot_l * att);
+    }
+
+    return accum;
+}
+
 void VoxelLightBaker::_lightmap_bake_point(uint32_t p_x, LightMap *p_line) {
 
     LightMap *pixel = &p_line[p_x];
@@ -1779,7 +2235,14 @@ void VoxelLightBaker::_lightmap_bake_point(uint32_t p_x, LightMap *p_line) {
             pixel->light = _compute_pixel_light_at_pos(pixel->pos, pixel->normal) * energy;
         } break;
         case BAKE_MODE_RAY_TRACE: {
-            pixel->light = _compute_ray_trace_at_pos(pixel->pos, pixel->normal) * energy;
+            //seed from the texel position, so results don't depend on which thread baked it
+            uint32_t seed = hash_djb2_buffer((const uint8_t *)&pixel->pos, sizeof(Vector3)) | 1;
+            if (!ray_bvh.empty()) {
+                pixel->light = _compute_bvh_trace_at_pos(pixel->pos, pixel->normal, seed) * energy;
+                pixel->direct = _compute_direct_light_at_pos(pixel->pos, pixel->normal, false);
+            } else {
+                pixel->light = _compute_ray_trace_at_pos(pixel->pos, pixel->normal, seed) * energy;
+            }
         } break;
     }
 }
@@ -1885,6 +2348,11 @@ Error VoxelLightBaker::make_lightmap(const Transform &p_xform, Ref<Mesh> &p_mesh
         }
     }
 
+    if (bake_mode == BAKE_MODE_RAY_TRACE && ray_bvh.empty() && !ray_triangles.empty()) {
+        _make_ray_bvh();
+    }
+    bool traced_direct = bake_mode == BAKE_MODE_RAY_TRACE && !ray_bvh.empty();
+
     //step 3 perform voxel cone trace on lightmap pixels
     {
         LightMap *lightmap_ptr = lightmap.data();
@@ -1966,7 +2434,11 @@ Error VoxelLightBaker::make_lightmap(const Transform &p_xform, Ref<Mesh> &p_mesh
         }
 
         //add directional light (do this after blur)
-        {
+        if (traced_direct) {
+            for (int i = 0; i < width * height; i++) {
+                lightmap_ptr[i].light += lightmap_ptr[i].direct;
+            }
+        } else {
             const Cell *cells = bake_cells.data();
             const Light3D *light = bake_light.data();
 #ifdef _OPENMP
@@ -2129,12 +2601,16 @@ Error VoxelLightBaker::make_lightmap(const Transform &p_xform, Ref<Mesh> &p_mesh
     return OK;
 }
 
-void VoxelLightBaker::begin_bake(int p_subdiv, const AABB &p_bounds) {
+void VoxelLightBaker::begin_bake(int p_subdiv, const AABB &p_bounds, bool p_collect_ray_geometry) {
 
     original_bounds = p_bounds;
     cell_subdiv = p_subdiv;
     bake_cells.resize(1);
     material_cache.clear();
+    collect_ray_geometry = p_collect_ray_geometry;
+    ray_triangles.clear();
+    ray_bvh.clear();
+    direct_lights.clear();
 
     //find out the actual real bounds, power of 2, which gets the highest subdivision
     po2_bounds = p_bounds;
@@ -2454,4 +2930,5 @@ VoxelLightBaker::VoxelLightBaker() {
     bake_texture_size = 128;
     propagation = 0.85f;
     energy = 1.0;
+    collect_ray_geometry = false;
 }
@@ -150,21 +150,72 @@ private:
 
     struct LightMap {
         Vector3 light;
+        Vector3 direct; //ray traced direct light, added after the indirect light is blurred
         Vector3 pos;
         Vector3 normal;
     };
 
+    //ray trace mode geometry, in cell space
+    struct RayTriangle {
+        Vector3 vertex[3];
+    };
+
+    struct RayBVHNode {
+        Vector3 min;
+        Vector3 max;
+        int first; //first triangle for leaves, right child for inner nodes (the left child always follows its parent)
+        int count; //triangles in a leaf, 0 for inner nodes
+    };
+
+    struct RayBuildRef {
+        AABB aabb;
+        Vector3 center;
+        int triangle;
+    };
+
+    enum DirectLightType {
+        DIRECT_LIGHT_DIRECTIONAL,
+        DIRECT_LIGHT_OMNI,
+        DIRECT_LIGHT_SPOT,
+    };
+
+    struct DirectLight {
+        DirectLightType type;
+        Vector3 position;
+        Vector3 direction; //direction the light travels in
+        Vector3 energy;
+        float radius;
+        float attenuation;
+        float spot_angle;
+        float spot_attenuation;
+        bool direct; //false for lights that only contribute bounced light
+    };
+
+    bool collect_ray_geometry;
+    Vector<RayTriangle> ray_triangles;
+    Vector<RayBVHNode> ray_bvh;
+    Vector<DirectLight> direct_lights;
+
+    void _add_ray_triangle(const Vector3 *p_vtx);
+    int _build_ray_bvh(Vector<RayBuildRef> &r_refs, int p_from, int p_to, int p_depth);
+    void _make_ray_bvh();
+    bool _ray_bvh_intersect(const Vector3 &p_from, const Vector3 &p_dir, float p_max_dist, bool p_any_hit, float &r_dist, int *r_triangle = nullptr) const;
+
     void _plot_triangle(Vector2 *vertices, Vector3 *positions, Vector3 *normals, LightMap *pixels, int width, int height);
 
     _FORCE_INLINE_ void _sample_baked_octree_filtered_and_anisotropic(const Vector3 &p_posf, const Vector3 &p_direction, float p_level, Vector3 &r_color, float &r_alpha);
     _FORCE_INLINE_ Vector3 _voxel_cone_trace(const Vector3 &p_pos, const Vector3 &p_normal, float p_aperture);
     _FORCE_INLINE_ Vector3 _compute_pixel_light_at_pos(const Vector3 &p_pos, const Vector3 &p_normal);
-    _FORCE_INLINE_ Vector3 _compute_ray_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal);
+    _FORCE_INLINE_ Vector3 _compute_ray_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, uint32_t p_seed);
+    _FORCE_INLINE_ uint32_t _find_lit_cell_at_pos(const Vector3 &p_pos, const Vector3 &p_direction);
+    Vector3 _compute_bvh_trace_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, uint32_t p_seed);
+    Vector3 _compute_direct_light_at_pos(const Vector3 &p_pos, const Vector3 &p_normal, bool p_bounce);
 
     void _lightmap_bake_point(uint32_t p_x, LightMap *p_line);
 
 public:
-    void begin_bake(int p_subdiv, const AABB &p_bounds);
+    //! p_collect_ray_geometry keeps the plotted triangles, so BAKE_MODE_RAY_TRACE lightmaps can trace against them.
+    void begin_bake(int p_subdiv, const AABB &p_bounds, bool p_collect_ray_geometry = false);
     void plot_mesh(const Transform &p_xform, Ref<Mesh> &p_mesh, const Vector<Ref<Material>> &p_materials, const Ref<Material> &p_override_material);
     void begin_bake_light(BakeQuality p_quality = BAKE_QUALITY_MEDIUM, BakeMode p_bake_mode = BAKE_MODE_CONE_TRACE, float p_propagation = 0.85, float p_energy = 1);
     void plot_light_directional(const Vector3 &p_direction, const Color &p_color, float p_energy, float p_indirect_energy, bool p_direct);
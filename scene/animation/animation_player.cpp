@@ -311,6 +311,9 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 
                 TrackNodeCache::PropertyAnim pa;
                 pa.subpath = leftover_path;
+                if (leftover_path.size() == 1) {
+                    pa.accessor.set_property(leftover_path[0]);
+                }
                 pa.object = resource ? (Object *)resource.get() : (Object *)child;
                 pa.special = SP_NONE;
                 pa.owner = p_anim->node_cache[i];
@@ -333,6 +336,9 @@ void AnimationPlayer::_ensure_node_caches(AnimationData *p_anim) {
 
                 TrackNodeCache::BezierAnim ba;
                 ba.bezier_property = leftover_path;
+                if (leftover_path.size() == 1) {
+                    ba.accessor.set_property(leftover_path[0]);
+                }
                 ba.object = resource ? (Object *)resource.get() : (Object *)child;
                 ba.owner = p_anim->node_cache[i];
 
@@ -419,7 +425,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
                 if (update_mode == Animation::UPDATE_CAPTURE) {
 
                     if (p_started) {
-                        pa->capture = pa->object->get_indexed(pa->subpath);
+                        pa->capture = pa->get_value();
                     }
 
                     int key_count = a->track_get_key_count(i);
@@ -491,7 +497,7 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, float
 
                             case SP_NONE: {
                                 bool valid;
-                                pa->object->set_indexed(pa->subpath, value, &valid); //you are not speshul
+                                pa->set_value(value, &valid); //you are not speshul
 #ifdef DEBUG_ENABLED
                                 if (!valid) {
                                     ERR_PRINT("Failed setting track value '" + String(pa->owner->path) + "'. Check if property exists or the type of key is valid. Animation '" + a->get_name() + "' at node '" + (String)get_path() + "'.");
@@ -883,7 +889,7 @@ void AnimationPlayer::_animation_update_transforms() {
 
             case SP_NONE: {
                 bool valid;
-                pa->object->set_indexed(pa->subpath, pa->value_accum, &valid); //you are not speshul
+                pa->set_value(pa->value_accum, &valid); //you are not speshul
 #ifdef DEBUG_ENABLED
                 if (!valid) {
                     ERR_PRINT("Failed setting key at time " + rtos(playback.current.pos) + " in Animation '" + get_current_animation() + "' at Node '" + (String)get_path() + "', Track '" + String(pa->owner->path) + "'. Check if property exists or the type of key is right for the property");
@@ -927,7 +933,11 @@ void AnimationPlayer::_animation_update_transforms() {
         TrackNodeCache::BezierAnim *ba = cache_update_bezier[i];
 
         ERR_CONTINUE(ba->accum_pass != accum_pass);
-        ba->object->set_indexed(ba->bezier_property, ba->bezier_accum);
+        if (ba->bezier_property.size() == 1) {
+            ba->accessor.set(ba->object, ba->bezier_accum);
+        } else {
+            ba->object->set_indexed(ba->bezier_property, ba->bezier_accum);
+        }
     }
 
     cache_update_bezier_size = 0;
@@ -35,6 +35,7 @@
 #include "scene/3d/node_3d.h"
 #include "scene/resources/animation.h"
 #include "core/map.h"
+#include "core/property_accessor.h"
 
 #ifdef TOOLS_ENABLED
 // To save/restore animated values
@@ -115,11 +116,23 @@ private:
             TrackNodeCache *owner;
             SpecialProperty special; //small optimization
             Vector<StringName> subpath;
+            PropertyAccessor accessor; // caches the setter when subpath is a single property
             Object *object;
             Variant value_accum;
             uint64_t accum_pass;
             Variant capture;
 
+            void set_value(const Variant &p_value, bool *r_valid = nullptr) {
+                if (subpath.size() == 1) {
+                    accessor.set(object, p_value, r_valid);
+                } else {
+                    object->set_indexed(subpath, p_value, r_valid);
+                }
+            }
+            Variant get_value() {
+                return subpath.size() == 1 ? accessor.get(object) : object->get_indexed(subpath);
+            }
+
             PropertyAnim() :
                     owner(nullptr),
                     special(SP_NONE),
@@ -132,6 +145,7 @@ private:
         struct BezierAnim {
 
             Vector<StringName> bezier_property;
+            PropertyAccessor accessor; // caches the setter when bezier_property is a single property
             TrackNodeCache *owner;
             float bezier_accum;
             Object *object;
@@ -628,7 +628,14 @@ bool Tween::_apply_tween_value(InterpolateData &p_data, Variant &value) {
         case TARGETING_PROPERTY: {
             // Simply set the property on the object
             bool valid = false;
-            object->set_indexed(p_data.key, value, &valid);
+            if (p_data.key.size() == 1) {
+                if (p_data.key_accessor.get_property() != p_data.key[0]) {
+                    p_data.key_accessor.set_property(p_data.key[0]);
+                }
+                p_data.key_accessor.set(object, value, &valid);
+            } else {
+                object->set_indexed(p_data.key, value, &valid);
+            }
             return valid;
         }
 
@@ -32,6 +32,7 @@
 
 #include "scene/main/node.h"
 #include "core/list.h"
+#include "core/property_accessor.h"
 
 class GODOT_EXPORT Tween : public Node {
 
@@ -88,6 +89,7 @@ private:
         real_t elapsed;
         ObjectID id;
         Vector<StringName> key;
+        PropertyAccessor key_accessor; // caches the setter of single property keys
         StringName concatenated_key;
         Variant initial_val;
         Variant delta_val;
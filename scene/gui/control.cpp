@@ -74,6 +74,48 @@ void warn_missing_icon(const char* type, const char* icon) {
 #endif
 
 
+struct Control::ThemeCache {
+    struct Key {
+        StringName name;
+        StringName type;
+
+        Key(const StringName &p_name, const StringName &p_type) :
+                name(p_name),
+                type(p_type) {}
+        bool operator==(const Key &p_other) const { return name == p_other.name && type == p_other.type; }
+
+    private:
+        friend eastl::hash<Key>;
+        explicit operator size_t() const {
+            return size_t(name.hash()) * 31 + type.hash();
+        }
+    };
+
+    HashMap<Key, Ref<Texture> > icons;
+    HashMap<Key, Ref<Shader> > shaders;
+    HashMap<Key, Ref<StyleBox> > styles;
+    HashMap<Key, Ref<Font> > fonts;
+    HashMap<Key, Color> colors;
+    HashMap<Key, int> constants;
+    uint32_t theme_version = 0;
+    uint32_t tree_version = 0;
+
+    void clear() {
+        icons.clear();
+        shaders.clear();
+        styles.clear();
+        fonts.clear();
+        colors.clear();
+        constants.clear();
+    }
+};
+
+namespace {
+// Bumped when the owners above a control that has its own theme may have changed. _propagate_theme_changed does
+// not descend into such controls, so all caches are revalidated instead.
+uint32_t s_theme_tree_version = 0;
+} // end of anonymous namespace
+
 IMPL_GDCLASS(Control)
 
 #ifdef TOOLS_ENABLED
@@ -454,7 +496,9 @@ void Control::add_child_notify(Node *p_child) {
     if (!child_c)
         return;
 
-    if (not child_c->data.theme && data.theme_owner) {
+    if (child_c->data.theme) {
+        s_theme_tree_version++; // lookups below the child now continue through our owners
+    } else if (data.theme_owner) {
         _propagate_theme_changed(child_c, data.theme_owner); //need to propagate here, since many controls may require setting up stuff
     }
 }
@@ -465,7 +509,9 @@ void Control::remove_child_notify(Node *p_child) {
     if (!child_c)
         return;
 
-    if (child_c->data.theme_owner && not child_c->data.theme) {
+    if (child_c->data.theme) {
+        s_theme_tree_version++;
+    } else if (child_c->data.theme_owner) {
         _propagate_theme_changed(child_c, nullptr);
     }
 }
@@ -511,6 +557,7 @@ void Control::_notification(int p_notification) {
 
                 if (not data.theme && data.parent && data.parent->data.theme_owner) {
                     data.theme_owner = data.parent->data.theme_owner;
+                    _clear_theme_cache();
                     notification(NOTIFICATION_THEME_CHANGED);
                 }
 
@@ -548,6 +595,7 @@ void Control::_notification(int p_notification) {
                     //do nothing, has a parent control
                     if (not data.theme && parent_control->data.theme_owner) {
                         data.theme_owner = parent_control->data.theme_owner;
+                        _clear_theme_cache();
                         notification(NOTIFICATION_THEME_CHANGED);
                     }
                 } else if (subwindow) {
@@ -835,6 +883,28 @@ Size2 Control::get_minimum_size() const {
     return Size2();
 }
 
+Control::ThemeCache &Control::_get_theme_cache() const {
+
+    if (!data.theme_cache) {
+        data.theme_cache = memnew(ThemeCache);
+    }
+    ThemeCache &cache = *data.theme_cache;
+    uint32_t theme_version = Theme::get_lookup_version();
+    if (cache.theme_version != theme_version || cache.tree_version != s_theme_tree_version) {
+        cache.clear();
+        cache.theme_version = theme_version;
+        cache.tree_version = s_theme_tree_version;
+    }
+    return cache;
+}
+
+void Control::_clear_theme_cache() {
+
+    if (data.theme_cache) {
+        data.theme_cache->clear();
+    }
+}
+
 Ref<Texture> Control::get_theme_icon(const StringName &p_name, const StringName &p_node_type) const {
 
     if (p_node_type.empty() || p_node_type == get_class_name()) {
@@ -846,12 +916,25 @@ Ref<Texture> Control::get_theme_icon(const StringName &p_name, const StringName
 
     StringName type = p_node_type ? p_node_type : get_class_name();
 
+    HashMap<ThemeCache::Key, Ref<Texture> > &cache = _get_theme_cache().icons;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    Ref<Texture> res(_resolve_theme_icon(p_name, type));
+    cache.emplace(key, res);
+    return res;
+}
+
+Ref<Texture> Control::_resolve_theme_icon(const StringName &p_name, const StringName &p_type) const {
+
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
     while (theme_owner) {
 
-        StringName class_name = type;
+        StringName class_name = p_type;
 
         while (class_name != StringName()) {
             if (theme_owner->data.theme->has_icon(p_name, class_name)) {
@@ -872,15 +955,15 @@ Ref<Texture> Control::get_theme_icon(const StringName &p_name, const StringName
     }
 
     if (Theme::get_project_default()) {
-        if (Theme::get_project_default()->has_icon(p_name, type)) {
-            Ref<Texture> res(Theme::get_project_default()->get_icon(p_name, type));
-            WARN_MISSING_ICON(Theme::get_project_default(), res, p_name, type);
+        if (Theme::get_project_default()->has_icon(p_name, p_type)) {
+            Ref<Texture> res(Theme::get_project_default()->get_icon(p_name, p_type));
+            WARN_MISSING_ICON(Theme::get_project_default(), res, p_name, p_type);
             return res;
         }
     }
 
-    Ref<Texture> res(Theme::get_default()->get_icon(p_name, type));
-    WARN_MISSING_ICON(Theme::get_default(), res, p_name, type);
+    Ref<Texture> res(Theme::get_default()->get_icon(p_name, p_type));
+    WARN_MISSING_ICON(Theme::get_default(), res, p_name, p_type);
     return res;
 }
 
@@ -894,12 +977,25 @@ Ref<Shader> Control::get_shader(const StringName &p_name, const StringName &p_no
 
     StringName type = p_node_type ? p_node_type : get_class_name();
 
+    HashMap<ThemeCache::Key, Ref<Shader> > &cache = _get_theme_cache().shaders;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    Ref<Shader> res(_resolve_shader(p_name, type));
+    cache.emplace(key, res);
+    return res;
+}
+
+Ref<Shader> Control::_resolve_shader(const StringName &p_name, const StringName &p_type) const {
+
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
     while (theme_owner) {
 
-        StringName class_name = type;
+        StringName class_name = p_type;
 
         while (class_name != StringName()) {
             if (theme_owner->data.theme->has_shader(p_name, class_name)) {
@@ -918,12 +1014,12 @@ Ref<Shader> Control::get_shader(const StringName &p_name, const StringName &p_no
     }
 
     if (Theme::get_project_default()) {
-        if (Theme::get_project_default()->has_shader(p_name, type)) {
-            return Theme::get_project_default()->get_shader(p_name, type);
+        if (Theme::get_project_default()->has_shader(p_name, p_type)) {
+            return Theme::get_project_default()->get_shader(p_name, p_type);
         }
     }
 
-    return Theme::get_default()->get_shader(p_name, type);
+    return Theme::get_default()->get_shader(p_name, p_type);
 }
 
 Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const StringName &p_node_type) const {
@@ -937,10 +1033,23 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
 
     StringName type = p_node_type ? p_node_type : get_class_name();
 
+    HashMap<ThemeCache::Key, Ref<StyleBox> > &cache = _get_theme_cache().styles;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    Ref<StyleBox> res(_resolve_theme_stylebox(p_name, type));
+    cache.emplace(key, res);
+    return res;
+}
+
+Ref<StyleBox> Control::_resolve_theme_stylebox(const StringName &p_name, const StringName &p_type) const {
+
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
-    StringName class_name = type;
+    StringName class_name = p_type;
 
     while (theme_owner) {
 
@@ -952,7 +1061,7 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
             class_name = ClassDB::get_parent_class_nocheck(class_name);
         }
 
-        class_name = type;
+        class_name = p_type;
 
         Control *parent = object_cast<Control>(theme_owner->get_parent());
 
@@ -963,15 +1072,15 @@ Ref<StyleBox> Control::get_theme_stylebox(const StringName &p_name, const String
     }
 
     while (class_name != StringName()) {
-        if (Theme::get_project_default() && Theme::get_project_default()->has_stylebox(p_name, type))
-            return Theme::get_project_default()->get_stylebox(p_name, type);
+        if (Theme::get_project_default() && Theme::get_project_default()->has_stylebox(p_name, p_type))
+            return Theme::get_project_default()->get_stylebox(p_name, p_type);
 
         if (Theme::get_default()->has_stylebox(p_name, class_name))
             return Theme::get_default()->get_stylebox(p_name, class_name);
 
         class_name = ClassDB::get_parent_class_nocheck(class_name);
     }
-    return Theme::get_default()->get_stylebox(p_name, type);
+    return Theme::get_default()->get_stylebox(p_name, p_type);
 }
 Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_node_type) const {
 
@@ -983,12 +1092,25 @@ Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_
 
     StringName type = p_node_type ? p_node_type : get_class_name();
 
+    HashMap<ThemeCache::Key, Ref<Font> > &cache = _get_theme_cache().fonts;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    Ref<Font> res(_resolve_theme_font(p_name, type));
+    cache.emplace(key, res);
+    return res;
+}
+
+Ref<Font> Control::_resolve_theme_font(const StringName &p_name, const StringName &p_type) const {
+
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
     while (theme_owner) {
 
-        StringName class_name = type;
+        StringName class_name = p_type;
 
         while (class_name != StringName()) {
             if (theme_owner->data.theme->has_font(p_name, class_name)) {
@@ -1008,7 +1130,7 @@ Ref<Font> Control::get_theme_font(const StringName &p_name, const StringName &p_
             theme_owner = nullptr;
     }
 
-    return Theme::get_default()->get_font(p_name, type);
+    return Theme::get_default()->get_font(p_name, p_type);
 }
 Color Control::get_theme_color(const StringName &p_name, const StringName &p_node_type) const {
 
@@ -1019,12 +1141,25 @@ Color Control::get_theme_color(const StringName &p_name, const StringName &p_nod
     }
 
     StringName type = p_node_type ? p_node_type : get_class_name();
+
+    HashMap<ThemeCache::Key, Color> &cache = _get_theme_cache().colors;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    Color res = _resolve_theme_color(p_name, type);
+    cache.emplace(key, res);
+    return res;
+}
+
+Color Control::_resolve_theme_color(const StringName &p_name, const StringName &p_type) const {
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
     while (theme_owner) {
 
-        StringName class_name = type;
+        StringName class_name = p_type;
 
         while (class_name != StringName()) {
             if (theme_owner->data.theme->has_color(p_name, class_name)) {
@@ -1043,11 +1178,11 @@ Color Control::get_theme_color(const StringName &p_name, const StringName &p_nod
     }
 
     if (Theme::get_project_default()) {
-        if (Theme::get_project_default()->has_color(p_name, type)) {
-            return Theme::get_project_default()->get_color(p_name, type);
+        if (Theme::get_project_default()->has_color(p_name, p_type)) {
+            return Theme::get_project_default()->get_color(p_name, p_type);
         }
     }
-    return Theme::get_default()->get_color(p_name, type);
+    return Theme::get_default()->get_color(p_name, p_type);
 }
 
 int Control::get_theme_constant(const StringName &p_name, const StringName &p_node_type) const {
@@ -1059,12 +1194,25 @@ int Control::get_theme_constant(const StringName &p_name, const StringName &p_no
     }
 
     StringName type = p_node_type ? p_node_type : get_class_name();
+
+    HashMap<ThemeCache::Key, int> &cache = _get_theme_cache().constants;
+    ThemeCache::Key key(p_name, type);
+    auto iter = cache.find(key);
+    if (iter != cache.end())
+        return iter->second;
+
+    int res = _resolve_theme_constant(p_name, type);
+    cache.emplace(key, res);
+    return res;
+}
+
+int Control::_resolve_theme_constant(const StringName &p_name, const StringName &p_type) const {
     // try with custom themes
     Control *theme_owner = data.theme_owner;
 
     while (theme_owner) {
 
-        StringName class_name = type;
+        StringName class_name = p_type;
 
         while (class_name != StringName()) {
             if (theme_owner->data.theme->has_constant(p_name, class_name)) {
@@ -1083,11 +1231,11 @@ int Control::get_theme_constant(const StringName &p_name, const StringName &p_no
     }
 
     if (Theme::get_project_default()) {
-        if (Theme::get_project_default()->has_constant(p_name, type)) {
-            return Theme::get_project_default()->get_constant(p_name, type);
+        if (Theme::get_project_default()->has_constant(p_name, p_type)) {
+            return Theme::get_project_default()->get_constant(p_name, p_type);
         }
     }
-    return Theme::get_default()->get_constant(p_name, type);
+    return Theme::get_default()->get_constant(p_name, p_type);
 }
 
 bool Control::has_icon_override(const StringName &p_name) const {
@@ -2262,8 +2410,11 @@ void Control::_propagate_theme_changed(CanvasItem *p_at, Control *p_owner, bool
 
     Control *c = object_cast<Control>(p_at);
 
-    if (c && c != p_owner && c->data.theme) // has a theme, this can't be propagated
+    if (c && c != p_owner && c->data.theme) { // has a theme, this can't be propagated
+        // but lookups below it continue through the owners above it, which may have changed.
+        s_theme_tree_version++;
         return;
+    }
 
     for (int i = 0; i < p_at->get_child_count(); i++) {
 
@@ -2278,6 +2429,7 @@ void Control::_propagate_theme_changed(CanvasItem *p_at, Control *p_owner, bool
         if (p_assign) {
             c->data.theme_owner = p_owner;
         }
+        c->_clear_theme_cache();
         c->notification(NOTIFICATION_THEME_CHANGED);
     }
 }
@@ -3106,6 +3258,7 @@ Control::Control() {
     data.MI = nullptr;
     data.RI = nullptr;
     data.theme_owner = nullptr;
+    data.theme_cache = nullptr;
     data.modal_exclusive = false;
     data.default_cursor = CURSOR_ARROW;
     data.h_size_flags = SIZE_FILL;
@@ -3133,4 +3286,6 @@ Control::Control() {
 }
 
 Control::~Control() {
+
+    memdelete(data.theme_cache);
 }
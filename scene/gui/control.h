@@ -140,6 +140,7 @@ public:
     };
 
 private:
+    struct ThemeCache;
     struct CComparator {
 
         bool operator()(const Control *p_a, const Control *p_b) const {
@@ -170,6 +171,8 @@ private:
 
         Control *parent;
         Control *theme_owner;
+        // resolved theme items, allocated on first lookup.
+        mutable ThemeCache *theme_cache;
 
         Point2 pos_cache;
         Size2 size_cache;
@@ -212,6 +215,15 @@ private:
 
     void _window_find_focus_neighbour(const Vector2 &p_dir, Node *p_at, const Point2 *p_points, float p_min, float &r_closest_dist, Control **r_closest);
     Control *_get_focus_neighbour(Margin p_margin, int p_count = 0);
+
+    ThemeCache &_get_theme_cache() const;
+    void _clear_theme_cache();
+    Ref<Texture> _resolve_theme_icon(const StringName &p_name, const StringName &p_type) const;
+    Ref<Shader> _resolve_shader(const StringName &p_name, const StringName &p_type) const;
+    Ref<StyleBox> _resolve_theme_stylebox(const StringName &p_name, const StringName &p_type) const;
+    Ref<Font> _resolve_theme_font(const StringName &p_name, const StringName &p_type) const;
+    Color _resolve_theme_color(const StringName &p_name, const StringName &p_type) const;
+    int _resolve_theme_constant(const StringName &p_name, const StringName &p_type) const;
 public:
     void _set_anchor(Margin p_margin, float p_anchor);
     void _set_position(const Point2 &p_point);
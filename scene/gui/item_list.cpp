@@ -87,6 +87,7 @@ void ItemList::set_item_text(int p_idx, const StringName &p_text) {
     ERR_FAIL_INDEX(p_idx, items.size());
 
     items[p_idx].text = p_text;
+    items[p_idx].measured_version = 0;
     update();
     shape_changed = true;
 }
@@ -135,6 +136,7 @@ void ItemList::set_item_icon(int p_idx, const Ref<Texture> &p_icon) {
     ERR_FAIL_INDEX(p_idx, items.size());
 
     items[p_idx].icon = p_icon;
+    items[p_idx].measured_version = 0;
     update();
     shape_changed = true;
 }
@@ -151,6 +153,7 @@ void ItemList::set_item_icon_transposed(int p_idx, const bool p_transposed) {
     ERR_FAIL_INDEX(p_idx, items.size());
 
     items[p_idx].icon_transposed = p_transposed;
+    items[p_idx].measured_version = 0;
     update();
     shape_changed = true;
 }
@@ -167,6 +170,7 @@ void ItemList::set_item_icon_region(int p_idx, const Rect2 &p_region) {
     ERR_FAIL_INDEX(p_idx, items.size());
 
     items[p_idx].icon_region = p_region;
+    items[p_idx].measured_version = 0;
     update();
     shape_changed = true;
 }
@@ -395,8 +399,7 @@ void ItemList::set_fixed_column_width(int p_size) {
 
     ERR_FAIL_COND(p_size < 0);
     fixed_column_width = p_size;
-    update();
-    shape_changed = true;
+    _invalidate_item_sizes();
 }
 int ItemList::get_fixed_column_width() const {
 
@@ -418,8 +421,7 @@ void ItemList::set_max_text_lines(int p_lines) {
 
     ERR_FAIL_COND(p_lines < 1);
     max_text_lines = p_lines;
-    update();
-    shape_changed = true;
+    _invalidate_item_sizes();
 }
 int ItemList::get_max_text_lines() const {
 
@@ -453,8 +455,7 @@ void ItemList::set_icon_mode(IconMode p_mode) {
 
     ERR_FAIL_INDEX((int)p_mode, int(ICON_MODE_MAX));
     icon_mode = p_mode;
-    update();
-    shape_changed = true;
+    _invalidate_item_sizes();
 }
 
 ItemList::IconMode ItemList::get_icon_mode() const {
@@ -465,13 +466,43 @@ ItemList::IconMode ItemList::get_icon_mode() const {
 void ItemList::set_fixed_icon_size(const Size2 &p_size) {
 
     fixed_icon_size = p_size;
-    update();
+    _invalidate_item_sizes();
 }
 
 Size2 ItemList::get_fixed_icon_size() const {
 
     return fixed_icon_size;
 }
+
+void ItemList::_invalidate_item_sizes() {
+
+    // items are measured again on the next draw, ones that were never measured have version 0.
+    measure_version++;
+    shape_changed = true;
+    update();
+}
+
+int ItemList::_find_first_item_below(float p_y) const {
+
+    // do a binary search to find the first item whose rect reaches below p_y
+    int lo = 0;
+    int hi = items.size();
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        const Rect2 &rcache = items[mid].rect_cache;
+        if (rcache.position.y + rcache.size.y < p_y) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    // we might have ended up with column 2, or 3, ..., so let's find the first column
+    while (lo > 0 && lo < int(items.size()) && items[lo - 1].rect_cache.position.y == items[lo].rect_cache.position.y) {
+        lo -= 1;
+    }
+    return lo;
+}
+
 Size2 ItemList::Item::get_icon_size() const {
 
     if (not icon)
@@ -838,6 +869,10 @@ void ItemList::_notification(int p_what) {
         update();
     }
 
+    if (p_what == NOTIFICATION_THEME_CHANGED) {
+        _invalidate_item_sizes();
+    }
+
     if (p_what == NOTIFICATION_DRAW) {
 
         Ref<StyleBox> bg = get_theme_stylebox("bg");
@@ -888,9 +923,15 @@ void ItemList::_notification(int p_what) {
 
             float max_column_width = 0;
 
-            //1- compute item minimum sizes
+            //1- compute item minimum sizes, only items that changed since the last pass are measured again
             for (int i = 0; i < items.size(); i++) {
 
+                if (items[i].measured_version == measure_version) {
+                    items[i].rect_cache.size = items[i].min_rect_cache.size;
+                    max_column_width = M_MAX(max_column_width, items[i].min_rect_cache.size.x - hseparation);
+                    continue;
+                }
+
                 Size2 minsize;
                 if (items[i].icon) {
 
@@ -937,6 +978,7 @@ void ItemList::_notification(int p_what) {
                 minsize.x += hseparation;
                 items[i].rect_cache.size = minsize;
                 items[i].min_rect_cache.size = minsize;
+                items[i].measured_version = measure_version;
             }
 
             int fit_size = size.x - bg->get_minimum_size().width - mw;
@@ -1033,26 +1075,7 @@ void ItemList::_notification(int p_what) {
 
         const Rect2 clip(-base_ofs, size); // visible frame, don't need to draw outside of there
 
-        int first_item_visible;
-        {
-            // do a binary search to find the first item whose rect reaches below clip.position.y
-            int lo = 0;
-            int hi = items.size();
-            while (lo < hi) {
-                const int mid = (lo + hi) / 2;
-                const Rect2 &rcache = items[mid].rect_cache;
-                if (rcache.position.y + rcache.size.y < clip.position.y) {
-                    lo = mid + 1;
-                } else {
-                    hi = mid;
-                }
-            }
-            // we might have ended up with column 2, or 3, ..., so let's find the first column
-            while (lo > 0 && items[lo - 1].rect_cache.position.y == items[lo].rect_cache.position.y) {
-                lo -= 1;
-            }
-            first_item_visible = lo;
-        }
+        const int first_item_visible = _find_first_item_below(clip.position.y);
 
         for (int i = first_item_visible; i < items.size(); i++) {
 
@@ -1278,23 +1301,36 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
     pos -= bg->get_offset();
     pos.y += scroll_bar->get_value();
 
-    int closest = -1;
-    int closest_dist = 0x7FFFFFFF;
+    // only the rows around the position can contain it, start one row above it. Positions past the laid out rows
+    // are clamped to the last row.
+    int from = _find_first_item_below(pos.y);
+    if (from > 0) {
+        from = _find_first_item_below(items[from - 1].rect_cache.position.y);
+    }
+    int rows = 0;
 
-    for (int i = 0; i < items.size(); i++) {
+    for (int i = from; i < items.size(); i++) {
 
-        Rect2 rc = items[i].rect_cache;
-        if (i % current_columns == current_columns - 1) {
-            rc.size.width = get_size().width - rc.position.x; //make sure you can still select the last item when clicking past the column
+        if (i > from && items[i].rect_cache.position.y != items[i - 1].rect_cache.position.y && ++rows > 2) {
+            break;
         }
 
-        if (rc.has_point(pos)) {
-            closest = i;
-            break;
+        if (_get_item_hit_rect(i).has_point(pos)) {
+            return i;
         }
+    }
 
-        float dist = rc.distance_to(pos);
-        if (!p_exact && dist < closest_dist) {
+    if (p_exact) {
+        return -1;
+    }
+
+    // nothing under the position, the closest item can be in any row of a partially filled grid.
+    int closest = -1;
+    int closest_dist = 0x7FFFFFFF;
+    for (int i = 0; i < items.size(); i++) {
+
+        float dist = _get_item_hit_rect(i).distance_to(pos);
+        if (dist < closest_dist) {
             closest = i;
             closest_dist = dist;
         }
@@ -1303,6 +1339,15 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
     return closest;
 }
 
+Rect2 ItemList::_get_item_hit_rect(int p_idx) const {
+
+    Rect2 rc = items[p_idx].rect_cache;
+    if (p_idx % current_columns == current_columns - 1) {
+        rc.size.width = get_size().width - rc.position.x; //make sure you can still select the last item when clicking past the column
+    }
+    return rc;
+}
+
 bool ItemList::is_pos_at_end_of_items(const Point2 &p_pos) const {
 
     if (items.empty())
@@ -1385,6 +1430,7 @@ bool ItemList::get_allow_reselect() const {
 
 void ItemList::set_icon_scale(real_t p_scale) {
     icon_scale = p_scale;
+    _invalidate_item_sizes();
 }
 
 real_t ItemList::get_icon_scale() const {
@@ -1621,6 +1667,7 @@ ItemList::ItemList() {
     add_child(scroll_bar);
 
     shape_changed = true;
+    measure_version = 1;
     scroll_bar->connect("value_changed",callable_mp(this, &ClassName::_scroll_changed));
 
     set_focus_mode(FOCUS_ALL);
@@ -70,6 +70,7 @@ private:
 
         Rect2 rect_cache;
         Rect2 min_rect_cache;
+        uint32_t measured_version = 0; // min_rect_cache.size is valid while this matches ItemList::measure_version
 
         Size2 get_icon_size() const;
 
@@ -79,6 +80,7 @@ private:
     int current;
 
     bool shape_changed;
+    uint32_t measure_version;
 
     bool ensure_selected_visible;
     bool same_column_width;
@@ -114,6 +116,10 @@ private:
     real_t icon_scale;
 
     bool do_autoscroll_to_bottom;
+
+    void _invalidate_item_sizes();
+    int _find_first_item_below(float p_y) const;
+    Rect2 _get_item_hit_rect(int p_idx) const;
 public:
     Array _get_items() const;
     void _set_items(const Array &p_items);
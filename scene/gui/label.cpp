@@ -167,6 +167,12 @@ void Label::_notification(int p_what) {
         int line = 0;
         int line_to = lines_skipped + (lines_visible > 0 ? lines_visible : 1);
         FontDrawer drawer(font, font_outline_modulate);
+        // per character drawing is only needed to cut words at visible_characters, to draw shadows, and for fonts
+        // that would draw the word glyph by glyph anyway. Outlined fonts stay per character too: a run draws its
+        // outline right before its glyphs, so the outline of the next word would cover the previous one.
+        const bool batch_words = visible_chars < 0 && font_color_shadow.a <= 0 && font->caches_text_runs() && !font->has_outline();
+        // word cache positions count characters, not utf8 bytes.
+        const UIString ui_text = batch_words ? StringUtils::from_utf8(xltext) : UIString();
         while (wc) {
             /* handle lines not meant to be drawn quickly */
             if (line >= line_to)
@@ -247,6 +253,19 @@ void Label::_notification(int p_what) {
                     }
                 }
 
+                if (batch_words) {
+                    // whole words go through the font's run cache, a few canvas commands per word.
+                    UIString word = StringUtils::substr(ui_text, pos, from->word_len);
+                    if (uppercase) {
+                        for (int i = 0; i < word.length(); i++) {
+                            word[i] = StringUtils::char_uppercase(word[i]);
+                        }
+                    }
+                    x_ofs += font->draw_ui_string_run(ci, Point2(x_ofs, y_ofs), word, font_color, -1, font_outline_modulate);
+                    from = from->next;
+                    continue;
+                }
+
                 if (font_color_shadow.a > 0) {
 
                     int chars_total_shadow = chars_total; //save chars drawn
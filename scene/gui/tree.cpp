@@ -72,6 +72,7 @@ void TreeItem::move_to_top() {
     prev->next = next;
     next = parent->children;
     parent->children = this;
+    parent->_invalidate_layout();
 }
 
 void TreeItem::move_to_bottom() {
@@ -90,6 +91,7 @@ void TreeItem::move_to_bottom() {
     }
     last->next = this;
     next = nullptr;
+    parent->_invalidate_layout();
 }
 
 Size2 TreeItem::Cell::get_icon_size() const {
@@ -128,6 +130,14 @@ void TreeItem::_changed_notify() {
     tree->item_changed(-1, this);
 }
 
+void TreeItem::_invalidate_layout() {
+
+    // ancestors of an invalid item are invalid already, so the walk can stop there.
+    for (TreeItem *it = this; it && it->layout_height >= 0; it = it->parent) {
+        it->layout_height = -1;
+    }
+}
+
 void TreeItem::_cell_selected(int p_cell) {
 
     tree->item_selected(p_cell, this);
@@ -152,6 +162,7 @@ void TreeItem::set_cell_mode(int p_column, TreeCellMode p_mode) {
     c.icon = Ref<Texture>();
     c.text = "";
     c.icon_max_w = 0;
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -232,6 +243,7 @@ void TreeItem::set_icon(int p_column, const Ref<Texture> &p_icon) {
 
     ERR_FAIL_INDEX(p_column, cells.size());
     cells[p_column].icon = p_icon;
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -245,6 +257,7 @@ void TreeItem::set_icon_region(int p_column, const Rect2 &p_icon_region) {
 
     ERR_FAIL_INDEX(p_column, cells.size());
     cells[p_column].icon_region = p_icon_region;
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -271,6 +284,7 @@ void TreeItem::set_icon_max_width(int p_column, int p_max) {
 
     ERR_FAIL_INDEX(p_column, cells.size());
     cells[p_column].icon_max_w = p_max;
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -350,6 +364,24 @@ void TreeItem::set_collapsed(bool p_collapsed) {
     if (collapsed == p_collapsed || !tree)
         return;
     collapsed = p_collapsed;
+    _invalidate_layout();
+
+    if (!collapsed && lazy_children) {
+        lazy_children = false;
+        if (tree->blocked > 0) {
+            // items can't be created while mouse events are being propagated.
+            Tree *t = tree;
+            ObjectID id = get_instance_id();
+            tree->call_deferred([t, id]() {
+                TreeItem *item = object_cast<TreeItem>(ObjectDB::get_instance(id));
+                if (item) {
+                    t->emit_signal("item_populate", Variant(item));
+                }
+            });
+        } else {
+            tree->emit_signal("item_populate", Variant(this));
+        }
+    }
     TreeItem *ci = tree->selected_item;
     if (ci) {
 
@@ -383,6 +415,7 @@ bool TreeItem::is_collapsed() {
 
 void TreeItem::set_custom_minimum_height(int p_height) {
     custom_min_height = p_height;
+    _invalidate_layout();
     _changed_notify();
 }
 
@@ -390,6 +423,19 @@ int TreeItem::get_custom_minimum_height() const {
     return custom_min_height;
 }
 
+void TreeItem::set_lazy_children(bool p_lazy) {
+
+    if (lazy_children == p_lazy)
+        return;
+    lazy_children = p_lazy;
+    _changed_notify();
+}
+
+bool TreeItem::has_lazy_children() const {
+
+    return lazy_children;
+}
+
 TreeItem *TreeItem::get_next() {
 
     return next;
@@ -500,6 +546,7 @@ void TreeItem::remove_child(TreeItem *p_item) {
             *c = (*c)->next;
 
             aux->parent = nullptr;
+            _invalidate_layout();
             return;
         }
 
@@ -563,6 +610,7 @@ void TreeItem::add_button(int p_column, const Ref<Texture> &p_button, int p_id,
     button.disabled = p_disabled;
     button.tooltip = p_tooltip;
     cells[p_column].buttons.push_back(button);
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -593,6 +641,7 @@ void TreeItem::erase_button(int p_column, int p_idx) {
     ERR_FAIL_INDEX(p_column, cells.size());
     ERR_FAIL_INDEX(p_idx, cells[p_column].buttons.size());
     cells[p_column].buttons.erase_at(p_idx);
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -614,6 +663,7 @@ void TreeItem::set_button(int p_column, int p_idx, const Ref<Texture> &p_button)
     ERR_FAIL_INDEX(p_column, cells.size());
     ERR_FAIL_INDEX(p_idx, cells[p_column].buttons.size());
     cells[p_column].buttons[p_idx].texture = p_button;
+    _invalidate_layout();
     _changed_notify(p_column);
 }
 
@@ -718,6 +768,7 @@ void TreeItem::set_custom_as_button(int p_column, bool p_button) {
 
     ERR_FAIL_INDEX(p_column, cells.size());
     cells[p_column].custom_button = p_button;
+    _invalidate_layout();
 }
 
 bool TreeItem::is_custom_set_as_button(int p_column) const {
@@ -838,6 +889,9 @@ void TreeItem::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("set_custom_minimum_height", {"height"}), &TreeItem::set_custom_minimum_height);
     MethodBinder::bind_method(D_METHOD("get_custom_minimum_height"), &TreeItem::get_custom_minimum_height);
 
+    MethodBinder::bind_method(D_METHOD("set_lazy_children", {"enable"}), &TreeItem::set_lazy_children);
+    MethodBinder::bind_method(D_METHOD("has_lazy_children"), &TreeItem::has_lazy_children);
+
     MethodBinder::bind_method(D_METHOD("get_next"), &TreeItem::get_next);
     MethodBinder::bind_method(D_METHOD("get_prev"), &TreeItem::get_prev);
     MethodBinder::bind_method(D_METHOD("get_parent"), &TreeItem::get_parent);
@@ -898,6 +952,7 @@ void TreeItem::_bind_methods() {
     }
     ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "collapsed"), "set_collapsed", "is_collapsed");
     ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "disable_folding"), "set_disable_folding", "is_folding_disabled");
+    ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "lazy_children"), "set_lazy_children", "has_lazy_children");
     ADD_PROPERTY(PropertyInfo(VariantType::INT, "custom_minimum_height", PropertyHint::Range, "0,1000,1"), "set_custom_minimum_height", "get_custom_minimum_height");
 
     BIND_ENUM_CONSTANT(CELL_MODE_STRING);
@@ -935,6 +990,7 @@ void TreeItem::clear_children() {
     }
 
     children = nullptr;
+    _invalidate_layout();
 }
 
 TreeItem::TreeItem(Tree *p_tree) {
@@ -942,7 +998,12 @@ TreeItem::TreeItem(Tree *p_tree) {
     tree = p_tree;
     collapsed = false;
     disable_folding = false;
+    lazy_children = false;
     custom_min_height = 0;
+    layout_row_height = 0;
+    layout_height = -1;
+    layout_index = 0;
+    layout_version = 0;
 
     parent = nullptr; // parent item
     next = nullptr; // next in list
@@ -1035,6 +1096,20 @@ void Tree::update_cache() {
     cache.title_button_color = get_theme_color("title_button_color");
 
     v_scroll->set_custom_step(cache.font->get_height());
+
+    // cached row heights depend on these.
+    const int row_metrics[4] = {
+        cache.font->get_height(),
+        cache.vseparation,
+        cache.checked ? cache.checked->get_height() : 0,
+        cache.custom_button ? int(cache.custom_button->get_minimum_size().height) : 0,
+    };
+    for (int i = 0; i < 4; i++) {
+        if (cache.row_metrics[i] != row_metrics[i]) {
+            cache.row_metrics[i] = row_metrics[i];
+            _invalidate_layouts();
+        }
+    }
 }
 
 int Tree::compute_item_height(TreeItem *p_item) const {
@@ -1098,24 +1173,67 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 
 int Tree::get_item_height(TreeItem *p_item) const {
 
-    int height = compute_item_height(p_item);
-    height += cache.vseparation;
+    return _update_item_layout(p_item);
+}
 
-    if (!p_item->collapsed) { /* if not collapsed, check the children */
+int Tree::_update_item_layout(TreeItem *p_item) const {
 
-        TreeItem *c = p_item->children;
+    if (p_item->layout_height >= 0 && p_item->layout_version == layout_version)
+        return p_item->layout_height;
 
-        while (c) {
+    int row_height = (p_item == root && hide_root) ? 0 : compute_item_height(p_item) + cache.vseparation;
+    int height = row_height;
 
-            height += get_item_height(c);
+    p_item->layout_children.clear();
+    p_item->layout_offsets.clear();
 
-            c = c->next;
+    if (!p_item->collapsed && p_item->children) { /* if not collapsed, add the children */
+
+        int ofs = 0;
+        for (TreeItem *c = p_item->children; c; c = c->next) {
+
+            c->layout_index = int(p_item->layout_children.size());
+            p_item->layout_children.push_back(c);
+            p_item->layout_offsets.push_back(ofs);
+            ofs += _update_item_layout(c);
         }
+        p_item->layout_offsets.push_back(ofs);
+        height += ofs;
+    } else {
+        // nothing to index, don't keep the memory around for folded items.
+        p_item->layout_children.set_capacity(0);
+        p_item->layout_offsets.set_capacity(0);
     }
 
+    p_item->layout_row_height = row_height;
+    p_item->layout_height = height;
+    p_item->layout_version = layout_version;
     return height;
 }
 
+int Tree::_find_layout_child(const TreeItem *p_item, int p_offset) const {
+
+    // binary search for the first child whose subtree ends below p_offset, offsets are relative to the first child.
+    const Vector<int> &offsets = p_item->layout_offsets;
+    int lo = 0;
+    int hi = p_item->layout_children.size();
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (offsets[mid + 1] <= p_offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+void Tree::_invalidate_layouts() {
+
+    layout_version++;
+    update();
+}
+
 void Tree::draw_item_rect(const TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color) {
 
     ERR_FAIL_COND(not cache.font);
@@ -1175,10 +1293,8 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 
     int htotal = 0;
 
-    int label_h = compute_item_height(p_item);
-
-    /* Calculate height of the label part */
-    label_h += cache.vseparation;
+    _update_item_layout(p_item);
+    int label_h = p_item->layout_row_height;
 
     /* Draw label, if height fits */
 
@@ -1519,7 +1635,7 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
             }
         }
 
-        if (!p_item->disable_folding && !hide_folding && p_item->children) { //has children, draw the guide box
+        if (!p_item->disable_folding && !hide_folding && p_item->_has_foldable_children()) { //has children, draw the guide box
 
             Ref<Texture> arrow;
 
@@ -1544,11 +1660,19 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 
     if (!p_item->collapsed) { /* if not collapsed, check the children */
 
-        TreeItem *c = p_item->children;
-
         int prev_ofs = children_pos.y - cache.offset.y + p_draw_ofs.y;
 
-        while (c) {
+        // skip the children that end above the visible area, the relationship line from prev_ofs still covers them.
+        const int child_count = p_item->layout_children.size();
+        const int first = _find_layout_child(p_item, cache.offset.y - children_pos.y);
+        if (first > 0) {
+            children_pos.y += p_item->layout_offsets[first];
+            htotal += p_item->layout_offsets[first];
+        }
+
+        for (int idx = first; idx < child_count; idx++) {
+
+            TreeItem *c = p_item->layout_children[idx];
 
             if (cache.draw_relationship_lines > 0 && (!hide_root || c->parent != root)) {
                 int root_ofs = children_pos.x + ((p_item->disable_folding || hide_folding) ? cache.hseparation : cache.item_margin);
@@ -1591,8 +1715,6 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
                     children_pos.y += child_h;
                 }
             }
-
-            c = c->next;
         }
     }
 
@@ -1760,6 +1882,7 @@ void Tree::_range_click_timeout() {
 
 int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, bool p_doubleclick, TreeItem *p_item, int p_button, const Ref<InputEventWithModifiers> &p_mod) {
 
+    _update_item_layout(p_item);
     int item_h = compute_item_height(p_item) + cache.vseparation;
 
     bool skip = (p_item == root && hide_root);
@@ -1773,7 +1896,7 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, bool
 
         if (!p_item->disable_folding && !hide_folding && (p_pos.x >= x_ofs && p_pos.x < (x_ofs + cache.item_margin))) {
 
-            if (p_item->children)
+            if (p_item->_has_foldable_children())
                 p_item->set_collapsed(!p_item->is_collapsed());
 
             return -1; //handled!
@@ -2079,10 +2202,19 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, bool
 
         if (!p_item->collapsed) { /* if not collapsed, check the children */
 
-            TreeItem *c = p_item->children;
+            // children ending above the event can't handle it.
+            const int child_count = p_item->layout_children.size();
+            const int first = _find_layout_child(p_item, new_pos.y);
+            if (first > 0) {
+                const int skipped = p_item->layout_offsets[first];
+                new_pos.y -= skipped;
+                y_ofs += skipped;
+                item_h += skipped;
+            }
 
-            while (c) {
+            for (int idx = first; idx < child_count; idx++) {
 
+                TreeItem *c = p_item->layout_children[idx];
                 int child_h = propagate_mouse_event(new_pos, x_ofs, y_ofs, p_doubleclick, c, p_button, p_mod);
 
                 if (child_h < 0)
@@ -2090,7 +2222,6 @@ int Tree::propagate_mouse_event(const Point2i &p_pos, int x_ofs, int y_ofs, bool
 
                 new_pos.y -= child_h;
                 y_ofs += child_h;
-                c = c->next;
                 item_h += child_h;
             }
         }
@@ -2188,7 +2319,7 @@ void Tree::popup_select(int p_option) {
 
 void Tree::_go_left() {
     if (selected_col == 0) {
-        if (selected_item->get_children() != nullptr && !selected_item->is_collapsed()) {
+        if (selected_item->_has_foldable_children() && !selected_item->is_collapsed()) {
             selected_item->set_collapsed(true);
         } else {
             if (columns.size() == 1) { // goto parent with one column
@@ -2217,7 +2348,7 @@ void Tree::_go_left() {
 
 void Tree::_go_right() {
     if (selected_col == (columns.size() - 1)) {
-        if (selected_item->get_children() != nullptr && selected_item->is_collapsed()) {
+        if (selected_item->_has_foldable_children() && selected_item->is_collapsed()) {
             selected_item->set_collapsed(false);
         } else if (selected_item->get_next_visible()) {
             selected_col = 0;
@@ -3180,6 +3311,7 @@ TreeItem *Tree::create_item(TreeItem *p_parent, int p_idx) {
         else
             p_parent->children = ti;
         ti->parent = p_parent;
+        p_parent->_invalidate_layout();
 
     } else {
 
@@ -3317,6 +3449,8 @@ void Tree::clear() {
 void Tree::set_hide_root(bool p_enabled) {
 
     hide_root = p_enabled;
+    if (root)
+        root->_invalidate_layout();
     update();
 }
 
@@ -3461,7 +3595,7 @@ void Tree::set_columns(int p_columns) {
         propagate_set_columns(root);
     if (selected_col >= p_columns)
         selected_col = p_columns - 1;
-    update();
+    _invalidate_layouts();
 }
 
 int Tree::get_columns() const {
@@ -3481,42 +3615,27 @@ Rect2 Tree::get_custom_popup_rect() const {
 
 int Tree::get_item_offset(TreeItem *p_item) const {
 
-    TreeItem *it = root;
-    int ofs = _get_title_button_height();
-    if (!it)
+    if (!root || !p_item)
         return 0;
 
-    while (true) {
-
-        if (it == p_item)
-            return ofs;
-
-        ofs += compute_item_height(it);
-        if (it != root || !hide_root) {
-            ofs += cache.vseparation;
-        }
-
-        if (it->children && !it->collapsed) {
-
-            it = it->children;
-
-        } else if (it->next) {
-
-            it = it->next;
-        } else {
+    // only items in this tree with no collapsed ancestor have a valid layout.
+    TreeItem *it = p_item;
+    while (it->parent) {
+        it = it->parent;
+        if (it->collapsed)
+            return 0;
+    }
+    if (it != root)
+        return 0;
 
-            while (!it->next) {
+    _update_item_layout(root);
 
-                it = it->parent;
-                if (it == nullptr)
-                    return 0;
-            }
-
-            it = it->next;
-        }
+    int ofs = _get_title_button_height();
+    for (it = p_item; it->parent; it = it->parent) {
+        ofs += it->parent->layout_row_height + it->parent->layout_offsets[it->layout_index];
     }
 
-    return -1; //not found
+    return ofs;
 }
 
 void Tree::ensure_cursor_is_visible() {
@@ -3731,9 +3850,11 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
 
     Point2 pos = p_pos;
 
+    _update_item_layout(p_item);
+
     if (root != p_item || !hide_root) {
 
-        h = compute_item_height(p_item) + cache.vseparation;
+        h = p_item->layout_row_height;
         if (pos.y < h) {
 
             if (drop_mode_flags == DROP_MODE_ON_ITEM) {
@@ -3772,19 +3893,17 @@ TreeItem *Tree::_find_item_at_pos(TreeItem *p_item, const Point2 &p_pos, int &r_
     if (p_item->is_collapsed())
         return nullptr; // do not try children, it's collapsed
 
-    TreeItem *n = p_item->get_children();
-    while (n) {
-
-        int ch;
-        TreeItem *r = _find_item_at_pos(n, pos, r_column, ch, section);
-        pos.y -= ch;
-        h += ch;
-        if (r)
-            return r;
-        n = n->get_next();
+    // only the child whose subtree spans the position can contain it.
+    const int idx = _find_layout_child(p_item, pos.y);
+    if (idx >= int(p_item->layout_children.size())) {
+        h = p_item->layout_height;
+        return nullptr;
     }
 
-    return nullptr;
+    int ch;
+    pos.y -= p_item->layout_offsets[idx];
+    h += p_item->layout_offsets[idx];
+    return _find_item_at_pos(p_item->layout_children[idx], pos, r_column, ch, section);
 }
 
 int Tree::get_column_at_position(const Point2 &p_pos) const {
@@ -4092,6 +4211,7 @@ void Tree::_bind_methods() {
     ADD_SIGNAL(MethodInfo("item_custom_button_pressed"));
     ADD_SIGNAL(MethodInfo("item_double_clicked"));
     ADD_SIGNAL(MethodInfo("item_collapsed", PropertyInfo(VariantType::OBJECT, "item", PropertyHint::ResourceType, "TreeItem")));
+    ADD_SIGNAL(MethodInfo("item_populate", PropertyInfo(VariantType::OBJECT, "item", PropertyHint::ResourceType, "TreeItem")));
     //ADD_SIGNAL( MethodInfo("item_doubleclicked" ) );
     ADD_SIGNAL(MethodInfo("button_pressed", PropertyInfo(VariantType::OBJECT, "item", PropertyHint::ResourceType, "TreeItem"), PropertyInfo(VariantType::INT, "column"), PropertyInfo(VariantType::INT, "id")));
     ADD_SIGNAL(MethodInfo("custom_popup_edited", PropertyInfo(VariantType::BOOL, "arrow_clicked")));
@@ -4118,6 +4238,7 @@ Tree::Tree() {
     edited_col = -1;
 
     hide_root = false;
+    layout_version = 1;
     select_mode = SELECT_SINGLE;
     root = nullptr;
     popup_menu = nullptr;
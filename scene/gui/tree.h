@@ -130,6 +130,7 @@ private:
 
     bool collapsed; // won't show children
     bool disable_folding;
+    bool lazy_children; // shows as foldable, children are created by the "item_populate" handler
     int custom_min_height;
 
     TreeItem *parent; // parent item
@@ -137,10 +138,20 @@ private:
     TreeItem *children; //child items
     Tree *tree; //tree (for reference)
 
+    // Layout cache maintained by Tree::_update_item_layout.
+    Vector<TreeItem *> layout_children; // visible children, indexable for binary searches
+    Vector<int> layout_offsets; // offset of each visible child from the first one, followed by their total height
+    int layout_row_height;
+    int layout_height; // row plus visible children, -1 when it has to be recomputed
+    int layout_index; // position in parent's layout_children
+    uint32_t layout_version;
+
     TreeItem(Tree *p_tree);
 
     void _changed_notify(int p_cell);
     void _changed_notify();
+    void _invalidate_layout();
+    bool _has_foldable_children() const { return children || lazy_children; }
     void _cell_selected(int p_cell);
     void _cell_deselected(int p_cell);
 
@@ -212,6 +223,9 @@ public:
     void set_custom_minimum_height(int p_height);
     int get_custom_minimum_height() const;
 
+    void set_lazy_children(bool p_lazy);
+    bool has_lazy_children() const;
+
     TreeItem *get_prev();
     TreeItem *get_next();
     TreeItem *get_parent();
@@ -349,8 +363,13 @@ private:
     bool range_up_last;
     void _range_click_timeout();
 
+    uint32_t layout_version;
+
     int compute_item_height(TreeItem *p_item) const;
     int get_item_height(TreeItem *p_item) const;
+    int _update_item_layout(TreeItem *p_item) const;
+    int _find_layout_child(const TreeItem *p_item, int p_offset) const;
+    void _invalidate_layouts();
     //void draw_item_text(String p_text,const Ref<Texture>& p_icon,int p_icon_max_w,bool p_tool,Rect2i p_rect,const Color& p_color);
     void draw_item_rect(const TreeItem::Cell &p_cell, const Rect2i &p_rect, const Color &p_color, const Color &p_icon_color);
     int draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2 &p_draw_size, TreeItem *p_item);
@@ -438,6 +457,8 @@ private:
         ClickType click_type=Cache::CLICK_NONE;
         ClickType hover_type=Cache::CLICK_NONE;
 
+        int row_metrics[4] = {}; // theme values row heights were computed with
+
     } cache;
 
     int _get_title_button_height() const;
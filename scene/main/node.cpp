@@ -120,6 +120,8 @@ struct Node::PrivData {
 
     uint8_t physics_process_internal: 1;
     uint8_t idle_process_internal: 1;
+    // processing callbacks of this node can run concurrently with other thread-safe nodes of the same priority
+    uint8_t process_thread_safe: 1;
 
     uint8_t input: 1;
     uint8_t unhandled_input: 1;
@@ -965,6 +967,14 @@ bool Node::is_processing_internal() const {
     return priv_data->idle_process_internal;
 }
 
+void Node::set_process_thread_safe(bool p_enable) {
+    priv_data->process_thread_safe = p_enable;
+}
+
+bool Node::is_process_thread_safe() const {
+    return priv_data->process_thread_safe;
+}
+
 void Node::set_process_priority(int p_priority) {
     process_priority = p_priority;
 
@@ -1055,6 +1065,11 @@ void Node::_set_name_nocheck(const StringName &p_name) {
     priv_data->name = p_name;
 }
 
+void Node::_reserve_children(int p_count) {
+
+    priv_data->children.reserve(priv_data->children.size() + p_count);
+}
+
 const char *Node::invalid_character(". : @ / \"");
 //TODO: SEGS: validate_node_name should do what it's named after, not modify the passed name
 bool Node::_validate_node_name(String &p_name) {
@@ -2837,6 +2852,8 @@ void Node::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("set_process_priority", {"priority"}), &Node::set_process_priority);
     MethodBinder::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
     MethodBinder::bind_method(D_METHOD("is_processing"), &Node::is_processing);
+    MethodBinder::bind_method(D_METHOD("set_process_thread_safe", {"enable"}), &Node::set_process_thread_safe);
+    MethodBinder::bind_method(D_METHOD("is_process_thread_safe"), &Node::is_process_thread_safe);
     MethodBinder::bind_method(D_METHOD("set_process_input", {"enable"}), &Node::set_process_input);
     MethodBinder::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
     MethodBinder::bind_method(D_METHOD("set_process_unhandled_input", {"enable"}), &Node::set_process_unhandled_input);
@@ -2977,6 +2994,7 @@ void Node::_bind_methods() {
     ADD_PROPERTY(PropertyInfo(VariantType::OBJECT, "multiplayer", PropertyHint::ResourceType, "MultiplayerAPI", 0), "", "get_multiplayer");
     ADD_PROPERTY(PropertyInfo(VariantType::OBJECT, "custom_multiplayer", PropertyHint::ResourceType, "MultiplayerAPI", 0), "set_custom_multiplayer", "get_custom_multiplayer");
     ADD_PROPERTY(PropertyInfo(VariantType::INT, "process_priority"), "set_process_priority", "get_process_priority");
+    ADD_PROPERTY(PropertyInfo(VariantType::BOOL, "process_thread_safe"), "set_process_thread_safe", "is_process_thread_safe");
 
 
     BIND_VMETHOD(MethodInfo("_process", PropertyInfo(VariantType::FLOAT, "delta")));
@@ -3003,6 +3021,7 @@ Node::Node() {
     process_priority = 0;
     priv_data->physics_process_internal = false;
     priv_data->idle_process_internal = false;
+    priv_data->process_thread_safe = false;
     inside_tree = false;
     priv_data->ready_notified = false;
 
@@ -175,6 +175,7 @@ protected:
     void _add_child_nocheck(Node *p_child, const StringName &p_name);
     void _set_owner_nocheck(Node *p_owner);
     void _set_name_nocheck(const StringName &p_name);
+    void _reserve_children(int p_count);
 
 public:
     enum NodeNotification {
@@ -304,6 +305,12 @@ public:
     void set_process_priority(int p_priority);
     int get_process_priority() const { return process_priority; }
 
+    // Opt-in: _process/_physics_process of this node may run on worker threads, concurrently with other
+    // thread-safe nodes of equal process priority. Such nodes must only touch their own state, and mutate
+    // anything else through call_deferred/queue_free.
+    void set_process_thread_safe(bool p_enable);
+    bool is_process_thread_safe() const;
+
     void set_process_input(bool p_enable);
     bool is_processing_input() const;
 
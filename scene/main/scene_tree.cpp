@@ -46,6 +46,7 @@
 #include "core/os/keyboard.h"
 #include "core/os/mutex.h"
 #include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
 #include "core/print_string.h"
 #include "core/project_settings.h"
 #include "core/resource/resource_manager.h"
@@ -1338,6 +1339,13 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
     // performance hit should be small for small groups.
     FixedVector<Node *,32,true> nodes_copy(g.nodes.begin(),g.nodes.end());
 
+    // Consecutive thread-safe nodes sharing a process priority are gathered and run in parallel, any other node acts
+    // as a barrier, so ordering between priorities and around non thread-safe nodes is unchanged.
+    const bool allow_threaded = (p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS) &&
+                                ThreadWorkPool::get_singleton()->get_thread_count() > 0;
+    FixedVector<Node *, 32, true> threaded_batch;
+    int batch_priority = 0;
+
     call_lock++;
 
     for (Node *n : nodes_copy) {
@@ -1350,15 +1358,45 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
         if (!n->can_process_notification(p_notification))
             continue;
 
+        if (allow_threaded && n->is_process_thread_safe()) {
+            if (!threaded_batch.empty() && batch_priority != n->get_process_priority()) {
+                _run_threaded_process_batch(threaded_batch.data(), threaded_batch.size(), p_notification);
+                threaded_batch.clear();
+            }
+            batch_priority = n->get_process_priority();
+            threaded_batch.push_back(n);
+            continue;
+        }
+        if (!threaded_batch.empty()) {
+            _run_threaded_process_batch(threaded_batch.data(), threaded_batch.size(), p_notification);
+            threaded_batch.clear();
+        }
+
         n->notification(p_notification);
         //ERR_FAIL_COND();
     }
+    if (!threaded_batch.empty()) {
+        _run_threaded_process_batch(threaded_batch.data(), threaded_batch.size(), p_notification);
+    }
 
     call_lock--;
     if (call_lock == 0)
         call_skip.clear();
 }
 
+void SceneTree::_process_node_threaded(uint32_t p_index, const ThreadedProcessBatch *p_batch) {
+    p_batch->nodes[p_index]->notification(p_batch->notification);
+}
+
+void SceneTree::_run_threaded_process_batch(Node *const *p_nodes, int p_count, int p_notification) {
+    if (p_count == 1) {
+        p_nodes[0]->notification(p_notification);
+        return;
+    }
+    ThreadedProcessBatch batch { p_nodes, p_notification };
+    ThreadWorkPool::get_singleton()->do_work(p_count, this, &SceneTree::_process_node_threaded, &batch);
+}
+
 /*
 void SceneMainLoop::_update_listener_2d() {
 
@@ -247,6 +247,12 @@ private:
     void remove_from_group(const StringName &p_group, Node *p_node);
     void make_group_changed(const StringName &p_group);
 
+    struct ThreadedProcessBatch {
+        Node *const *nodes;
+        int notification;
+    };
+    void _process_node_threaded(uint32_t p_index, const ThreadedProcessBatch *p_batch);
+    void _run_threaded_process_batch(Node *const *p_nodes, int p_count, int p_notification);
     void _notify_group_pause(const StringName &p_group, int p_notification);
     void _call_input_pause(const StringName &p_group, const StringName &p_method, const Ref<InputEvent> &p_input);
 
@@ -234,6 +234,19 @@ struct DynamicFontAtSize::ImplData
 
         return Pair<const Character *, ImplData *>(&chr->second, const_cast<ImplData *>(this));
     }
+    // p_font is the font that holds the glyph, it can be one of the fallbacks, vertical placement uses our ascent.
+    bool _glyph_quad(const Character *ch, const ImplData *p_font, DynamicFontAtSize::GlyphQuad &r_quad) const {
+        if (!ch->found || ch->texture_idx == -1)
+            return false;
+        ERR_FAIL_INDEX_V(ch->texture_idx, p_font->textures.size(), false);
+
+        const CharTexture &tex = p_font->textures[ch->texture_idx];
+        r_quad.texture = tex.texture->get_rid();
+        r_quad.rect = Rect2(ch->h_align, ch->v_align - ascent, ch->rect.size.x, ch->rect.size.y);
+        r_quad.uv = Rect2(ch->rect_uv.position / tex.texture_size, ch->rect_uv.size / tex.texture_size);
+        r_quad.keep_color = FT_HAS_COLOR(face);
+        return true;
+    }
     void _update_char(CharType p_char) {
 
         if (char_map.contains(p_char))
@@ -681,17 +694,13 @@ float DynamicFontAtSize::draw_char(RID p_canvas_item, const Point2 &p_pos, CharT
     if (ch->found) {
         ERR_FAIL_COND_V(ch->texture_idx < -1 || ch->texture_idx >= font->textures.size(), 0);
 
-        if (!p_advance_only && ch->texture_idx != -1) {
-            Point2 cpos = p_pos;
-            cpos.x += ch->h_align;
-            cpos.y -= m_impl->ascent;
-            cpos.y += ch->v_align;
+        GlyphQuad quad;
+        if (!p_advance_only && m_impl->_glyph_quad(ch, font, quad)) {
             Color modulate = p_modulate;
-            if (FT_HAS_COLOR(m_impl->face)) {
+            if (quad.keep_color) {
                 modulate.r = modulate.g = modulate.b = 1.0f;
             }
-            RID texture = font->textures[ch->texture_idx].texture->get_rid();
-            RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, Rect2(cpos, ch->rect.size), texture, ch->rect_uv, modulate, false, RID(), false);
+            RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, Rect2(p_pos + quad.rect.position, quad.rect.size), quad.texture, ch->rect_uv, modulate, false, RID(), false);
         }
 
         advance = ch->advance;
@@ -700,6 +709,27 @@ float DynamicFontAtSize::draw_char(RID p_canvas_item, const Point2 &p_pos, CharT
     return advance;
 }
 
+float DynamicFontAtSize::get_char_quad(CharType p_char, const Vector<Ref<DynamicFontAtSize> > &p_fallbacks, GlyphQuad &r_quad) const {
+
+    r_quad.texture = RID();
+    if (!m_impl->valid)
+        return 0;
+
+    const_cast<DynamicFontAtSize *>(this)->m_impl->_update_char(p_char);
+
+    auto char_pair_with_font = m_impl->_find_char_with_font(p_char, p_fallbacks);
+    const ImplData::Character *ch = char_pair_with_font.first;
+    ERR_FAIL_COND_V(!ch, 0.0);
+
+    if (!ch->found)
+        return 0;
+
+    if (!m_impl->_glyph_quad(ch, char_pair_with_font.second, r_quad))
+        r_quad.texture = RID();
+
+    return ch->advance;
+}
+
 void DynamicFontAtSize::update_oversampling() {
     m_impl->update_oversampling();
 }
@@ -713,9 +743,228 @@ DynamicFontAtSize::~DynamicFontAtSize() {
 
 /////////////////////////
 
+namespace {
+// Bounds of the cached runs and measured strings of a single font, the least recently used half is dropped when
+// the current limit is reached. The limit starts at the MIN value and grows up to the MAX one while the cache thrashes.
+constexpr int MIN_TEXT_RUNS = 256;
+constexpr int MAX_TEXT_RUNS = 16384;
+constexpr int MIN_MEASURED_STRINGS = 1024;
+constexpr int MAX_MEASURED_STRINGS = 65536;
+
+//! Sizes a cache from its use, so one font shared by thousands of labels keeps all their strings.
+struct CacheLimit {
+    int limit;
+    int max;
+    uint64_t last_full_tick = 0;
+
+    CacheLimit(int p_min, int p_max) : limit(p_min), max(p_max) {}
+
+    //! Called when the cache is full, returns false when the limit grew and nothing has to be evicted.
+    bool should_evict(uint64_t p_tick) {
+        // the cache was refilled from half within fewer lookups than its size, so most lookups miss.
+        const bool thrashing = last_full_tick != 0 && p_tick - last_full_tick < uint64_t(limit);
+        last_full_tick = p_tick;
+        if (thrashing && limit < max) {
+            limit *= 2;
+            return false;
+        }
+        return true;
+    }
+};
+
+template <class T>
+void evict_least_recently_used(T &r_map, uint64_t p_tick, int p_max) {
+    // every lookup hands out a new tick, so at least half of the entries are older than this.
+    const uint64_t keep_from = p_tick - p_max / 2;
+    for (auto iter = r_map.begin(); iter != r_map.end();) {
+        if (iter->second.last_used < keep_from)
+            iter = r_map.erase(iter);
+        else
+            ++iter;
+    }
+}
+} // end of anonymous namespace
+
+// Strings drawn through Font::draw_ui_string are laid out once, and the glyph quads are grouped per atlas page,
+// so every later draw of the same string costs one triangle array per page instead of one command per glyph.
+struct DynamicFont::TextRunCache {
+    struct Key {
+        UIString text;
+        int clip_w;
+
+        bool operator==(const Key &p_other) const { return clip_w == p_other.clip_w && text == p_other.text; }
+        explicit operator size_t() const { return eastl::hash<UIString>()(text) ^ (size_t(uint32_t(clip_w)) * 2654435761u); }
+    };
+
+    struct Page {
+        RID texture;
+        bool keep_color;
+        Vector<Point2> points;
+        PoolVector<Point2> uvs;
+        Vector<int> indices;
+    };
+
+    struct Run {
+        Vector<Page> outline_pages; // drawn below the glyphs
+        Vector<Page> pages;
+        float advance = 0;
+        uint64_t last_used = 0;
+    };
+
+    struct Measure {
+        float width = 0;
+        uint64_t last_used = 0;
+    };
+
+    HashMap<Key, Run> runs;
+    HashMap<UIString, Measure> widths;
+    CacheLimit runs_limit { MIN_TEXT_RUNS, MAX_TEXT_RUNS };
+    CacheLimit widths_limit { MIN_MEASURED_STRINGS, MAX_MEASURED_STRINGS };
+    Vector<Point2> points;
+    uint64_t tick = 0;
+
+    static void add_quad(Vector<Page> &r_pages, const DynamicFontAtSize::GlyphQuad &p_quad, float p_pen) {
+        Page *page = nullptr;
+        for (Page &p : r_pages) {
+            if (p.texture == p_quad.texture && p.keep_color == p_quad.keep_color) {
+                page = &p;
+                break;
+            }
+        }
+        if (!page) {
+            r_pages.emplace_back();
+            page = &r_pages.back();
+            page->texture = p_quad.texture;
+            page->keep_color = p_quad.keep_color;
+        }
+
+        const int base = page->points.size();
+        const Point2 from = p_quad.rect.position + Point2(p_pen, 0);
+        const Point2 to = from + p_quad.rect.size;
+        page->points.push_back(from);
+        page->points.push_back(Point2(to.x, from.y));
+        page->points.push_back(to);
+        page->points.push_back(Point2(from.x, to.y));
+
+        const Point2 uv_from = p_quad.uv.position;
+        const Point2 uv_to = p_quad.uv.position + p_quad.uv.size;
+        page->uvs.push_back(uv_from);
+        page->uvs.push_back(Point2(uv_to.x, uv_from.y));
+        page->uvs.push_back(uv_to);
+        page->uvs.push_back(Point2(uv_from.x, uv_to.y));
+
+        page->indices.push_back(base);
+        page->indices.push_back(base + 1);
+        page->indices.push_back(base + 2);
+        page->indices.push_back(base);
+        page->indices.push_back(base + 2);
+        page->indices.push_back(base + 3);
+    }
+
+};
+
+void DynamicFont::_clear_text_runs() {
+
+    if (text_run_cache) {
+        text_run_cache->runs.clear();
+        text_run_cache->widths.clear();
+    }
+}
+
+bool DynamicFont::_get_ui_string_width_cached(const UIString &p_string, float &r_width) const {
+
+    if (!data_at_size)
+        return false;
+
+    if (!text_run_cache)
+        text_run_cache = memnew(TextRunCache);
+    TextRunCache &cache = *text_run_cache;
+
+    auto iter = cache.widths.find(p_string);
+    if (iter == cache.widths.end()) {
+        if (cache.widths.size() >= size_t(cache.widths_limit.limit) && cache.widths_limit.should_evict(cache.tick))
+            evict_least_recently_used(cache.widths, cache.tick, cache.widths_limit.limit);
+
+        // same sum as Font::get_ui_string_size, the last character is measured against nothing.
+        TextRunCache::Measure measure;
+        const int l = p_string.length();
+        for (int i = 0; i < l; i++) {
+            measure.width += get_char_size(p_string[i], i + 1 < l ? p_string[i + 1] : CharType(0)).width;
+        }
+        iter = cache.widths.emplace(p_string, measure).first;
+    }
+    iter->second.last_used = ++cache.tick;
+    r_width = iter->second.width;
+    return true;
+}
+
+bool DynamicFont::_draw_ui_string_batched(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate, float &r_advance) const {
+
+    if (!data_at_size)
+        return false;
+
+    if (!text_run_cache)
+        text_run_cache = memnew(TextRunCache);
+    TextRunCache &cache = *text_run_cache;
+
+    TextRunCache::Key key { p_text, p_clip_w };
+    auto iter = cache.runs.find(key);
+    if (iter == cache.runs.end()) {
+        if (cache.runs.size() >= size_t(cache.runs_limit.limit) && cache.runs_limit.should_evict(cache.tick))
+            evict_least_recently_used(cache.runs, cache.tick, cache.runs_limit.limit);
+
+        // same layout rules as Font::draw_ui_string: clip against the glyph size, advance by the drawn advance.
+        TextRunCache::Run run;
+        const bool with_outline = outline_data_at_size && outline_cache_id.outline_size > 0;
+        DynamicFontAtSize::GlyphQuad quad;
+        float pen = 0;
+        for (int i = 0; i < p_text.length(); i++) {
+            if (p_clip_w >= 0 && (pen + int(get_char_size(p_text[i]).width)) > p_clip_w)
+                break;
+
+            if (with_outline) {
+                outline_data_at_size->get_char_quad(p_text[i], fallback_outline_data_at_size, quad);
+                if (quad.texture.is_valid())
+                    TextRunCache::add_quad(run.outline_pages, quad, pen);
+            }
+            float advance = data_at_size->get_char_quad(p_text[i], fallback_data_at_size, quad);
+            if (quad.texture.is_valid())
+                TextRunCache::add_quad(run.pages, quad, pen);
+            pen += advance + spacing_char;
+        }
+        run.advance = pen;
+        iter = cache.runs.emplace(eastl::move(key), eastl::move(run)).first;
+    }
+    TextRunCache::Run &run = iter->second;
+    run.last_used = ++cache.tick;
+    r_advance = run.advance;
+
+    RenderingServer *rs = RenderingServer::get_singleton();
+    auto submit = [&](const Vector<TextRunCache::Page> &p_pages, Color p_color) {
+        for (const TextRunCache::Page &page : p_pages) {
+            Color modulate = p_color;
+            if (page.keep_color) {
+                modulate.r = modulate.g = modulate.b = 1.0f;
+            }
+            cache.points.resize(page.points.size());
+            for (size_t i = 0; i < page.points.size(); i++) {
+                cache.points[i] = page.points[i] + p_pos;
+            }
+            PoolVector<Color> colors;
+            colors.push_back(modulate);
+            rs->canvas_item_add_triangle_array(p_canvas_item, page.indices, cache.points, colors, page.uvs, PoolVector<int>(), PoolVector<float>(), page.texture);
+        }
+    };
+    submit(run.outline_pages, p_outline_modulate * outline_color);
+    submit(run.pages, p_modulate);
+
+    return true;
+}
+
 void DynamicFont::_reload_cache() {
 
     ERR_FAIL_COND(cache_id.size < 1);
+    _clear_text_runs();
     if (not data) {
         data_at_size.unref();
         outline_data_at_size.unref();
@@ -875,6 +1124,7 @@ void DynamicFont::set_spacing(int p_type, int p_value) {
         spacing_space = p_value;
     }
 
+    _clear_text_runs();
     emit_changed();
     Object_change_notify(this);
 }
@@ -965,6 +1215,7 @@ void DynamicFont::set_fallback(int p_idx, const Ref<DynamicFontData> &p_data) {
     ERR_FAIL_INDEX(p_idx, fallbacks.size());
     fallbacks[p_idx] = p_data;
     fallback_data_at_size[p_idx] = fallbacks[p_idx]->_get_dynamic_font_at_size(cache_id);
+    _clear_text_runs();
 }
 
 void DynamicFont::add_fallback(const Ref<DynamicFontData> &p_data) {
@@ -974,6 +1225,7 @@ void DynamicFont::add_fallback(const Ref<DynamicFontData> &p_data) {
     fallback_data_at_size.push_back(fallbacks[fallbacks.size() - 1]->_get_dynamic_font_at_size(cache_id)); //const..
     if (outline_cache_id.outline_size > 0)
         fallback_outline_data_at_size.push_back(fallbacks[fallbacks.size() - 1]->_get_dynamic_font_at_size(outline_cache_id));
+    _clear_text_runs();
 
     Object_change_notify(this);
     emit_changed();
@@ -994,6 +1246,7 @@ void DynamicFont::remove_fallback(int p_idx) {
     ERR_FAIL_INDEX(p_idx, fallbacks.size());
     fallbacks.erase_at(p_idx);
     fallback_data_at_size.erase_at(p_idx);
+    _clear_text_runs();
     emit_changed();
     Object_change_notify(this);
 }
@@ -1110,6 +1363,7 @@ DynamicFont::DynamicFont() {
     spacing_char = 0;
     spacing_space = 0;
     outline_color = Color(1, 1, 1);
+    text_run_cache = nullptr;
     if (dynamic_font_mutex) {
         dynamic_font_mutex->lock();
         dynamic_fonts.push_back(this);
@@ -1123,6 +1377,7 @@ DynamicFont::~DynamicFont() {
         dynamic_fonts.erase_first(this);
         dynamic_font_mutex->unlock();
     }
+    memdelete(text_run_cache);
 }
 
 void DynamicFont::initialize_dynamic_fonts() {
@@ -1146,6 +1401,8 @@ void DynamicFont::update_oversampling() {
 
     for(DynamicFont * fnt : dynamic_fonts) {
 
+        // glyph atlases are rebuilt at the new oversampling, cached runs point into the old ones.
+        fnt->_clear_text_runs();
         if (fnt->data_at_size) {
             fnt->data_at_size->update_oversampling();
 
@@ -128,6 +128,14 @@ private:
     Error _load();
 
 public:
+    //! One glyph image, placed relative to the pen position.
+    struct GlyphQuad {
+        RID texture;
+        Rect2 rect;
+        Rect2 uv; // normalized atlas coordinates
+        bool keep_color = false; // color glyphs only take the alpha of the modulate
+    };
+
     static float font_oversampling;
 
     float get_height() const;
@@ -139,6 +147,8 @@ public:
     UIString get_available_chars() const;
 
     float draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_char, const Color &p_modulate, const Vector<Ref<DynamicFontAtSize> > &p_fallbacks, bool p_advance_only = false, bool p_outline=false) const;
+    //! Same lookup as draw_char, but returns the glyph quad instead of submitting it, r_quad.texture is empty for glyphs without an image.
+    float get_char_quad(CharType p_char, const Vector<Ref<DynamicFontAtSize> > &p_fallbacks, GlyphQuad &r_quad) const;
 
     void set_texture_flags(uint32_t p_flags);
     void update_oversampling();
@@ -180,8 +190,14 @@ private:
 
     Color outline_color;
 
+    struct TextRunCache;
+    mutable TextRunCache *text_run_cache;
+
 protected:
     void _reload_cache();
+    void _clear_text_runs();
+    bool _draw_ui_string_batched(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate, float &r_advance) const override;
+    bool _get_ui_string_width_cached(const UIString &p_string, float &r_width) const override;
 
     bool _set(const StringName &p_name, const Variant &p_value);
     bool _get(const StringName &p_name, Variant &r_ret) const;
@@ -228,6 +244,7 @@ public:
     bool is_distance_field_hint() const override;
 
     bool has_outline() const override;
+    bool caches_text_runs() const override { return true; }
 
     float draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_char, CharType p_next = 0, const Color &p_modulate = Color(1, 1, 1), bool p_outline = false) const override;
 
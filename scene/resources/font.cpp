@@ -73,6 +73,13 @@ void Font::draw_halign_utf8(RID p_canvas_item, const Point2 &p_pos, HAlign p_ali
     draw_halign(p_canvas_item, p_pos, p_align, p_width, StringUtils::from_utf8(p_text), p_modulate, p_outline_modulate);
 }
 void Font::draw_ui_string(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate) const {
+    draw_ui_string_run(p_canvas_item, p_pos, p_text, p_modulate, p_clip_w, p_outline_modulate);
+}
+float Font::draw_ui_string_run(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate) const {
+    float advance = 0;
+    if (_draw_ui_string_batched(p_canvas_item, p_pos, p_text, p_modulate, p_clip_w, p_outline_modulate, advance))
+        return advance;
+
     Vector2 ofs;
     int chars_drawn = 0;
     bool with_outline = has_outline();
@@ -94,6 +101,7 @@ void Font::draw_ui_string(RID p_canvas_item, const Point2 &p_pos, const UIString
             ofs.x += draw_char(p_canvas_item, p_pos + ofs, p_text[i], next, p_modulate, false);
         }
     }
+    return ofs.x;
 }
 void Font::draw(RID p_canvas_item, const Point2 &p_pos, StringView p_text, const Color &p_modulate, int p_clip_w, const Color &p_outline_modulate) const {
     draw_ui_string(p_canvas_item, p_pos, StringUtils::from_utf8(p_text), p_modulate, p_clip_w, p_outline_modulate);
@@ -492,6 +500,8 @@ void BitmapFont::clear() {
 Size2 Font::get_ui_string_size(const UIString &p_string) const {
 
     float w = 0;
+    if (_get_ui_string_width_cached(p_string, w))
+        return Size2(w, get_height());
 
     int l = p_string.length();
     if (l == 0)
@@ -510,6 +520,12 @@ Size2 Font::get_string_size(StringView p_string) const {
 
     Size2 res(0, get_height());
     QString a(QString::fromUtf8(p_string.data(),p_string.size()));
+    float w;
+    if (_get_ui_string_width_cached(a, w)) {
+        // the loop below also measures the terminating 0 against nothing.
+        res.x = w + get_char_size(CharType(0)).width;
+        return res;
+    }
     a.push_back(QChar(0)); // sentinel 0
     int l = a.length();
     for (int i = 0; i < l; i++) {
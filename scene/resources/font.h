@@ -51,6 +51,12 @@ class GODOT_EXPORT Font : public Resource {
 protected:
     static void _bind_methods();
 
+    //! Lets fonts that can lay out a whole string at once submit it with a few canvas commands.
+    //! Returns false when the string has to be drawn one glyph at a time, r_advance is the advance of the drawn glyphs.
+    virtual bool _draw_ui_string_batched(RID /*p_canvas_item*/, const Point2 & /*p_pos*/, const UIString & /*p_text*/, const Color & /*p_modulate*/, int /*p_clip_w*/, const Color & /*p_outline_modulate*/, float & /*r_advance*/) const { return false; }
+    //! Lets fonts keep measured strings, returns false when the width has to be summed per character.
+    virtual bool _get_ui_string_width_cached(const UIString & /*p_string*/, float & /*r_width*/) const { return false; }
+
 public:
     virtual float get_height() const = 0;
 
@@ -67,10 +73,14 @@ public:
 
     void draw(RID p_canvas_item, const Point2 &p_pos, StringView p_text, const Color &p_modulate = Color(1, 1, 1), int p_clip_w = -1, const Color &p_outline_modulate = Color(1, 1, 1)) const;
     void draw_ui_string(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate = Color(1, 1, 1), int p_clip_w = -1, const Color &p_outline_modulate = Color(1, 1, 1)) const;
+    //! Same as draw_ui_string, returns the horizontal advance of the drawn characters.
+    float draw_ui_string_run(RID p_canvas_item, const Point2 &p_pos, const UIString &p_text, const Color &p_modulate = Color(1, 1, 1), int p_clip_w = -1, const Color &p_outline_modulate = Color(1, 1, 1)) const;
     void draw_halign(RID p_canvas_item, const Point2 &p_pos, HAlign p_align, float p_width, const UIString &p_text, const Color &p_modulate = Color(1, 1, 1), const Color &p_outline_modulate = Color(1, 1, 1)) const;
     void draw_halign_utf8(RID p_canvas_item, const Point2 &p_pos, HAlign p_align, float p_width, StringView p_text, const Color &p_modulate = Color(1, 1, 1), const Color &p_outline_modulate = Color(1, 1, 1)) const;
 
     virtual bool has_outline() const { return false; }
+    //! True when draw_ui_string_run submits whole strings instead of one command per character.
+    virtual bool caches_text_runs() const { return false; }
     virtual float draw_char(RID p_canvas_item, const Point2 &p_pos, CharType p_char, CharType p_next = 0, const Color &p_modulate = Color(1, 1, 1), bool p_outline = false) const = 0;
 
     void update_changes();
@@ -656,6 +656,18 @@ bool ArrayMesh::_set(const StringName &p_name, const Variant &p_value) {
         }
 
         add_surface(format, PrimitiveType(primitive), array_data, vertex_count, array_index_data, index_count, aabb, blend_shapes, bone_aabb);
+
+        if (d.has("lod_errors") && d.has("lod_index_data")) {
+            Vector<float> lod_errors = d["lod_errors"].as<Vector<float>>();
+            Array lod_index_data = d["lod_index_data"].as<Array>();
+            ERR_FAIL_COND_V(lod_errors.size() != lod_index_data.size(), false);
+            Vector<PoolVector<uint8_t>> lod_arrays;
+            lod_arrays.reserve(lod_index_data.size());
+            for (int i = 0; i < lod_index_data.size(); i++) {
+                lod_arrays.emplace_back(lod_index_data[i].as<PoolVector<uint8_t>>());
+            }
+            RenderingServer::get_singleton()->mesh_surface_set_lods(mesh, idx, lod_errors, lod_arrays);
+        }
     } else {
         ERR_FAIL_V(false);
     }
@@ -731,6 +743,16 @@ bool ArrayMesh::_get(const StringName &p_name, Variant &r_ret) const {
     }
     d["blend_shape_data"] = eastl::move(md);
 
+    Vector<float> lod_errors = RenderingServer::get_singleton()->mesh_surface_get_lod_errors(mesh, idx);
+    if (!lod_errors.empty()) {
+        Array lod_index_data;
+        for (const Vector<uint8_t> &lod : RenderingServer::get_singleton()->mesh_surface_get_lod_index_arrays(mesh, idx)) {
+            lod_index_data.push_back(lod);
+        }
+        d["lod_errors"] = lod_errors;
+        d["lod_index_data"] = eastl::move(lod_index_data);
+    }
+
     Ref<Material> m = surface_get_material(idx);
     if (m)
         d["material"] = m;
@@ -1073,6 +1095,116 @@ void ArrayMesh::regen_normalmaps() {
     }
 }
 
+static PoolVector<uint8_t> _index_array_to_bytes(const Vector<int> &p_indices, int p_vertex_count) {
+
+    PoolVector<uint8_t> ret;
+    // same widths the rendering server uses for the surface's own index array.
+    if (p_vertex_count >= (1 << 16)) {
+        ret.resize(p_indices.size() * 4);
+        PoolVector<uint8_t>::Write w = ret.write();
+        uint32_t *dst = (uint32_t *)w.ptr();
+        for (size_t i = 0; i < p_indices.size(); i++) {
+            dst[i] = p_indices[i];
+        }
+    } else {
+        ret.resize(p_indices.size() * 2);
+        PoolVector<uint8_t>::Write w = ret.write();
+        uint16_t *dst = (uint16_t *)w.ptr();
+        for (size_t i = 0; i < p_indices.size(); i++) {
+            dst[i] = p_indices[i];
+        }
+    }
+    return ret;
+}
+
+static bool _surface_is_indexed_triangles(const ArrayMesh *p_mesh, int p_surface) {
+    const uint32_t format = p_mesh->surface_get_format(p_surface);
+    return p_mesh->surface_get_primitive_type(p_surface) == Mesh::PRIMITIVE_TRIANGLES &&
+           (format & Mesh::ARRAY_FORMAT_INDEX) && !(format & Mesh::ARRAY_FLAG_USE_2D_VERTICES);
+}
+
+void ArrayMesh::generate_lods(int p_max_lods, float p_max_error) {
+
+    ERR_FAIL_COND(p_max_lods < 0);
+
+    for (int i = 0; i < surfaces.size(); i++) {
+
+        if (!_surface_is_indexed_triangles(this, i)) {
+            continue;
+        }
+
+        SurfaceArrays arrays = surface_get_arrays(i);
+        Span<const Vector3> vertices = arrays.positions3();
+        const Vector<int> &indices = arrays.m_indices;
+        const float max_error = surfaces[i].aabb.get_longest_axis_size() * p_max_error;
+
+        Vector<float> lod_errors;
+        Vector<PoolVector<uint8_t>> lod_arrays;
+        size_t prev_count = indices.size();
+        float prev_error = 0.0f;
+
+        for (int l = 0; l < p_max_lods; l++) {
+            // every level is simplified from the full mesh, so its error is measured against the original surface.
+            const int target = (int(indices.size()) >> (l + 1)) / 3 * 3;
+            if (target < 3 * 16) {
+                break;
+            }
+            float error = 0.0f;
+            Vector<int> lod = SurfaceTool::simplify_indices(vertices, indices, target, max_error, &error);
+            if (lod.empty() || lod.size() > prev_count * 3 / 4) {
+                break; // blocked by the error limit or by seams, further levels would not save anything.
+            }
+            SurfaceTool::optimize_indices_for_cache(Span<int>(lod.data(), lod.size()), vertices.size());
+
+            prev_error = M_MAX(prev_error, error);
+            prev_count = lod.size();
+            lod_errors.push_back(prev_error);
+            lod_arrays.emplace_back(_index_array_to_bytes(lod, vertices.size()));
+        }
+
+        RenderingServer::get_singleton()->mesh_surface_set_lods(mesh, i, lod_errors, lod_arrays);
+    }
+}
+
+int ArrayMesh::surface_get_lod_count(int p_idx) const {
+
+    ERR_FAIL_INDEX_V(p_idx, surfaces.size(), 0);
+    return RenderingServer::get_singleton()->mesh_surface_get_lod_errors(mesh, p_idx).size();
+}
+
+void ArrayMesh::optimize_indices() {
+
+    // surfaces can't be re-indexed in place, round-trip them through their serialized form instead.
+    Vector<Variant> surface_data;
+    surface_data.reserve(surfaces.size());
+    for (int i = 0; i < surfaces.size(); i++) {
+
+        Variant v;
+        _get(StringName("surfaces/" + itos(i)), v);
+
+        if (_surface_is_indexed_triangles(this, i)) {
+            SurfaceArrays arrays = surface_get_arrays(i);
+            Vector<int> indices = eastl::move(arrays.m_indices);
+            const int vertex_count = surface_get_array_len(i);
+
+            SurfaceTool::optimize_indices_for_cache(Span<int>(indices.data(), indices.size()), vertex_count);
+            SurfaceTool::optimize_indices_for_overdraw(Span<int>(indices.data(), indices.size()), arrays.positions3());
+
+            Dictionary d = v.as<Dictionary>();
+            d["array_index_data"] = _index_array_to_bytes(indices, vertex_count);
+            v = d;
+        }
+        surface_data.emplace_back(eastl::move(v));
+    }
+
+    while (get_surface_count()) {
+        surface_remove(0);
+    }
+    for (int i = 0; i < surface_data.size(); i++) {
+        _set(StringName("surfaces/" + itos(i)), surface_data[i]);
+    }
+}
+
 //dirty hack
 bool (*array_mesh_lightmap_unwrap_callback)(float p_texel_size, const float *p_vertices, const float *p_normals, int p_vertex_count, const int *p_indices, const int *p_face_materials, int p_index_count, float **r_uv, int **r_vertex, int *r_vertex_count, int **r_index, int *r_index_count, int *r_size_hint_x, int *r_size_hint_y) = nullptr;
 
@@ -1282,6 +1414,9 @@ void ArrayMesh::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("create_outline", {"margin"}), &ArrayMesh::create_outline);
     MethodBinder::bind_method(D_METHOD("regen_normalmaps"), &ArrayMesh::regen_normalmaps,METHOD_FLAGS_DEFAULT | METHOD_FLAG_EDITOR);
     MethodBinder::bind_method(D_METHOD("lightmap_unwrap", {"transform", "texel_size"}), &ArrayMesh::lightmap_unwrap,METHOD_FLAGS_DEFAULT | METHOD_FLAG_EDITOR);
+    MethodBinder::bind_method(D_METHOD("generate_lods", {"max_lods", "max_error"}), &ArrayMesh::generate_lods, {DEFVAL(4), DEFVAL(0.05f)});
+    MethodBinder::bind_method(D_METHOD("surface_get_lod_count", {"surf_idx"}), &ArrayMesh::surface_get_lod_count);
+    MethodBinder::bind_method(D_METHOD("optimize_indices"), &ArrayMesh::optimize_indices);
     MethodBinder::bind_method(D_METHOD("get_faces"), &ArrayMesh::get_faces);
     MethodBinder::bind_method(D_METHOD("generate_triangle_mesh"), &ArrayMesh::generate_triangle_mesh);
 
@@ -244,6 +244,13 @@ public:
 
     void regen_normalmaps();
 
+    //! Adds up to p_max_lods reduced index buffers to every indexed triangle surface, halving the triangle count at
+    //! each level. p_max_error limits the simplification error relative to the surface's size.
+    void generate_lods(int p_max_lods = 4, float p_max_error = 0.05f);
+    int surface_get_lod_count(int p_idx) const;
+    //! Reorders the triangles of indexed surfaces for vertex cache reuse and less overdraw.
+    void optimize_indices();
+
     Error lightmap_unwrap(const Transform &p_base_transform = Transform(), float p_texel_size = 0.05f);
 
     void reload_from_file() override;
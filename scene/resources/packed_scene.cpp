@@ -43,6 +43,7 @@
 #include "scene/gui/control.h"
 #include "scene/main/instance_placeholder.h"
 #include "core/method_bind.h"
+#include "core/object_tooling.h"
 #include "core/resource/resource_manager.h"
 
 #include "EASTL/sort.h"
@@ -90,6 +91,20 @@ int _nm_get_string(StringView p_string, Map<StringName, int>& name_map) {
     name_map.emplace(StringName(p_string), idx);
     return idx;
 }
+void _set_with_bind(Object *p_object, const ClassDB::PropertySetterBind &p_bind, const Variant &p_value) {
+    // Equivalent to the ClassDB::set_property step of Object::set, for objects without a script instance.
+    Object_set_edited(p_object, true, false);
+
+    Callable::CallError ce;
+    if (p_bind.index >= 0) {
+        Variant index = p_bind.index;
+        const Variant *arg[2] = { &index, &p_value };
+        p_bind.setter->call(p_object, arg, 2, ce);
+    } else {
+        const Variant *arg[1] = { &p_value };
+        p_bind.setter->call(p_object, arg, 1, ce);
+    }
+}
 int _vm_get_variant(const Variant& p_variant, HashMap<Variant, int, Hasher<Variant>, VariantComparator>& variant_map) {
 
     if (variant_map.contains(p_variant))
@@ -112,11 +127,15 @@ bool SceneState::can_instance() const {
 
     return !nodes.empty();
 }
-bool SceneState::handleProperties(PackedGenEditState p_edit_state, Node *node,Span<Node *> ret_nodes, const SceneState::NodeData &n, Map<Ref<Resource>, Ref<Resource> > & resources_local_to_scene) const {
+bool SceneState::handleProperties(PackedGenEditState p_edit_state, Node *node,Span<Node *> ret_nodes, const SceneState::NodeData &n, const CompiledNode &compiled, Map<Ref<Resource>, Ref<Resource> > & resources_local_to_scene) const {
     int nprop_count = n.properties.size();
     if (!nprop_count)
         return true;
 
+    // resolved setters are only valid for the exact class they were looked up in
+    const bool use_setters = !compiled.setters.empty() && node->get_class_name() == compiled.instanced_class;
+    int prop_idx = -1;
+
     size_t sname_count = names.size();
     const Variant* props = nullptr;
     int prop_count = variants.size();
@@ -125,6 +144,7 @@ bool SceneState::handleProperties(PackedGenEditState p_edit_state, Node *node,Sp
     int i = eastl::distance(nodes.data(),&n); // find out which not are we on
 
     for (const auto &property : n.properties) {
+        prop_idx++;
 
         bool valid;
         ERR_FAIL_INDEX_V(property.name, sname_count, false);
@@ -184,6 +204,11 @@ bool SceneState::handleProperties(PackedGenEditState p_edit_state, Node *node,Sp
         else if (p_edit_state == GEN_EDIT_STATE_INSTANCE) {
             value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor
         }
+        // a script instance gets the first chance at handling a set, so it has to go through the generic path
+        if (use_setters && compiled.setters[prop_idx].setter && !node->get_script_instance()) {
+            _set_with_bind(node, compiled.setters[prop_idx], value);
+            continue;
+        }
         node->set(names[property.name], value, &valid);
     }
     return true;
@@ -210,6 +235,53 @@ void SceneState::handleConnections(int nc, Span<Node*> ret_nodes) const {
     }
 }
 
+void SceneState::_compile_instance_plan() const {
+
+    compiled_nodes.clear();
+    compiled_nodes.resize(nodes.size());
+
+    const int nc = nodes.size();
+    for (int i = 0; i < nc; ++i) {
+        const NodeData &n = nodes[i];
+        CompiledNode &cn = compiled_nodes[i];
+
+        if (n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < i) {
+            compiled_nodes[n.parent].child_count++;
+        }
+        // inherited and instanced nodes get created by other scenes, their class is only known at runtime.
+        if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANCED) {
+            continue;
+        }
+        if (n.type < 0 || n.type >= (int)names.size()) {
+            continue;
+        }
+        cn.creation_func = ClassDB::get_creation_func(names[n.type], &cn.instanced_class);
+        if (!cn.creation_func) {
+            continue;
+        }
+        cn.setters.resize(n.properties.size());
+        for (size_t p = 0; p < n.properties.size(); ++p) {
+            const int name_idx = n.properties[p].name;
+            if (name_idx < 0 || name_idx >= (int)names.size() || names[name_idx] == CoreStringNames::get_singleton()->_script) {
+                continue;
+            }
+            ClassDB::get_property_setter_bind(cn.instanced_class, names[name_idx], cn.setters[p]);
+        }
+    }
+}
+
+const SceneState::CompiledNode *SceneState::_get_instance_plan() const {
+
+    if (!plan_valid.load(std::memory_order_acquire)) {
+        MutexGuard guard(plan_mutex);
+        if (!plan_valid.load(std::memory_order_relaxed)) {
+            _compile_instance_plan();
+            plan_valid.store(true, std::memory_order_release);
+        }
+    }
+    return compiled_nodes.data();
+}
+
 Node *SceneState::instance(PackedGenEditState p_edit_state) const {
 
     // nodes where instancing failed (because something is missing)
@@ -218,6 +290,8 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
     int nc = nodes.size();
     ERR_FAIL_COND_V(nodes.empty(), nullptr);
 
+    const CompiledNode *plan = _get_instance_plan();
+
     const Vector<StringName> &snames(names);
     size_t sname_count = names.size();
 
@@ -233,6 +307,7 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
     for (const NodeData& n : nodes) {
         node_data_idx++;
         first_node = node_data_idx==0;
+        const CompiledNode &compiled(plan[node_data_idx]);
 
         Node *parent = nullptr;
 
@@ -294,9 +369,9 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
                 }
 #endif
             }
-        } else if (ClassDB::is_class_enabled(snames[n.type])) {
+        } else if (compiled.creation_func || ClassDB::is_class_enabled(snames[n.type])) {
             //node belongs to this scene and must be created
-            Object *obj = ClassDB::instance(snames[n.type]);
+            Object *obj = compiled.creation_func ? compiled.creation_func() : ClassDB::instance(snames[n.type]);
             if (!object_cast<Node>(obj)) {
 
                 memdelete(obj);
@@ -319,6 +394,9 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
             }
 
             node = object_cast<Node>(obj);
+            if (compiled.child_count > 0) {
+                node->_reserve_children(compiled.child_count);
+            }
 
         } else {
             //print_line("Class is disabled for: " + itos(n.type));
@@ -330,7 +408,7 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
             // if found all is good, otherwise ignore
 
             //properties
-            if(not handleProperties(p_edit_state,node,ret_nodes,n,resources_local_to_scene))
+            if(not handleProperties(p_edit_state,node,ret_nodes,n,compiled,resources_local_to_scene))
                 return nullptr;
 
             //name
@@ -405,6 +483,24 @@ Node *SceneState::instance(PackedGenEditState p_edit_state) const {
     return ret_nodes[0];
 }
 
+int SceneState::instance_multiple(int p_count, Vector<Node *> &r_nodes, PackedGenEditState p_edit_state) const {
+
+    ERR_FAIL_COND_V(p_count < 0, 0);
+    ERR_FAIL_COND_V(nodes.empty(), 0);
+
+    r_nodes.reserve(r_nodes.size() + p_count);
+    int created = 0;
+    for (int i = 0; i < p_count; ++i) {
+        Node *n = instance(p_edit_state);
+        if (!n) {
+            break;
+        }
+        r_nodes.emplace_back(n);
+        created++;
+    }
+    return created;
+}
+
 Error SceneState::_parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, Hasher<Variant>, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map) {
 
     // this function handles all the work related to properly packing scenes, be it
@@ -940,6 +1036,7 @@ const String &SceneState::get_path() const {
 
 void SceneState::clear() {
 
+    _invalidate_instance_plan();
     names.clear();
     variants.clear();
     nodes.clear();
@@ -1114,6 +1211,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
     ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+    _invalidate_instance_plan();
+
     const int node_count = p_dictionary["node_count"].as<int>();
     const PoolVector<int> snodes = p_dictionary["nodes"].as<PoolVector<int>>();
     ERR_FAIL_COND(snodes.size() < node_count);
@@ -1577,6 +1676,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
     nd.instance = p_instance;
     nd.index = p_index;
 
+    _invalidate_instance_plan();
     nodes.push_back(nd);
 
     return nodes.size() - 1;
@@ -1588,6 +1688,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value) {
     ERR_FAIL_INDEX(p_value, variants.size());
 
     NodeData::Property prop { p_name,p_value };
+    _invalidate_instance_plan();
     nodes[p_node].properties.emplace_back(prop);
 }
 void SceneState::add_node_group(int p_node, int p_group) {
@@ -1599,6 +1700,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 void SceneState::set_base_scene(int p_idx) {
 
     ERR_FAIL_INDEX(p_idx, variants.size());
+    _invalidate_instance_plan();
     base_scene_idx = p_idx;
 }
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, Vector<int> &&p_binds) {
@@ -1716,6 +1818,39 @@ Node *PackedScene::instance(PackedGenEditState p_edit_state) const {
     return s;
 }
 
+Vector<Node *> PackedScene::instance_multiple(int p_count, PackedGenEditState p_edit_state) const {
+
+    Vector<Node *> res;
+#ifndef TOOLS_ENABLED
+    ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, res, "Edit state is only for editors, does not work without tools compiled.");
+#endif
+
+    state->instance_multiple(p_count, res, p_edit_state);
+
+    const bool set_filename = !get_path().empty() && !StringUtils::contains(get_path(), "::");
+    for (Node *s : res) {
+        if (p_edit_state != GEN_EDIT_STATE_DISABLED) {
+            s->set_scene_instance_state(state);
+        }
+        if (set_filename)
+            s->set_filename(get_path());
+
+        s->notification(Node::NOTIFICATION_INSTANCED);
+    }
+    return res;
+}
+
+Array PackedScene::_instance_multiple(int p_count) const {
+
+    Vector<Node *> instanced = instance_multiple(p_count);
+    Array res;
+    res.resize(instanced.size());
+    for (size_t i = 0; i < instanced.size(); ++i) {
+        res[i] = Variant(instanced[i]);
+    }
+    return res;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 
     state = eastl::move(p_by);
@@ -1744,6 +1879,7 @@ void PackedScene::_bind_methods() {
 
     MethodBinder::bind_method(D_METHOD("pack", {"path"}), &PackedScene::pack);
     MethodBinder::bind_method(D_METHOD("instance", {"edit_state"}), &PackedScene::instance, {DEFVAL(GEN_EDIT_STATE_DISABLED)});
+    MethodBinder::bind_method(D_METHOD("instance_multiple", {"count"}), &PackedScene::_instance_multiple);
     MethodBinder::bind_method(D_METHOD("can_instance"), &PackedScene::can_instance);
     MethodBinder::bind_method(D_METHOD("_set_bundled_scene"), &PackedScene::_set_bundled_scene);
     MethodBinder::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -36,8 +36,12 @@
 #include "core/node_path.h"
 #include "core/map.h"
 #include "core/hash_map.h"
+#include "core/class_db.h"
+#include "core/os/mutex.h"
 #include "scene/main/node.h"
 
+#include <atomic>
+
 class PackedScene;
 enum PackedGenEditState : uint8_t {
     GEN_EDIT_STATE_DISABLED,
@@ -101,6 +105,22 @@ class GODOT_EXPORT SceneState : public RefCounted {
 
     Vector<ConnectionData> connections;
 
+    // Instantiation plan, built on first instance() and reused until the state is modified.
+    // Resolves the class constructors and the native property setters of every node created by this scene.
+    struct CompiledNode {
+        ClassDB::CreationFunc creation_func = nullptr;
+        StringName instanced_class;
+        Vector<ClassDB::PropertySetterBind> setters; // parallel to NodeData::properties, setter==nullptr -> Object::set
+        int child_count = 0;
+    };
+    mutable Vector<CompiledNode> compiled_nodes;
+    mutable std::atomic<bool> plan_valid { false };
+    mutable Mutex plan_mutex;
+
+    void _compile_instance_plan() const;
+    const CompiledNode *_get_instance_plan() const;
+    void _invalidate_instance_plan() { plan_valid.store(false, std::memory_order_release); }
+
     Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, Map<StringName, int> &name_map, HashMap<Variant, int, Hasher<Variant>, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
     Error _parse_connections(Node *p_owner, Node *p_node, Map<StringName, int> &name_map, HashMap<Variant, int, Hasher<Variant>, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -125,7 +145,7 @@ public:
 
 protected:
     static void _bind_methods();
-    bool handleProperties(PackedGenEditState p_edit_state, Node* node, Span<Node*> ret_nodes,const NodeData& n, Map<Ref<Resource>, Ref<Resource> >& resources_local_to_scene) const;
+    bool handleProperties(PackedGenEditState p_edit_state, Node* node, Span<Node*> ret_nodes,const NodeData& n, const CompiledNode &compiled, Map<Ref<Resource>, Ref<Resource> >& resources_local_to_scene) const;
     void handleConnections(int nc, Span<Node*> ret_nodes) const;
 
 public:
@@ -150,6 +170,8 @@ public:
 
     bool can_instance() const;
     Node *instance(PackedGenEditState p_edit_state) const;
+    //! Creates p_count copies of the scene, appending the roots to r_nodes. Returns the number of created copies.
+    int instance_multiple(int p_count, Vector<Node *> &r_nodes, PackedGenEditState p_edit_state) const;
 
     //unbuild API
 
@@ -222,6 +244,8 @@ public:
 
     bool can_instance() const;
     Node *instance(PackedGenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+    Vector<Node *> instance_multiple(int p_count, PackedGenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+    Array _instance_multiple(int p_count) const;
 
     void recreate_state();
     void replace_state(Ref<SceneState> p_by);
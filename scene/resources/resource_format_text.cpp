@@ -798,7 +798,8 @@ Error ResourceInteractiveLoaderText::rename_dependencies(FileAccess *p_f, String
 
     StringView base_path = PathUtils::get_base_dir(local_path);
 
-    uint64_t tag_end = f->get_position();
+    // the stream reads ahead of f, so positions are taken from the stream.
+    uint64_t tag_end = stream->get_position();
 
     while (true) {
 
@@ -858,7 +859,7 @@ Error ResourceInteractiveLoaderText::rename_dependencies(FileAccess *p_f, String
 
             fw->store_line("[ext_resource path=\"" + path + "\" type=\"" + type + "\" id=" + itos(index) + "]");
 
-            tag_end = f->get_position();
+            tag_end = stream->get_position();
         }
     }
 
@@ -1304,7 +1305,7 @@ Ref<ResourceInteractiveLoader> ResourceFormatLoaderText::load_interactive(String
         *r_error = ERR_CANT_OPEN;
 
     Error err;
-    FileAccess *f = FileAccess::open(p_path, FileAccess::READ, &err);
+    FileAccess *f = FileAccess::open_mapped(p_path, &err);
 
     ERR_FAIL_COND_V(err != OK, Ref<ResourceInteractiveLoader>());
 
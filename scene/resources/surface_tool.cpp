@@ -33,6 +33,7 @@
 #include "scene/resources/material.h"
 #include "scene/resources/mesh_enum_casters.h"
 #include "EASTL/sort.h"
+#include "core/math/math_funcs.h"
 
 constexpr float _VERTEX_SNAP = 0.0001f;
 constexpr float EQ_VERTEX_DIST = 0.00001f;
@@ -677,15 +678,20 @@ void SurfaceTool::create_from_blend_shape(const Ref<Mesh> &p_existing, int p_sur
 
 void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const Transform &p_xform) {
 
+    append_from_arrays(p_existing->surface_get_arrays(p_surface), p_existing->surface_get_primitive_type(p_surface), p_xform);
+}
+
+void SurfaceTool::append_from_arrays(const SurfaceArrays &p_arrays, Mesh::PrimitiveType p_primitive, const Transform &p_xform) {
+
     if (vertex_array.empty()) {
-        primitive = p_existing->surface_get_primitive_type(p_surface);
+        primitive = p_primitive;
         format = 0;
     }
 
     int nformat;
     Vector<Vertex> nvertices;
     Vector<int> nindices;
-    _create_list(p_existing, p_surface, &nvertices, &nindices, nformat);
+    _create_list_from_arrays(p_arrays, &nvertices, &nindices, nformat);
     format |= nformat;
     int vfrom = vertex_array.size();
 
@@ -923,6 +929,525 @@ void SurfaceTool::generate_normals(bool p_flip) {
     }
 }
 
+namespace {
+
+// Symmetric plane quadric. The error is divided by the accumulated weight, so it reads as a squared distance.
+struct ErrorQuadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0;
+    double c = 0;
+    double w = 0;
+
+    void add_plane(const Vector3 &p_normal, double p_d, double p_weight) {
+        const double x = p_normal.x, y = p_normal.y, z = p_normal.z;
+        a00 += p_weight * x * x;
+        a01 += p_weight * x * y;
+        a02 += p_weight * x * z;
+        a11 += p_weight * y * y;
+        a12 += p_weight * y * z;
+        a22 += p_weight * z * z;
+        b0 += p_weight * x * p_d;
+        b1 += p_weight * y * p_d;
+        b2 += p_weight * z * p_d;
+        c += p_weight * p_d * p_d;
+        w += p_weight;
+    }
+    void add(const ErrorQuadric &p_other) {
+        a00 += p_other.a00;
+        a01 += p_other.a01;
+        a02 += p_other.a02;
+        a11 += p_other.a11;
+        a12 += p_other.a12;
+        a22 += p_other.a22;
+        b0 += p_other.b0;
+        b1 += p_other.b1;
+        b2 += p_other.b2;
+        c += p_other.c;
+        w += p_other.w;
+    }
+    double error(const Vector3 &p_pos) const {
+        if (w <= 0.0) {
+            return 0.0;
+        }
+        const double x = p_pos.x, y = p_pos.y, z = p_pos.z;
+        double r = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                   2.0 * (b0 * x + b1 * y + b2 * z) + c;
+        return Math::abs(r) / w;
+    }
+};
+
+struct EdgeCollapse {
+    int from;
+    int to;
+    double error;
+};
+
+constexpr int VERTEX_CACHE_SIZE = 32;
+
+float _vertex_cache_score(int p_cache_pos, int p_remaining) {
+    if (p_remaining == 0) {
+        return -1.0f;
+    }
+    float score = 0.0f;
+    if (p_cache_pos >= 0) {
+        // the last triangle's vertices get a fixed score, so the next triangle doesn't just reuse them.
+        if (p_cache_pos < 3) {
+            score = 0.75f;
+        } else {
+            score = Math::pow(1.0f - (p_cache_pos - 3) * (1.0f / (VERTEX_CACHE_SIZE - 3)), 1.5f);
+        }
+    }
+    // boost vertices with few triangles left, so lone triangles don't get stranded.
+    score += 2.0f / Math::sqrt(float(p_remaining));
+    return score;
+}
+
+} // namespace
+
+Vector<int> SurfaceTool::simplify_indices(Span<const Vector3> p_vertices, Span<const int> p_indices, int p_target_index_count, float p_max_error, float *r_error) {
+
+    Vector<int> result(p_indices.begin(), p_indices.end());
+    if (r_error) {
+        *r_error = 0.0f;
+    }
+    ERR_FAIL_COND_V(result.size() % 3 != 0, result);
+
+    const int vertex_count = p_vertices.size();
+    for (int idx : result) {
+        ERR_FAIL_INDEX_V(idx, vertex_count, result);
+    }
+
+    // weld vertices sharing a position, topology is evaluated on the welded mesh.
+    Vector<int> weld(vertex_count);
+    {
+        Vector<int> order(vertex_count);
+        for (int i = 0; i < vertex_count; i++) {
+            order[i] = i;
+        }
+        eastl::sort(order.begin(), order.end(), [p_vertices](int a, int b) { return p_vertices[a] < p_vertices[b]; });
+        for (int i = 0; i < vertex_count; i++) {
+            const int v = order[i];
+            weld[v] = (i > 0 && p_vertices[order[i - 1]] == p_vertices[v]) ? weld[order[i - 1]] : v;
+        }
+    }
+
+    // positions shared by several referenced vertices lie on an attribute seam, collapsing them would tear uvs.
+    Vector<uint8_t> locked(vertex_count, 0);
+    {
+        Vector<uint8_t> used(vertex_count, 0);
+        for (int idx : result) {
+            used[idx] = 1;
+        }
+        Vector<int> group_size(vertex_count, 0);
+        for (int i = 0; i < vertex_count; i++) {
+            if (used[i]) {
+                group_size[weld[i]]++;
+            }
+        }
+        for (int i = 0; i < vertex_count; i++) {
+            if (group_size[i] > 1) {
+                locked[i] = 1;
+            }
+        }
+    }
+
+    // edges used by a single triangle are open borders, keep them so the silhouette doesn't erode.
+    {
+        Vector<uint64_t> edges;
+        edges.reserve(result.size());
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (int k = 0; k < 3; k++) {
+                const uint32_t a = weld[result[i + k]];
+                const uint32_t b = weld[result[i + (k + 1) % 3]];
+                if (a != b) {
+                    edges.push_back(a < b ? (uint64_t(a) << 32 | b) : (uint64_t(b) << 32 | a));
+                }
+            }
+        }
+        eastl::sort(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size();) {
+            size_t j = i + 1;
+            while (j < edges.size() && edges[j] == edges[i]) {
+                j++;
+            }
+            if (j - i == 1) {
+                locked[edges[i] >> 32] = 1;
+                locked[edges[i] & 0xFFFFFFFF] = 1;
+            }
+            i = j;
+        }
+    }
+
+    Vector<ErrorQuadric> quadrics(vertex_count);
+    for (size_t i = 0; i < result.size(); i += 3) {
+        const Vector3 &p0 = p_vertices[result[i + 0]];
+        const Vector3 &p1 = p_vertices[result[i + 1]];
+        const Vector3 &p2 = p_vertices[result[i + 2]];
+        Vector3 n = (p1 - p0).cross(p2 - p0);
+        const real_t len = n.length();
+        if (len == 0) {
+            continue;
+        }
+        n /= len;
+        const double d = -n.dot(p0);
+        for (int k = 0; k < 3; k++) {
+            quadrics[weld[result[i + k]]].add_plane(n, d, len * 0.5);
+        }
+    }
+
+    const double max_error_sq = double(p_max_error) * p_max_error;
+    double worst_error = 0.0;
+
+    Vector<int> remap(vertex_count);
+    Vector<int> tri_offsets(vertex_count + 1);
+    Vector<int> tri_fill(vertex_count);
+    Vector<int> tri_list;
+    Vector<uint8_t> touched(vertex_count);
+    Vector<EdgeCollapse> collapses;
+
+    while (int(result.size()) > p_target_index_count) {
+
+        // welded vertex -> triangle adjacency for the current index list.
+        eastl::fill(tri_offsets.begin(), tri_offsets.end(), 0);
+        for (int idx : result) {
+            tri_offsets[weld[idx] + 1]++;
+        }
+        for (int i = 0; i < vertex_count; i++) {
+            tri_offsets[i + 1] += tri_offsets[i];
+        }
+        tri_list.resize(result.size());
+        eastl::copy(tri_offsets.begin(), tri_offsets.end() - 1, tri_fill.begin());
+        for (size_t i = 0; i < result.size(); i++) {
+            tri_list[tri_fill[weld[result[i]]]++] = i / 3;
+        }
+
+        collapses.clear();
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (int k = 0; k < 3; k++) {
+                const int a = result[i + k];
+                const int b = result[i + (k + 1) % 3];
+                if (weld[a] == weld[b]) {
+                    continue;
+                }
+                if (!locked[weld[a]]) {
+                    collapses.push_back({ a, b, quadrics[weld[a]].error(p_vertices[b]) });
+                }
+                if (!locked[weld[b]]) {
+                    collapses.push_back({ b, a, quadrics[weld[b]].error(p_vertices[a]) });
+                }
+            }
+        }
+        if (collapses.empty()) {
+            break;
+        }
+        eastl::sort(collapses.begin(), collapses.end(), [](const EdgeCollapse &a, const EdgeCollapse &b) { return a.error < b.error; });
+
+        for (int i = 0; i < vertex_count; i++) {
+            remap[i] = i;
+        }
+        eastl::fill(touched.begin(), touched.end(), 0);
+
+        const int wanted = int(result.size()) - p_target_index_count;
+        int removed = 0;
+        for (const EdgeCollapse &c : collapses) {
+            if (c.error > max_error_sq) {
+                break;
+            }
+            const int wf = weld[c.from];
+            const int wt = weld[c.to];
+            if (touched[wf] || touched[wt]) {
+                continue;
+            }
+            // reject collapses that would fold a surviving triangle over.
+            bool flips = false;
+            for (int j = tri_offsets[wf]; j < tri_offsets[wf + 1] && !flips; j++) {
+                const int *tri = &result[tri_list[j] * 3];
+                if (weld[tri[0]] == wt || weld[tri[1]] == wt || weld[tri[2]] == wt) {
+                    continue; // this one degenerates and goes away.
+                }
+                Vector3 before[3], after[3];
+                for (int k = 0; k < 3; k++) {
+                    before[k] = p_vertices[tri[k]];
+                    after[k] = weld[tri[k]] == wf ? p_vertices[c.to] : before[k];
+                }
+                const Vector3 nb = (before[1] - before[0]).cross(before[2] - before[0]);
+                const Vector3 na = (after[1] - after[0]).cross(after[2] - after[0]);
+                flips = nb.dot(na) <= 0;
+            }
+            if (flips) {
+                continue;
+            }
+
+            remap[c.from] = c.to;
+            quadrics[wt].add(quadrics[wf]);
+            worst_error = M_MAX(worst_error, c.error);
+            // the one-ring changed shape, leave it alone until the next pass re-evaluates it.
+            for (int j = tri_offsets[wf]; j < tri_offsets[wf + 1]; j++) {
+                const int *tri = &result[tri_list[j] * 3];
+                touched[weld[tri[0]]] = 1;
+                touched[weld[tri[1]]] = 1;
+                touched[weld[tri[2]]] = 1;
+            }
+            removed += 6; // an interior collapse removes two triangles.
+            if (removed >= wanted) {
+                break;
+            }
+        }
+        if (removed == 0) {
+            break;
+        }
+
+        size_t write = 0;
+        for (size_t i = 0; i < result.size(); i += 3) {
+            const int a = remap[result[i + 0]];
+            const int b = remap[result[i + 1]];
+            const int c = remap[result[i + 2]];
+            if (weld[a] == weld[b] || weld[b] == weld[c] || weld[a] == weld[c]) {
+                continue;
+            }
+            result[write++] = a;
+            result[write++] = b;
+            result[write++] = c;
+        }
+        result.resize(write);
+    }
+
+    if (r_error) {
+        *r_error = float(Math::sqrt(worst_error));
+    }
+    return result;
+}
+
+void SurfaceTool::optimize_indices_for_cache(Span<int> p_indices, int p_vertex_count) {
+
+    ERR_FAIL_COND(p_indices.size() % 3 != 0);
+    const int triangle_count = p_indices.size() / 3;
+    if (triangle_count < 2) {
+        return;
+    }
+    for (int idx : p_indices) {
+        ERR_FAIL_INDEX(idx, p_vertex_count);
+    }
+
+    // vertex -> triangle adjacency, the first `remaining[v]` entries of a vertex range are the triangles not emitted yet.
+    Vector<int> offsets(p_vertex_count + 1, 0);
+    for (int idx : p_indices) {
+        offsets[idx + 1]++;
+    }
+    for (int i = 0; i < p_vertex_count; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    Vector<int> remaining(p_vertex_count);
+    for (int i = 0; i < p_vertex_count; i++) {
+        remaining[i] = offsets[i + 1] - offsets[i];
+    }
+    Vector<int> adjacency(p_indices.size());
+    {
+        Vector<int> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < p_indices.size(); i++) {
+            adjacency[fill[p_indices[i]]++] = i / 3;
+        }
+    }
+
+    Vector<int> cache_pos(p_vertex_count, -1);
+    Vector<float> vertex_score(p_vertex_count);
+    for (int i = 0; i < p_vertex_count; i++) {
+        vertex_score[i] = _vertex_cache_score(-1, remaining[i]);
+    }
+    Vector<float> triangle_score(triangle_count);
+    Vector<uint8_t> emitted(triangle_count, 0);
+    int best = 0;
+    for (int t = 0; t < triangle_count; t++) {
+        triangle_score[t] = vertex_score[p_indices[t * 3 + 0]] + vertex_score[p_indices[t * 3 + 1]] + vertex_score[p_indices[t * 3 + 2]];
+        if (triangle_score[t] > triangle_score[best]) {
+            best = t;
+        }
+    }
+
+    Vector<int> out;
+    out.reserve(p_indices.size());
+    Vector<int> cache;
+    Vector<int> new_cache;
+    cache.reserve(VERTEX_CACHE_SIZE + 3);
+    new_cache.reserve(VERTEX_CACHE_SIZE + 3);
+    int scan_cursor = 0;
+
+    while (best >= 0) {
+        emitted[best] = 1;
+        const int *tri = &p_indices[best * 3];
+        new_cache.clear();
+        for (int k = 0; k < 3; k++) {
+            const int v = tri[k];
+            out.push_back(v);
+            new_cache.push_back(v);
+            // drop the triangle from the vertex's pending list.
+            int *adj = &adjacency[offsets[v]];
+            for (int j = 0; j < remaining[v]; j++) {
+                if (adj[j] == best) {
+                    SWAP(adj[j], adj[remaining[v] - 1]);
+                    break;
+                }
+            }
+            remaining[v]--;
+        }
+        for (int v : cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) {
+                new_cache.push_back(v);
+            }
+        }
+        for (size_t i = VERTEX_CACHE_SIZE; i < new_cache.size(); i++) {
+            cache_pos[new_cache[i]] = -1;
+        }
+        for (size_t i = 0; i < new_cache.size(); i++) {
+            const int v = new_cache[i];
+            if (i < VERTEX_CACHE_SIZE) {
+                cache_pos[v] = i;
+            }
+            vertex_score[v] = _vertex_cache_score(cache_pos[v], remaining[v]);
+        }
+        for (int v : new_cache) {
+            for (int j = 0; j < remaining[v]; j++) {
+                const int t = adjacency[offsets[v] + j];
+                triangle_score[t] = vertex_score[p_indices[t * 3 + 0]] + vertex_score[p_indices[t * 3 + 1]] + vertex_score[p_indices[t * 3 + 2]];
+            }
+        }
+        if (new_cache.size() > VERTEX_CACHE_SIZE) {
+            new_cache.resize(VERTEX_CACHE_SIZE);
+        }
+        cache.swap(new_cache);
+
+        best = -1;
+        float best_score = -1e20f;
+        for (int v : cache) {
+            for (int j = 0; j < remaining[v]; j++) {
+                const int t = adjacency[offsets[v] + j];
+                if (triangle_score[t] > best_score) {
+                    best_score = triangle_score[t];
+                    best = t;
+                }
+            }
+        }
+        if (best < 0) {
+            // nothing connected to the cache is left, restart from the next pending triangle.
+            while (scan_cursor < triangle_count && emitted[scan_cursor]) {
+                scan_cursor++;
+            }
+            best = scan_cursor < triangle_count ? scan_cursor : -1;
+        }
+    }
+
+    eastl::copy(out.begin(), out.end(), p_indices.begin());
+}
+
+void SurfaceTool::optimize_indices_for_overdraw(Span<int> p_indices, Span<const Vector3> p_vertices) {
+
+    ERR_FAIL_COND(p_indices.size() % 3 != 0);
+    const int triangle_count = p_indices.size() / 3;
+    if (triangle_count < 2) {
+        return;
+    }
+    for (int idx : p_indices) {
+        ERR_FAIL_INDEX(idx, p_vertices.size());
+    }
+
+    // split where a triangle misses the cache with all three vertices, reordering those runs costs no extra
+    // vertex transforms.
+    constexpr uint32_t FIFO_SIZE = 16;
+    Vector<uint32_t> cache_stamp(p_vertices.size(), 0);
+    uint32_t timestamp = FIFO_SIZE + 1;
+    Vector<int> cluster_start;
+    for (int t = 0; t < triangle_count; t++) {
+        int misses = 0;
+        for (int k = 0; k < 3; k++) {
+            const int v = p_indices[t * 3 + k];
+            if (timestamp - cache_stamp[v] > FIFO_SIZE) {
+                cache_stamp[v] = timestamp++;
+                misses++;
+            }
+        }
+        if (t == 0 || misses == 3) {
+            cluster_start.push_back(t);
+        }
+    }
+    const int cluster_count = cluster_start.size();
+    if (cluster_count < 2) {
+        return;
+    }
+    cluster_start.push_back(triangle_count);
+
+    Vector3 mesh_center;
+    real_t mesh_area = 0;
+    Vector<Vector3> cluster_center(cluster_count);
+    Vector<Vector3> cluster_normal(cluster_count);
+    for (int c = 0; c < cluster_count; c++) {
+        Vector3 center;
+        Vector3 normal;
+        real_t area = 0;
+        for (int t = cluster_start[c]; t < cluster_start[c + 1]; t++) {
+            const Vector3 &p0 = p_vertices[p_indices[t * 3 + 0]];
+            const Vector3 &p1 = p_vertices[p_indices[t * 3 + 1]];
+            const Vector3 &p2 = p_vertices[p_indices[t * 3 + 2]];
+            const Vector3 n = (p1 - p0).cross(p2 - p0);
+            const real_t a = n.length();
+            center += (p0 + p1 + p2) * (a / 3);
+            normal += n;
+            area += a;
+        }
+        mesh_center += center;
+        mesh_area += area;
+        cluster_center[c] = area > 0 ? center / area : center;
+        cluster_normal[c] = normal.length() > 0 ? normal.normalized() : normal;
+    }
+    if (mesh_area > 0) {
+        mesh_center /= mesh_area;
+    }
+
+    // clusters facing away from the center tend to occlude the rest, draw them first.
+    Vector<float> sort_key(cluster_count);
+    Vector<int> order(cluster_count);
+    for (int c = 0; c < cluster_count; c++) {
+        sort_key[c] = (cluster_center[c] - mesh_center).dot(cluster_normal[c]);
+        order[c] = c;
+    }
+    eastl::stable_sort(order.begin(), order.end(), [&sort_key](int a, int b) { return sort_key[a] > sort_key[b]; });
+
+    Vector<int> out;
+    out.reserve(p_indices.size());
+    for (int c : order) {
+        out.insert(out.end(), p_indices.begin() + cluster_start[c] * 3, p_indices.begin() + cluster_start[c + 1] * 3);
+    }
+    eastl::copy(out.begin(), out.end(), p_indices.begin());
+}
+
+void SurfaceTool::optimize_indices() {
+
+    ERR_FAIL_COND(primitive != Mesh::PRIMITIVE_TRIANGLES);
+    if (index_array.empty()) {
+        index();
+    }
+
+    Vector<Vector3> positions;
+    positions.reserve(vertex_array.size());
+    for (const Vertex &v : vertex_array) {
+        positions.push_back(v.vertex);
+    }
+    optimize_indices_for_cache(Span<int>(index_array.data(), index_array.size()), vertex_array.size());
+    optimize_indices_for_overdraw(Span<int>(index_array.data(), index_array.size()), positions);
+}
+
+Vector<int> SurfaceTool::generate_lod(int p_target_index_count, float p_max_error) {
+
+    ERR_FAIL_COND_V(primitive != Mesh::PRIMITIVE_TRIANGLES, Vector<int>());
+    ERR_FAIL_COND_V_MSG(index_array.empty(), Vector<int>(), "LOD generation requires an indexed surface, call index() first.");
+
+    Vector<Vector3> positions;
+    positions.reserve(vertex_array.size());
+    for (const Vertex &v : vertex_array) {
+        positions.push_back(v.vertex);
+    }
+    return simplify_indices(positions, index_array, p_target_index_count, p_max_error);
+}
+
 void SurfaceTool::set_material(const Ref<Material> &p_material) {
 
     material = p_material;
@@ -963,6 +1488,8 @@ void SurfaceTool::_bind_methods() {
     MethodBinder::bind_method(D_METHOD("deindex"), &SurfaceTool::deindex);
     MethodBinder::bind_method(D_METHOD("generate_normals", {"flip"}), &SurfaceTool::generate_normals, {DEFVAL(false)});
     MethodBinder::bind_method(D_METHOD("generate_tangents"), &SurfaceTool::generate_tangents);
+    MethodBinder::bind_method(D_METHOD("optimize_indices"), &SurfaceTool::optimize_indices);
+    MethodBinder::bind_method(D_METHOD("generate_lod", {"target_index_count", "max_error"}), &SurfaceTool::generate_lod, {DEFVAL(1e20f)});
 
     MethodBinder::bind_method(D_METHOD("set_material", {"material"}), &SurfaceTool::set_material);
 
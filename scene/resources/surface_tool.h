@@ -123,6 +123,17 @@ public:
     void deindex();
     void generate_normals(bool p_flip = false);
     void generate_tangents();
+    void optimize_indices();
+    Vector<int> generate_lod(int p_target_index_count, float p_max_error = 1e20f);
+
+    //! Quadric error edge collapse of an indexed triangle list. Only existing vertices are kept, so the result indexes
+    //! the same vertex buffer. Vertices on open borders and attribute seams are never removed.
+    //! r_error receives the largest collapse error as an object space distance.
+    static Vector<int> simplify_indices(Span<const Vector3> p_vertices, Span<const int> p_indices, int p_target_index_count, float p_max_error, float *r_error = nullptr);
+    //! Reorders triangles for post-transform vertex cache reuse (Forsyth).
+    static void optimize_indices_for_cache(Span<int> p_indices, int p_vertex_count);
+    //! Reorders runs of triangles that start with a full cache miss so outward facing runs are drawn first.
+    static void optimize_indices_for_overdraw(Span<int> p_indices, Span<const Vector3> p_vertices);
 
     void set_material(const Ref<Material> &p_material);
 
@@ -136,6 +147,8 @@ public:
     void create_from(const Ref<Mesh> &p_existing, int p_surface);
     void create_from_blend_shape(const Ref<Mesh> &p_existing, int p_surface, StringName p_blend_shape_name);
     void append_from(const Ref<Mesh> &p_existing, int p_surface, const Transform &p_xform);
+    //! Same as append_from, for arrays fetched beforehand; does not touch the RenderingServer.
+    void append_from_arrays(const SurfaceArrays &p_arrays, Mesh::PrimitiveType p_primitive, const Transform &p_xform);
     Ref<ArrayMesh> commit(const Ref<ArrayMesh> &p_existing = Ref<ArrayMesh>(), uint32_t p_flags = Mesh::ARRAY_COMPRESS_DEFAULT);
 
     SurfaceTool();
@@ -39,13 +39,30 @@
 
 #include "EASTL/sort.h"
 #include "EASTL/deque.h"
+#include <atomic>
 #include <cassert>
 
 IMPL_GDCLASS(Theme)
 RES_BASE_EXTENSION_IMPL(Theme,"theme")
 
+namespace {
+// bumped whenever any theme item, or one of the default themes, changes; see Theme::get_lookup_version().
+std::atomic<uint32_t> s_lookup_version { 1 };
+} // end of anonymous namespace
+
+void Theme::_invalidate_lookups() {
+
+    s_lookup_version.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t Theme::get_lookup_version() {
+
+    return s_lookup_version.load(std::memory_order_relaxed);
+}
+
 void Theme::_emit_theme_changed() {
 
+    _invalidate_lookups();
     emit_changed();
 }
 PoolVector<String> Theme::_get_icon_list(const String &p_node_type) const {
@@ -249,7 +266,7 @@ void Theme::set_default_theme_font(const Ref<Font> &p_default_font) {
     }
 
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 Ref<Font> Theme::get_default_theme_font() const {
@@ -277,6 +294,7 @@ Ref<Theme> Theme::get_default() {
 
 void Theme::set_default(const Ref<Theme> &p_default) {
 
+    _invalidate_lookups();
     default_theme = p_default;
 }
 
@@ -287,19 +305,23 @@ Ref<Theme> Theme::get_project_default() {
 
 void Theme::set_project_default(const Ref<Theme> &p_project_default) {
 
+    _invalidate_lookups();
     project_default_theme = p_project_default;
 }
 
 void Theme::set_default_icon(const Ref<Texture> &p_icon) {
 
+    _invalidate_lookups();
     default_icon = p_icon;
 }
 void Theme::set_default_style(const Ref<StyleBox> &p_style) {
 
+    _invalidate_lookups();
     default_style = p_style;
 }
 void Theme::set_default_font(const Ref<Font> &p_font) {
 
+    _invalidate_lookups();
     default_font = p_font;
 }
 
@@ -314,6 +336,7 @@ void Theme::set_icon(const StringName &p_name, const StringName &p_node_type, co
     }
 
     icon_map[p_node_type][p_name] = p_icon;
+    _invalidate_lookups();
 
     if (p_icon) {
         icon_map[p_node_type][p_name]->connect("changed",callable_mp(this, &ClassName::_emit_theme_changed), varray(), ObjectNS::CONNECT_REFERENCE_COUNTED);
@@ -321,7 +344,7 @@ void Theme::set_icon(const StringName &p_name, const StringName &p_node_type, co
 
     if (new_value) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 Ref<Texture> Theme::get_icon(const StringName &p_name, const StringName &p_node_type) const {
@@ -352,7 +375,7 @@ void Theme::clear_icon(const StringName &p_name, const StringName &p_node_type)
     icon_map[p_node_type].erase(p_name);
 
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_icon_list(const StringName& p_node_type, Vector<StringName> *p_list) const {
@@ -371,10 +394,11 @@ void Theme::set_shader(const StringName &p_name, const StringName &p_node_type,
     bool new_value = !shader_map.contains(p_node_type) || !shader_map[p_node_type].contains(p_name);
 
     shader_map[p_node_type][p_name] = p_shader;
+    _invalidate_lookups();
 
     if (new_value) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 
@@ -396,7 +420,7 @@ void Theme::clear_shader(const StringName &p_name, const StringName &p_node_type
 
     shader_map[p_node_type].erase(p_name);
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_shader_list(const StringName &p_node_type, Vector<StringName> *p_list) const {
@@ -427,7 +451,7 @@ void Theme::set_stylebox(const StringName &p_name, const StringName &p_node_type
 
     if (new_value)
         Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 Ref<StyleBox> Theme::get_stylebox(const StringName &p_name, const StringName &p_node_type) const {
@@ -456,7 +480,7 @@ void Theme::clear_stylebox(const StringName &p_name, const StringName &p_node_ty
     style_map[p_node_type].erase(p_name);
 
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 Vector<StringName> Theme::get_stylebox_list(const StringName& p_node_type) const {
@@ -492,6 +516,7 @@ void Theme::set_font(const StringName &p_name, const StringName &p_node_type, co
     }
 
     font_map[p_node_type][p_name] = p_font;
+    _invalidate_lookups();
 
     if (p_font) {
         font_map[p_node_type][p_name]->connect("changed",callable_mp(this, &ClassName::_emit_theme_changed), varray(), ObjectNS::CONNECT_REFERENCE_COUNTED);
@@ -499,7 +524,7 @@ void Theme::set_font(const StringName &p_name, const StringName &p_node_type, co
 
     if (new_value) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 Ref<Font> Theme::get_font(const StringName &p_name, const StringName &p_node_type) const {
@@ -527,7 +552,7 @@ void Theme::clear_font(const StringName &p_name, const StringName &p_node_type)
 
     font_map[p_node_type].erase(p_name);
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_font_list(const StringName& p_node_type, Vector<StringName> *p_list) const {
@@ -562,7 +587,7 @@ void Theme::set_colors(Span<const Theme::ThemeColor> colors)
     }
     if (need_notify) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 
@@ -571,10 +596,11 @@ void Theme::set_color(const StringName &p_name, const StringName &p_node_type, c
     bool new_value = !color_map.contains(p_node_type) || !color_map[p_node_type].contains(p_name);
 
     color_map[p_node_type][p_name] = p_color;
+    _invalidate_lookups();
 
     if (new_value) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 
@@ -598,7 +624,7 @@ void Theme::clear_color(const StringName &p_name, const StringName &p_node_type)
 
     color_map[p_node_type].erase(p_name);
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_color_list(const StringName& p_node_type, Vector<StringName> *p_list) const {
@@ -633,7 +659,7 @@ void Theme::set_constants(Span<const ThemeConstant> vals)
     }
     if (need_notify) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 
 }
@@ -642,10 +668,11 @@ void Theme::set_constant(const StringName &p_name, const StringName &p_node_type
 
     bool new_value = !constant_map.contains(p_node_type) || !constant_map[p_node_type].contains(p_name);
     constant_map[p_node_type][p_name] = p_constant;
+    _invalidate_lookups();
 
     if (new_value) {
         Object_change_notify(this);
-        emit_changed();
+        _emit_theme_changed();
     }
 }
 
@@ -670,7 +697,7 @@ void Theme::clear_constant(const StringName &p_name, const StringName &p_node_ty
 
     constant_map[p_node_type].erase(p_name);
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_constant_list(const StringName& p_node_type, Vector<StringName> *p_list) const {
@@ -718,7 +745,7 @@ void Theme::clear() {
     constant_map.clear();
 
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::copy_default_theme() {
@@ -760,7 +787,7 @@ void Theme::copy_theme(const Ref<Theme> &p_other) {
     shader_map = p_other->shader_map;
 
     Object_change_notify(this);
-    emit_changed();
+    _emit_theme_changed();
 }
 
 void Theme::get_type_list(Vector<StringName> *p_list) const {
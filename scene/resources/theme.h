@@ -46,6 +46,7 @@ class GODOT_EXPORT Theme : public Resource {
     RES_BASE_EXTENSION("theme")
 
     void _emit_theme_changed();
+    static void _invalidate_lookups();
 
     HashMap<StringName, HashMap<StringName, Ref<Texture> > > icon_map;
     HashMap<StringName, HashMap<StringName, Ref<StyleBox> > > style_map;
@@ -103,6 +104,9 @@ public:
     static void set_default_style(const Ref<StyleBox> &p_style);
     static void set_default_font(const Ref<Font> &p_font);
     static bool is_default_icon(const Ref<Texture>& p_icon) { return default_icon==p_icon;}
+    //! Changes every time an item of any theme, or one of the default themes, is modified.
+    //! Used by Control to validate its resolved item cache.
+    static uint32_t get_lookup_version();
 
     void set_default_theme_font(const Ref<Font> &p_default_font);
     Ref<Font> get_default_theme_font() const;
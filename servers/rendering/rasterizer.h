@@ -114,6 +114,9 @@ public:
         bool redraw_if_visible : 4;
 
         float depth; //used for sorting
+        // converts mesh LOD errors (object space) to fractions of the allowed screen error, set while culling.
+        // 0 disables LOD selection.
+        float lod_error_scale;
 
         IntrusiveListNode<InstanceBase> dependency_item;
 
@@ -136,6 +139,7 @@ public:
             baked_light = false;
             dynamic_gi = false;
             redraw_if_visible = false;
+            lod_error_scale = 0.0f;
             lightmap_capture = nullptr;
         }
     };
@@ -303,6 +307,10 @@ public:
     virtual Vector<Vector<uint8_t>> mesh_surface_get_blend_shapes(RID p_mesh, int p_surface) const = 0;
     virtual const Vector<AABB> &mesh_surface_get_skeleton_aabb(RID p_mesh, int p_surface) const = 0;
 
+    virtual void mesh_surface_set_lods(RID p_mesh, int p_surface, const Vector<float> &p_lod_errors, const Vector<PoolVector<uint8_t>> &p_lod_index_arrays) = 0;
+    virtual Vector<float> mesh_surface_get_lod_errors(RID p_mesh, int p_surface) const = 0;
+    virtual Vector<Vector<uint8_t>> mesh_surface_get_lod_index_arrays(RID p_mesh, int p_surface) const = 0;
+
     virtual void mesh_remove_surface(RID p_mesh, int p_index) = 0;
     virtual int mesh_get_surface_count(RID p_mesh) const = 0;
 
@@ -79,13 +79,64 @@ void _collect_ysort_children(VisualServerCanvas::Item *p_canvas_item, Transform2
     }
 }
 
-void _mark_ysort_dirty(VisualServerCanvas::Item *ysort_owner, RID_Owner<VisualServerCanvas::Item> &canvas_item_owner) {
+void _mark_ysort_dirty(VisualServerCanvas::Item *ysort_owner, RID_Alloc<VisualServerCanvas::Item> &canvas_item_owner) {
     do {
         ysort_owner->ysort_children_count = -1;
         ysort_owner = canvas_item_owner.owns(ysort_owner->parent) ? canvas_item_owner.getornull(ysort_owner->parent) : nullptr;
     } while (ysort_owner && ysort_owner->sort_y);
 }
 
+void VisualServerCanvas::_mark_subtree_dirty(Item *p_item) {
+
+    while (p_item && !p_item->subtree_dirty) {
+        p_item->subtree_dirty = true;
+        p_item = canvas_item_owner.owns(p_item->parent) ? canvas_item_owner.getornull(p_item->parent) : nullptr;
+    }
+}
+
+void VisualServerCanvas::_mark_parent_subtree_dirty(Item *p_item) {
+
+    if (canvas_item_owner.owns(p_item->parent)) {
+        _mark_subtree_dirty(canvas_item_owner.getornull(p_item->parent));
+    }
+}
+
+void VisualServerCanvas::_update_subtree(Item *p_item) {
+
+    Item *ci = p_item;
+    ci->subtree_dirty = false;
+    ci->subtree_unbounded = ci->unbounded_content || ci->update_when_visible || ci->copy_back_buffer || ci->vp_render;
+    ci->subtree_item_count = 1;
+    ci->subtree_has_rect = !ci->commands.empty();
+    if (ci->subtree_has_rect) {
+        ci->subtree_rect = ci->get_rect();
+    }
+
+    for (Item *child : ci->child_items) {
+        // hidden children are refreshed as well, so that no dirty item is left below a clean one.
+        if (child->subtree_dirty) {
+            _update_subtree(child);
+        }
+        if (!child->visible)
+            continue;
+
+        ci->subtree_unbounded |= child->subtree_unbounded;
+        ci->subtree_item_count += child->subtree_item_count;
+        if (!child->subtree_has_rect)
+            continue;
+
+        // same transform _render_canvas_item draws the child with, snapping can move it by up to a pixel per
+        // level, which the margin added after scaling to the screen doesn't cover once zoomed in.
+        Transform2D child_xform = child->xform;
+        if (snap_2d_transforms) {
+            child_xform.elements[2] = child_xform.elements[2].floor();
+        }
+        Rect2 child_rect = child_xform.xform(child->subtree_rect);
+        ci->subtree_rect = ci->subtree_has_rect ? ci->subtree_rect.merge(child_rect) : child_rect;
+        ci->subtree_has_rect = true;
+    }
+}
+
 void VisualServerCanvas::_render_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RasterizerCanvas::Item **z_list, RasterizerCanvas::Item **z_last_list, Item *p_canvas_clip, Item *p_material_owner) {
 
     Item *ci = p_canvas_item;
@@ -93,6 +144,25 @@ void VisualServerCanvas::_render_canvas_item(Item *p_canvas_item, const Transfor
     if (!ci->visible)
         return;
 
+    Transform2D xform = ci->xform;
+    if (snap_2d_transforms) {
+        xform.elements[2] = xform.elements[2].floor();
+    }
+    xform = p_transform * xform;
+
+    if (ci->subtree_dirty) {
+        _update_subtree(ci);
+    }
+    if (!ci->subtree_unbounded) {
+        // grown by a pixel to stay conservative with snapped transforms.
+        Rect2 subtree_rect = ci->subtree_has_rect ? xform.xform(ci->subtree_rect).grow(1) : Rect2();
+        subtree_rect.position += p_clip_rect.position;
+        if (!ci->subtree_has_rect || !p_clip_rect.intersects(subtree_rect, true)) {
+            culled_item_count += ci->subtree_item_count;
+            return;
+        }
+    }
+
     if (ci->children_order_dirty) {
 
         eastl::sort(ci->child_items.begin(),ci->child_items.end(),ItemIndexSort());
@@ -100,11 +170,6 @@ void VisualServerCanvas::_render_canvas_item(Item *p_canvas_item, const Transfor
     }
 
     Rect2 rect = ci->get_rect();
-    Transform2D xform = ci->xform;
-    if (snap_2d_transforms) {
-        xform.elements[2] = xform.elements[2].floor();
-    }
-    xform = p_transform * xform;
     Rect2 global_rect = xform.xform(rect);
     global_rect.position += p_clip_rect.position;
 
@@ -350,10 +415,7 @@ void VisualServerCanvas::canvas_set_parent(RID p_canvas, RID p_parent, float p_s
 
 RID VisualServerCanvas::canvas_item_create() {
 
-    Item *canvas_item = memnew(Item);
-    ERR_FAIL_COND_V(!canvas_item, RID());
-
-    return canvas_item_owner.make_rid(canvas_item);
+    return canvas_item_owner.make_rid();
 }
 
 void VisualServerCanvas::canvas_item_set_parent(RID p_item, RID p_parent) {
@@ -371,6 +433,7 @@ void VisualServerCanvas::canvas_item_set_parent(RID p_item, RID p_parent) {
 
             Item *item_owner = canvas_item_owner.get(canvas_item->parent);
             item_owner->child_items.erase_first(canvas_item);
+            _mark_subtree_dirty(item_owner);
 
             if (item_owner->sort_y) {
                 _mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -393,6 +456,7 @@ void VisualServerCanvas::canvas_item_set_parent(RID p_item, RID p_parent) {
             Item *item_owner = canvas_item_owner.get(p_parent);
             item_owner->child_items.push_back(canvas_item);
             item_owner->children_order_dirty = true;
+            _mark_subtree_dirty(item_owner);
 
             if (item_owner->sort_y) {
                 _mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -412,6 +476,7 @@ void VisualServerCanvas::canvas_item_set_visible(RID p_item, bool p_visible) {
 
     canvas_item->visible = p_visible;
 
+    _mark_parent_subtree_dirty(canvas_item);
     _mark_ysort_dirty(canvas_item, canvas_item_owner);
 }
 void VisualServerCanvas::canvas_item_set_light_mask(RID p_item, int p_mask) {
@@ -428,6 +493,7 @@ void VisualServerCanvas::canvas_item_set_transform(RID p_item, const Transform2D
     ERR_FAIL_COND(!canvas_item);
 
     canvas_item->xform = p_transform;
+    _mark_parent_subtree_dirty(canvas_item);
 }
 void VisualServerCanvas::canvas_item_set_clip(RID p_item, bool p_clip) {
 
@@ -450,6 +516,8 @@ void VisualServerCanvas::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
     canvas_item->custom_rect = p_custom_rect;
     canvas_item->rect = p_rect;
+    canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 }
 void VisualServerCanvas::canvas_item_set_modulate(RID p_item, const Color &p_color) {
 
@@ -480,6 +548,7 @@ void VisualServerCanvas::canvas_item_set_update_when_visible(RID p_item, bool p_
     ERR_FAIL_COND(!canvas_item);
 
     canvas_item->update_when_visible = p_update;
+    _mark_subtree_dirty(canvas_item);
 }
 
 void VisualServerCanvas::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
@@ -495,6 +564,7 @@ void VisualServerCanvas::canvas_item_add_line(RID p_item, const Point2 &p_from,
     line->width = p_width;
     line->antialiased = p_antialiased;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(line);
 }
@@ -581,6 +651,7 @@ void VisualServerCanvas::canvas_item_add_polyline(RID p_item, const Vector<Point
         }
     }
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(pline);
 }
 
@@ -605,6 +676,7 @@ void VisualServerCanvas::canvas_item_add_multiline(RID p_item, const Vector<Vect
     }
 
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(pline);
 }
 
@@ -618,6 +690,7 @@ void VisualServerCanvas::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
     rect->modulate = p_color;
     rect->rect = p_rect;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(rect);
 }
@@ -633,6 +706,8 @@ void VisualServerCanvas::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
     circle->pos = p_pos;
     circle->radius = p_radius;
 
+    canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(circle);
 }
 
@@ -669,6 +744,7 @@ void VisualServerCanvas::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
     rect->texture = p_texture;
     rect->normal_map = p_normal_map;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(rect);
 }
 
@@ -716,6 +792,7 @@ void VisualServerCanvas::canvas_item_add_texture_rect_region(RID p_item, const R
     }
 
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(rect);
 }
@@ -740,6 +817,7 @@ void VisualServerCanvas::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_r
     style->axis_x = p_x_axis_mode;
     style->axis_y = p_y_axis_mode;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(style);
 }
@@ -757,6 +835,7 @@ void VisualServerCanvas::canvas_item_add_primitive(RID p_item, const Vector<Poin
     prim->colors = p_colors;
     prim->width = p_width;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(prim);
 }
@@ -788,6 +867,7 @@ void VisualServerCanvas::canvas_item_add_polygon(RID p_item, Span<const Point2>
     polygon->antialiased = p_antialiased;
     polygon->antialiasing_use_indices = false;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(polygon);
 }
@@ -833,6 +913,7 @@ void VisualServerCanvas::canvas_item_add_triangle_array(RID p_item, Span<const i
     polygon->antialiased = p_antialiased;
     polygon->antialiasing_use_indices = p_antialiasing_use_indices;
     canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
 
     canvas_item->commands.push_back(polygon);
 }
@@ -846,6 +927,8 @@ void VisualServerCanvas::canvas_item_add_set_transform(RID p_item, const Transfo
     ERR_FAIL_COND(!tr);
     tr->xform = p_transform;
 
+    canvas_item->rect_dirty = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(tr);
 }
 
@@ -862,6 +945,9 @@ void VisualServerCanvas::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
     m->transform = p_transform;
     m->modulate = p_modulate;
 
+    canvas_item->rect_dirty = true;
+    canvas_item->unbounded_content = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(m);
 }
 void VisualServerCanvas::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture, RID p_normal) {
@@ -879,6 +965,8 @@ void VisualServerCanvas::canvas_item_add_particles(RID p_item, RID p_particles,
     VSG::storage->particles_request_process(p_particles);
 
     canvas_item->rect_dirty = true;
+    canvas_item->unbounded_content = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(part);
 }
 
@@ -894,6 +982,8 @@ void VisualServerCanvas::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
     mm->normal_map = p_normal_map;
 
     canvas_item->rect_dirty = true;
+    canvas_item->unbounded_content = true;
+    _mark_subtree_dirty(canvas_item);
     canvas_item->commands.push_back(mm);
 }
 
@@ -959,6 +1049,7 @@ void VisualServerCanvas::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
         canvas_item->copy_back_buffer->rect = p_rect;
         canvas_item->copy_back_buffer->full = p_rect == Rect2();
     }
+    _mark_subtree_dirty(canvas_item);
 }
 
 void VisualServerCanvas::canvas_item_clear(RID p_item) {
@@ -967,6 +1058,8 @@ void VisualServerCanvas::canvas_item_clear(RID p_item) {
     ERR_FAIL_COND(!canvas_item);
 
     canvas_item->clear();
+    canvas_item->unbounded_content = false;
+    _mark_subtree_dirty(canvas_item);
 }
 void VisualServerCanvas::canvas_item_set_draw_index(RID p_item, int p_index) {
 
@@ -1383,6 +1476,7 @@ bool VisualServerCanvas::free(RID p_rid) {
 
                 Item *item_owner = canvas_item_owner.get(canvas_item->parent);
                 item_owner->child_items.erase_first(canvas_item);
+                _mark_subtree_dirty(item_owner);
 
                 if (item_owner->sort_y) {
                     _mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -1403,8 +1497,6 @@ bool VisualServerCanvas::free(RID p_rid) {
 
         canvas_item_owner.free(p_rid);
 
-        memdelete(canvas_item);
-
     } else if (canvas_light_owner.owns(p_rid)) {
 
         RasterizerCanvas::Light3D *canvas_light = canvas_light_owner.get(p_rid);
@@ -1474,6 +1566,14 @@ VisualServerCanvas::VisualServerCanvas() {
 
     disable_scale = false;
     snap_2d_transforms = Engine::get_singleton()->get_snap_2d_transforms();
+    culled_item_count = 0;
+    culled_item_count_final = 0;
+}
+
+void VisualServerCanvas::end_frame_info() {
+
+    culled_item_count_final = culled_item_count;
+    culled_item_count = 0;
 }
 
 VisualServerCanvas::~VisualServerCanvas() {
@@ -53,6 +53,16 @@ public:
         Vector2 ysort_pos;
         int ysort_index;
 
+        // Bounds of this item and its visible descendants in the item's local space, rebuilt lazily by the renderer.
+        // A dirty item always has dirty ancestors, so changes only walk up until the first dirty one.
+        Rect2 subtree_rect;
+        int subtree_item_count;
+        bool subtree_has_rect;
+        bool subtree_dirty;
+        // Something in the subtree has to be visited every frame, or has bounds that change behind our back.
+        bool subtree_unbounded;
+        bool unbounded_content; // mesh, multimesh or particles commands
+
         Vector<Item *> child_items;
 
         Item() {
@@ -69,6 +79,11 @@ public:
             ysort_xform = Transform2D();
             ysort_pos = Vector2();
             ysort_index = 0;
+            subtree_item_count = 1;
+            subtree_has_rect = false;
+            subtree_dirty = true;
+            subtree_unbounded = false;
+            unbounded_content = false;
         }
     };
 
@@ -151,7 +166,7 @@ public:
     };
 
     mutable RID_Owner<Canvas> canvas_owner;
-    RID_Owner<Item> canvas_item_owner;
+    RID_Alloc<Item> canvas_item_owner;
     RID_Owner<RasterizerCanvas::Light3D> canvas_light_owner;
 
     bool disable_scale;
@@ -161,13 +176,23 @@ private:
     void _render_canvas_item_tree(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RasterizerCanvas::Light3D *p_lights);
     void _render_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RasterizerCanvas::Item **z_list, RasterizerCanvas::Item **z_last_list, Item *p_canvas_clip, Item *p_material_owner);
     void _light_mask_canvas_items(int p_z, RasterizerCanvas::Item *p_canvas_item, RasterizerCanvas::Light3D *p_masked_lights);
+    void _mark_subtree_dirty(Item *p_item);
+    void _mark_parent_subtree_dirty(Item *p_item);
+    void _update_subtree(Item *p_item);
 
     RasterizerCanvas::Item **z_list;
     RasterizerCanvas::Item **z_last_list;
 
+    uint32_t culled_item_count;
+    uint32_t culled_item_count_final;
+
 public:
     void render_canvas(Canvas *p_canvas, const Transform2D &p_transform, RasterizerCanvas::Light3D *p_lights, RasterizerCanvas::Light3D *p_masked_lights, const Rect2 &p_clip_rect);
 
+    //! Canvas items skipped in the last frame because their whole subtree was outside of the viewport.
+    int get_culled_items_in_frame() const { return culled_item_count_final; }
+    void end_frame_info();
+
     RID canvas_create();
     void canvas_set_item_mirroring(RID p_canvas, RID p_item, const Point2 &p_mirroring);
     void canvas_set_modulate(RID p_canvas, const Color &p_color);
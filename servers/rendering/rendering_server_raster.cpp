@@ -107,6 +107,7 @@ void RenderingServerRaster::draw(bool p_swap_buffers, double frame_step) {
     VSG::scene->render_probes();
     _draw_margins();
     VSG::rasterizer->end_frame(p_swap_buffers);
+    VSG::canvas->end_frame_info();
     PROFILER_ENDFRAME("viewport");
 
     {
@@ -150,6 +151,9 @@ void RenderingServerRaster::finish() {
 
 int RenderingServerRaster::get_render_info(RS::RenderInfo p_info) {
 
+    if (p_info == RS::INFO_2D_ITEMS_CULLED_IN_FRAME) {
+        return VSG::canvas->get_culled_items_in_frame();
+    }
     return VSG::storage->get_render_info(p_info);
 }
 const char *RenderingServerRaster::get_video_adapter_name() const {
@@ -237,6 +237,13 @@ public:
     BIND2RC(Vector<Vector<uint8_t> >, mesh_surface_get_blend_shapes, RID, int)
     BIND2RC(const Vector<AABB> &, mesh_surface_get_skeleton_aabb, RID, int)
 
+    void mesh_surface_set_lods(RID arg1, int arg2, const Vector<float> &arg3, const Vector<PoolVector<uint8_t>> &arg4) override {
+        DISPLAY_CHANGED
+        BINDBASE->mesh_surface_set_lods(arg1, arg2, arg3, arg4);
+    }
+    BIND2RC(Vector<float>, mesh_surface_get_lod_errors, RID, int)
+    BIND2RC(Vector<Vector<uint8_t> >, mesh_surface_get_lod_index_arrays, RID, int)
+
     void mesh_remove_surface(RID arg1, int arg2) override { DISPLAY_CHANGED BINDBASE->mesh_remove_surface(arg1, arg2); }
     int mesh_get_surface_count(RID arg1) const override { return BINDBASE->mesh_get_surface_count(arg1); }
 
@@ -38,6 +38,7 @@
 #include "core/os/mutex.h"
 #include "core/os/os.h"
 #include "core/map.h"
+#include "core/project_settings.h"
 #include <new>
 
 namespace {
@@ -652,10 +653,8 @@ void VisualServerScene::_instance_queue_update(Instance *p_instance, bool p_upda
 
 RID VisualServerScene::instance_create() {
 
-    Instance *instance = memnew(Instance);
-    ERR_FAIL_COND_V(!instance, RID());
-
-    RID instance_rid = instance_owner.make_rid(instance);
+    RID instance_rid = instance_owner.make_rid();
+    Instance *instance = instance_owner.getornull(instance_rid);
     instance_rid.eid = VSG::ecs->registry.create();
 
     instance->self = instance_rid;
@@ -1242,8 +1241,63 @@ void VisualServerScene::instance_geometry_set_material_override(RID p_instance,
 }
 
 void VisualServerScene::instance_geometry_set_draw_range(RID p_instance, float p_min, float p_max, float p_min_margin, float p_max_margin) {
+
+    Instance *instance = instance_owner.get(p_instance);
+    ERR_FAIL_COND(!instance);
+
+    instance->lod_begin = M_MAX(p_min, 0.0f);
+    instance->lod_end = M_MAX(p_max, 0.0f);
+    instance->lod_begin_hysteresis = M_MAX(p_min_margin, 0.0f);
+    instance->lod_end_hysteresis = M_MAX(p_max_margin, 0.0f);
+    instance->lod_in_range = true;
+    instance->lod_range_pass = 0;
 }
 void VisualServerScene::instance_geometry_set_as_instance_lod(RID p_instance, RID p_as_lod_of_instance) {
+
+    Instance *instance = instance_owner.get(p_instance);
+    ERR_FAIL_COND(!instance);
+    ERR_FAIL_COND(p_instance == p_as_lod_of_instance);
+
+    instance->lod_instance = p_as_lod_of_instance;
+}
+
+bool VisualServerScene::_instance_update_draw_range(Instance *p_instance, const Vector3 &p_cam_pos) {
+
+    if (p_instance->lod_range_pass == render_pass) {
+        return p_instance->lod_in_range;
+    }
+    p_instance->lod_range_pass = render_pass;
+
+    if (p_instance->lod_begin <= 0 && p_instance->lod_end <= 0) {
+        p_instance->lod_in_range = true;
+        return true;
+    }
+
+    const AABB &aabb = get_component<InstanceBoundsComponent>(p_instance->self).transformed_aabb;
+    const float dist = p_cam_pos.distance_to(aabb.position + aabb.size * 0.5f);
+
+    // the range grows by the margins while inside and shrinks while outside, so objects near a limit don't flicker.
+    const float sign = p_instance->lod_in_range ? 1.0f : -1.0f;
+    const float begin = p_instance->lod_begin - sign * p_instance->lod_begin_hysteresis;
+    const float end = p_instance->lod_end + sign * p_instance->lod_end_hysteresis;
+
+    p_instance->lod_in_range = dist >= begin && (p_instance->lod_end <= 0 || dist < end);
+    return p_instance->lod_in_range;
+}
+
+bool VisualServerScene::_instance_is_drawn_at(Instance *p_instance, const Vector3 &p_cam_pos) {
+
+    if (!_instance_update_draw_range(p_instance, p_cam_pos)) {
+        return false;
+    }
+    if (p_instance->lod_instance.is_valid()) {
+        // a LOD stands in for its instance, only while that one is outside of its own range.
+        Instance *lod_of = instance_owner.getornull(p_instance->lod_instance);
+        if (lod_of && _instance_update_draw_range(lod_of, p_cam_pos)) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void VisualServerScene::_update_instance(Instance *p_instance) {
@@ -2117,7 +2171,7 @@ void VisualServerScene::render_camera(RID p_camera, RID p_scenario, Size2 p_view
         } break;
     }
 
-    _prepare_scene(camera->transform, camera_matrix, ortho, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID());
+    _prepare_scene(camera->transform, camera_matrix, ortho, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), p_viewport_size.height);
     _render_scene(camera->transform, camera_matrix, ortho, camera->env, p_scenario, p_shadow_atlas, RID(), -1);
 #endif
 }
@@ -2196,17 +2250,17 @@ void VisualServerScene::render_camera(Ref<ARVRInterface> &p_interface, ARVREyes
         mono_transform *= apply_z_shift;
 
         // now prepare our scene with our adjusted transform projection matrix
-        _prepare_scene(mono_transform, combined_matrix, false, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID());
+        _prepare_scene(mono_transform, combined_matrix, false, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), p_viewport_size.height);
     } else if (p_eye == ARVREyes::EYE_MONO) {
         // For mono render, prepare as per usual
-        _prepare_scene(cam_transform, camera_matrix, false, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID());
+        _prepare_scene(cam_transform, camera_matrix, false, camera->env, camera->visible_layers, p_scenario, p_shadow_atlas, RID(), p_viewport_size.height);
     }
 
     // And render our scene...
     _render_scene(cam_transform, camera_matrix, false, camera->env, p_scenario, p_shadow_atlas, RID(), -1);
 }
 
-void VisualServerScene::_prepare_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_force_environment, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe) {
+void VisualServerScene::_prepare_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_force_environment, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe, float p_screen_height) {
     SCOPE_AUTONAMED
 
     // Note, in stereo rendering:
@@ -2227,6 +2281,13 @@ void VisualServerScene::_prepare_scene(const Transform &p_cam_transform, const C
     Plane near_plane(p_cam_transform.origin, -p_cam_transform.basis.get_axis(2).normalized());
     float z_far = p_cam_projection.get_z_far();
 
+    // pixels covered by one world unit at distance 1 (or anywhere, for orthogonal cameras), divided by the allowed error.
+    float lod_pixels_per_unit = 0.0f;
+    if (p_screen_height > 0 && lod_threshold_pixels > 0) {
+        lod_pixels_per_unit = p_screen_height * 0.5f * p_cam_projection.matrix[1][1] / lod_threshold_pixels;
+    }
+    const float lod_z_near = M_MAX(p_cam_projection.get_z_near(), CMP_EPSILON);
+
     /* STEP 2 - CULL */
     instance_cull_count = scenario->sps.cull_convex(planes, instance_cull_result, MAX_INSTANCE_CULL);
     light_cull_count = 0;
@@ -2309,6 +2370,10 @@ void VisualServerScene::_prepare_scene(const Transform &p_cam_transform, const C
                 gi_probe_update_list.add(&gi_probe->update_element);
             }
 
+        } else if (has_component<GeometryComponent>(ins->self.eid) && !_instance_is_drawn_at(ins, p_cam_transform.origin)) {
+
+            // outside of its draw range, or the instance it is a LOD of is drawn instead.
+
         } else if (has_component<GeometryComponent>(ins->self.eid) && ins->visible && ins->cast_shadows != RS::SHADOW_CASTING_SETTING_SHADOWS_ONLY) {
 
             keep = true;
@@ -2379,6 +2444,23 @@ void VisualServerScene::_prepare_scene(const Transform &p_cam_transform, const C
 
             ins->depth = near_plane.distance_to(ins->transform.origin);
             ins->depth_layer = CLAMP(int(ins->depth * 16 / z_far), 0, 15);
+
+            if (lod_pixels_per_unit > 0 && ins->base_type == RS::INSTANCE_MESH) {
+                const AABB &aabb = get_component<InstanceBoundsComponent>(ins->self).transformed_aabb;
+                float dist = 1.0f;
+                if (!p_cam_orthogonal) {
+                    // distance to the closest point of the bounding sphere.
+                    dist = p_cam_transform.origin.distance_to(aabb.position + aabb.size * 0.5f) - aabb.size.length() * 0.5f;
+                    dist = M_MAX(dist, lod_z_near);
+                }
+                const Vector3 scale = ins->transform.basis.get_scale();
+                const float error_scale = lod_pixels_per_unit * M_MAX(scale.x, M_MAX(scale.y, scale.z)) / dist;
+                // only re-pick once the size changed noticeably, an instance sitting on a LOD boundary would pop otherwise.
+                const float prev = ins->lod_error_scale;
+                if (prev <= 0 || error_scale > prev * (1.0f + lod_hysteresis) || error_scale < prev * (1.0f - lod_hysteresis)) {
+                    ins->lod_error_scale = error_scale;
+                }
+            }
         }
 
         if (!keep) {
@@ -3397,8 +3479,6 @@ bool VisualServerScene::free(RID p_rid) {
 
         update_dirty_instances();
 
-        Instance *instance = instance_owner.get(p_rid);
-
         instance_set_use_lightmap(p_rid, RID(), RID());
         instance_set_scenario(p_rid, RID());
         instance_set_base(p_rid, RID());
@@ -3408,7 +3488,6 @@ bool VisualServerScene::free(RID p_rid) {
         update_dirty_instances(); //in case something changed this
 
         instance_owner.free(p_rid);
-        memdelete(instance);
     } else {
         return false;
     }
@@ -3427,6 +3506,8 @@ VisualServerScene::VisualServerScene() {
     probe_bake_thread_exit = false;
 
     render_pass = 1;
+    lod_threshold_pixels = T_GLOBAL_GET<float>("rendering/quality/lod/threshold_pixels");
+    lod_hysteresis = T_GLOBAL_GET<float>("rendering/quality/lod/hysteresis");
     singleton = this;
 }
 
@@ -83,6 +83,9 @@ public:
     };
 
     uint64_t render_pass;
+    // mesh LOD selection, allowed screen space error in pixels and the relative change needed to re-pick a level.
+    float lod_threshold_pixels;
+    float lod_hysteresis;
 
     static VisualServerScene *singleton;
 
@@ -198,6 +201,8 @@ public:
         float lod_begin_hysteresis;
         float lod_end_hysteresis;
         RID lod_instance;
+        bool lod_in_range;
+        uint64_t lod_range_pass;
 
         uint64_t last_render_pass;
         uint64_t last_frame_pass;
@@ -225,6 +230,8 @@ public:
             lod_end = 0;
             lod_begin_hysteresis = 0;
             lod_end_hysteresis = 0;
+            lod_in_range = true;
+            lod_range_pass = 0;
 
             last_render_pass = 0;
             last_frame_pass = 0;
@@ -408,7 +415,7 @@ public:
     RID reflection_probe_instance_cull_result[MAX_REFLECTION_PROBES_CULLED];
     int reflection_probe_cull_count;
 
-    RID_Owner<Instance> instance_owner;
+    RID_Alloc<Instance> instance_owner;
 
     RID instance_create();
 
@@ -439,6 +446,8 @@ public:
 
     void instance_geometry_set_draw_range(RID p_instance, float p_min, float p_max, float p_min_margin, float p_max_margin);
     void instance_geometry_set_as_instance_lod(RID p_instance, RID p_as_lod_of_instance);
+    bool _instance_update_draw_range(Instance *p_instance, const Vector3 &p_cam_pos);
+    bool _instance_is_drawn_at(Instance *p_instance, const Vector3 &p_cam_pos);
 
     _FORCE_INLINE_ void _update_instance(Instance *p_instance);
     _FORCE_INLINE_ void _update_instance_aabb(Instance *p_instance);
@@ -449,9 +458,10 @@ public:
     _FORCE_INLINE_ bool _light_instance_update_shadow(Instance *p_instance, const Transform &p_cam_transform,
             const CameraMatrix &p_cam_projection, bool p_cam_orthogonal, RID p_shadow_atlas, Scenario *p_scenario);
 
+    //! p_screen_height is used to pick mesh LODs, 0 keeps the levels selected by the last camera pass.
     void _prepare_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal,
             RID p_force_environment, uint32_t p_visible_layers, RID p_scenario, RID p_shadow_atlas,
-            RID p_reflection_probe);
+            RID p_reflection_probe, float p_screen_height = 0.0f);
     void _render_scene(const Transform &p_cam_transform, const CameraMatrix &p_cam_projection, bool p_cam_orthogonal,
             RID p_force_environment, RID p_scenario, RID p_shadow_atlas, RID p_reflection_probe,
             int p_reflection_probe_pass);
@@ -181,6 +181,10 @@ public:
         return *ret;
     }
 
+    FUNC4(mesh_surface_set_lods, RID, int, const Vector<float> &, const Vector<PoolVector<uint8_t> > &)
+    FUNC2RC(Vector<float>, mesh_surface_get_lod_errors, RID, int)
+    FUNC2RC(Vector<Vector<uint8_t> >, mesh_surface_get_lod_index_arrays, RID, int)
+
     FUNC2(mesh_remove_surface, RID, int)
     FUNC1RC(int, mesh_get_surface_count, RID)
 
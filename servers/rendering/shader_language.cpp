@@ -42,6 +42,8 @@
 #include "core/ustring.h"
 #include "servers/rendering_server.h"
 
+#include <EASTL/sort.h>
+
 static bool _is_text_char(CharType c) {
 
     return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
@@ -294,6 +296,29 @@ const ShaderLanguage::KeyWord ShaderLanguage::keyword_list[] = {
     { TK_ERROR, nullptr }
 };
 
+ShaderLanguage::TokenType ShaderLanguage::_find_keyword(StringView p_text) {
+
+    // keyword_list sorted by text once, so identifiers are matched with a binary search.
+    static const Vector<KeyWord> sorted_keywords = [] {
+        Vector<KeyWord> keywords;
+        for (int i = 0; keyword_list[i].text; i++) {
+            keywords.push_back(keyword_list[i]);
+        }
+        eastl::sort(keywords.begin(), keywords.end(), [](const KeyWord &a, const KeyWord &b) {
+            return StringView(a.text) < StringView(b.text);
+        });
+        return keywords;
+    }();
+
+    auto iter = eastl::lower_bound(sorted_keywords.begin(), sorted_keywords.end(), p_text, [](const KeyWord &k, StringView t) {
+        return StringView(k.text) < t;
+    });
+    if (iter != sorted_keywords.end() && StringView(iter->text) == p_text) {
+        return iter->token;
+    }
+    return TK_ERROR;
+}
+
 ShaderLanguage::Token ShaderLanguage::_get_token() {
 
 #define GETCHAR(m_idx) ((size_t(char_idx + m_idx) < code.length()) ? code[size_t(char_idx + m_idx)] : char(0))
@@ -517,7 +542,7 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
                     bool sign_found = false;
                     bool float_suffix_found = false;
 
-                    String str;
+                    // the constant is scanned in place, str only views the code.
                     int i = 0;
 
                     while (true) {
@@ -526,7 +551,7 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
                                 return _make_token(TK_ERROR, "Invalid numeric constant");
                             period_found = true;
                         } else if (GETCHAR(i) == 'x') {
-                            if (hexa_found || str.length() != 1 || str[0] != '0')
+                            if (hexa_found || i != 1 || GETCHAR(0) != '0')
                                 return _make_token(TK_ERROR, "Invalid numeric constant");
                             hexa_found = true;
                         } else if (GETCHAR(i) == 'e') {
@@ -549,10 +574,10 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
                         } else
                             break;
 
-                        str += GETCHAR(i);
                         i++;
                     }
 
+                    StringView str = StringView(code).substr(char_idx, i);
                     CharType last_char = str[str.length() - 1];
 
                     if (hexa_found) {
@@ -583,7 +608,7 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
 
                         if (float_suffix_found) {
                             //strip the suffix
-                            str = StringUtils::left(str,str.length() - 1);
+                            str = str.substr(0, str.length() - 1);
                             //compensate reading cursor position
                             char_idx += 1;
                         }
@@ -626,28 +651,23 @@ ShaderLanguage::Token ShaderLanguage::_get_token() {
 
                 if (_is_text_char(GETCHAR(0))) {
                     // parse identifier
-                    String str;
+                    int start = char_idx;
 
                     while (_is_text_char(GETCHAR(0))) {
-
-                        str += (GETCHAR(0));
                         char_idx++;
                     }
+                    StringView str = StringView(code).substr(start, char_idx - start);
 
-                    //see if keyword
-                    //should be converted to a static map
-                    int idx = 0;
-
-                    while (keyword_list[idx].text) {
-
-                        if (str == keyword_list[idx].text) {
-
-                            return _make_token(keyword_list[idx].token);
-                        }
-                        idx++;
+                    TokenType keyword = _find_keyword(str);
+                    if (keyword != TK_ERROR) {
+                        return _make_token(keyword);
                     }
 
-                    return _make_token(TK_IDENTIFIER, StringName(str.replaced("dus_", "_")));
+                    // interning a view of the code only allocates the first time a name is seen.
+                    if (str.find("dus_") != StringView::npos) {
+                        return _make_token(TK_IDENTIFIER, StringName(String(str).replaced("dus_", "_")));
+                    }
+                    return _make_token(TK_IDENTIFIER, StringName(str));
                 }
 
                 if (GETCHAR(0) > 32)
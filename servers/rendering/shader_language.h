@@ -653,6 +653,8 @@ private:
     };
 
     static const KeyWord keyword_list[];
+    //! Returns TK_ERROR when p_text is not a keyword.
+    static TokenType _find_keyword(StringView p_text);
 
     bool error_set;
     String error_str;
@@ -2192,6 +2192,7 @@ void RenderingServer::_bind_methods() {
     BIND_NS_ENUM_CONSTANT(RenderingServerEnums, INFO_VIDEO_MEM_USED);
     BIND_NS_ENUM_CONSTANT(RenderingServerEnums, INFO_TEXTURE_MEM_USED);
     BIND_NS_ENUM_CONSTANT(RenderingServerEnums, INFO_VERTEX_MEM_USED);
+    BIND_NS_ENUM_CONSTANT(RenderingServerEnums, INFO_2D_ITEMS_CULLED_IN_FRAME);
 
     BIND_NS_ENUM_CONSTANT(RenderingServerEnums, FEATURE_SHADERS);
     BIND_NS_ENUM_CONSTANT(RenderingServerEnums, FEATURE_MULTITHREADED);
@@ -2363,6 +2364,13 @@ RenderingServer::RenderingServer() {
     GLOBAL_DEF("rendering/quality/shading/force_blinn_over_ggx", false);
     GLOBAL_DEF("rendering/quality/shading/force_blinn_over_ggx.mobile", true);
 
+    GLOBAL_DEF("rendering/quality/lod/threshold_pixels", 1.0f);
+    ps->set_custom_property_info("rendering/quality/lod/threshold_pixels",
+            PropertyInfo(VariantType::FLOAT, "rendering/quality/lod/threshold_pixels", PropertyHint::Range, "0,16,0.01"));
+    GLOBAL_DEF("rendering/quality/lod/hysteresis", 0.1f);
+    ps->set_custom_property_info("rendering/quality/lod/hysteresis",
+            PropertyInfo(VariantType::FLOAT, "rendering/quality/lod/hysteresis", PropertyHint::Range, "0,0.5,0.01"));
+
     GLOBAL_DEF("rendering/quality/depth_prepass/enable", true);
     // GLOBAL_DEF("rendering/quality/depth_prepass/disable_for_vendors", "PowerVR,Mali,Adreno,Apple");
 
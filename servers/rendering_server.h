@@ -372,6 +372,12 @@ public: // scripting glue helpers
     virtual const Vector<AABB> &mesh_surface_get_skeleton_aabb(RID p_mesh, int p_surface) const = 0;
     Array _mesh_surface_get_skeleton_aabb_bind(RID p_mesh, int p_surface) const;
 
+    /// Reduced detail index buffers, ordered from finest to coarsest. Each index array uses the same format as the
+    /// surface's own index array, p_lod_errors holds the object space error of every level.
+    virtual void mesh_surface_set_lods(RID p_mesh, int p_surface, const Vector<float> &p_lod_errors, const Vector<PoolVector<uint8_t>> &p_lod_index_arrays) = 0;
+    virtual Vector<float> mesh_surface_get_lod_errors(RID p_mesh, int p_surface) const = 0;
+    virtual Vector<Vector<uint8_t>> mesh_surface_get_lod_index_arrays(RID p_mesh, int p_surface) const = 0;
+
     virtual void mesh_remove_surface(RID p_mesh, int p_index) = 0;
     virtual int mesh_get_surface_count(RID p_mesh) const = 0;
 
@@ -380,6 +380,7 @@ enum RenderInfo : int8_t {
     INFO_VIDEO_MEM_USED,
     INFO_TEXTURE_MEM_USED,
     INFO_VERTEX_MEM_USED,
+    INFO_2D_ITEMS_CULLED_IN_FRAME,
 };
 
 /* TESTING */